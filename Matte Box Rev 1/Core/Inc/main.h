@@ -124,7 +124,10 @@ void Error_Handler(void);
 #define LOW_BAT_IRQ_GPIO_Port GPIOB
 #define LOW_BAT_IRQ_EXTI_IRQn EXTI9_5_IRQn
 /* USER CODE BEGIN Private defines */
-
+// Rev 1 only routes D0 and D2 of the card, a board with D1 (PC9) and D3 (PC11) sets this to 1
+#ifndef SD_BUS_WIDE_4B
+#define SD_BUS_WIDE_4B 0
+#endif
 /* USER CODE END Private defines */
 
 #ifdef __cplusplus
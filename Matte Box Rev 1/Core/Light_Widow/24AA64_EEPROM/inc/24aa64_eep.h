@@ -14,6 +14,9 @@
  * UID Length is 8 bytes long
  * 2 bytes are reserved for the index of the filter name
  * Total UID Block size is 10 bytes long
+ * The UID Associations end below 0x1FE0, enough for 713 entries
+ *
+ * Address 0x1FE0-0x1FFF, the last page, is reserved for the slot locator calibration table
  * */
 
 
@@ -53,6 +56,12 @@
 #define EEPROM_ASSC_COUNT_LEN		2
 #define EEPROM_ASSC_START_ADDR		(EEPROM_ASSC_COUNT_ADDR + EEPROM_ASSC_COUNT_LEN)	/* Starting Address for the UID Associations 	*/
 #define EEPROM_ASSC_BLOCK_LEN		10													/* Length of UID Association Block 		        */
+#define EEPROM_ASSC_MAX_COUNT		((EEPROM_SLOT_CAL_ADDR - EEPROM_ASSC_START_ADDR) / EEPROM_ASSC_BLOCK_LEN)	/* Associations that fit below the reserved page	*/
+
+// Reserved address locations
+#define EEPROM_PAGE_SIZE			32													/* Write page of the 24AA64					    */
+#define EEPROM_SLOT_CAL_ADDR		0x1FE0												/* Last page, slot locator calibration table	*/
+#define EEPROM_SLOT_CAL_LEN			EEPROM_PAGE_SIZE
 
 /********************************************************************************
  * TYPES
@@ -73,8 +82,8 @@ typedef enum{
 // Read Filter Association
 EEPROM_Status_t readNameFromUID(uint8_t *UID, uint8_t *name);
 
-// Write Filter Association
-void associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen);
+// Write Filter Association, EEPROM_ERR when a new UID finds the association section full
+EEPROM_Status_t associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen);
 
 // Read Filter Association Counter
 void readAssociationCount(uint16_t *aCount);
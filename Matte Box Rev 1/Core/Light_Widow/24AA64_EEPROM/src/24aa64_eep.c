@@ -28,8 +28,11 @@ EEPROM_Status_t readNameFromUID(uint8_t *UID, uint8_t *name){
 
 	uidAddr = EEPROM_ASSC_COUNT_LEN + EEPROM_ASSC_COUNT_ADDR;
 
-	// Get the number of associated entries
+	// Get the number of associated entries, a blank or corrupt counter must not reach the reserved page
 	readAssociationCount(&counter);
+	if (counter > EEPROM_ASSC_MAX_COUNT) {
+		counter = EEPROM_ASSC_MAX_COUNT;
+	}
 
 	// Search through the entries until UID is matched, or it runs out.
 	for (uidIndex = 0; uidIndex < counter; uidIndex++){
@@ -64,7 +67,7 @@ EEPROM_Status_t readNameFromUID(uint8_t *UID, uint8_t *name){
 }
 
 // Adds a new Name/UID entry to EEPROM
-void associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen){
+EEPROM_Status_t associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen){
 // Search for the name within the Common Filter Name Section
 // If the name is found, return the index, otherwise, store the name and return the index
 
@@ -124,8 +127,11 @@ void associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen){
 // Next Step: search for the UID within the UID Block section
 	// If UID is found, return a duplicate UID error, otherwise, store the first open UID index
 
-	// Get the UID Count
+	// Get the UID Count, capped below the reserved page like in readNameFromUID
 	readAssociationCount(&counter);
+	if (counter > EEPROM_ASSC_MAX_COUNT) {
+		counter = EEPROM_ASSC_MAX_COUNT;
+	}
 
 	// Step through each UID looking for a match
 	for (uidIndex = 0; uidIndex < counter; uidIndex++) {
@@ -148,6 +154,10 @@ void associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen){
 
 	// Check to see if the UID was found in the EEPROM
 	if (!uidFound){
+		// A new entry past the last block would overwrite the reserved page
+		if (counter >= EEPROM_ASSC_MAX_COUNT) {
+			return EEPROM_ERR;
+		}
 		// The UID is not in the list. Store it and update the UID association count in the EEPROM.
 		// Store UID at previously determined address
 		eepromWrite(uidAddr, UID, UID_SIZE);
@@ -163,6 +173,7 @@ void associateNewUID(uint8_t *UID, uint8_t *name, uint8_t nameLen){
 	// Write the associated name index to the end of the UID
 	eepromWrite(uidAddr, (uint8_t *) &nameIndex, ASSC_SIZE);
 
+	return EEPROM_OK;
 }
 
 // Returns the number of associated entries
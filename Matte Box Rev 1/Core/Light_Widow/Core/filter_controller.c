@@ -25,6 +25,7 @@
 /*******************************************************************************
  * LOCAL FUNCTION PROTOTYPES
  *******************************************************************************/
+static bool isStageEmpty(filterSection_t *currentFilters, uint8_t stage);
 
 /*******************************************************************************
  * GLOBAL FUNCTIONS
@@ -82,27 +83,23 @@ filterSectionStatus_t updateFilterSection(detectedTags_t *dTag, filterSection_t
 			// Make sure the detected UID is not all 0's
 			if (memcmp(dTag->filterTags[detectedTag].tagUID, tempZero, 8) != 0){
 				// A new filter has been installed.
-				bool stageEmpty; // Holder for the empty stage
 				bool filterEmpty; // Holder for the empty filter position
 				uint8_t stagePos;
 				uint8_t filterPos;
 
 				// Check the name to see if it isn't all zero's
 				if (memcmp(dTag->filterTags[detectedTag].tagName, tempZero, 10) != 0){
-					// Find first empty stage
-					for (stagePos = 0; stagePos < FILTER_SECTION_SIZE; stagePos++){
-						stageEmpty = true; // Assume the stage is empty
-						for (uint8_t curFilter = 0; curFilter < FILTER_SECTION_SIZE; curFilter++){
-							if (currentFilters->filter[curFilter].position == stagePos + 1){
-								//There is a filter loaded in this position
-								stageEmpty = false;
+					// Use the stage the tag was seen in when it is known and still free
+					if (dTag->filterTags[detectedTag].stage > 0 && isStageEmpty(currentFilters, dTag->filterTags[detectedTag].stage)) {
+						stagePos = dTag->filterTags[detectedTag].stage - 1;
+					} else {
+						// Find first empty stage
+						for (stagePos = 0; stagePos < FILTER_SECTION_SIZE; stagePos++){
+							if (isStageEmpty(currentFilters, stagePos + 1)) {
+								// Searched through all Filter positions, and this stage is empty
+								break; // Break for loop and access stagePos for first empty stage
 							}
 						}
-
-						if (stageEmpty) {
-							// Searched through all Filter positions, and this stage is empty
-							break; // Break for loop and access stagePos for first empty stage
-						}
 					}
 
 					// There is a scenario where the first position in currentFilters is taken, but assigned to a different slot
@@ -142,3 +139,13 @@ filterSectionStatus_t updateFilterSection(detectedTags_t *dTag, filterSection_t
 /*******************************************************************************
  * LOCAL FUNCTIONS
  *******************************************************************************/
+// Check if no filter is loaded in the stage (1..FILTER_SECTION_SIZE)
+static bool isStageEmpty(filterSection_t *currentFilters, uint8_t stage) {
+	for (uint8_t curFilter = 0; curFilter < FILTER_SECTION_SIZE; curFilter++){
+		if (currentFilters->filter[curFilter].position == stage){
+			//There is a filter loaded in this position
+			return false;
+		}
+	}
+	return true;
+}
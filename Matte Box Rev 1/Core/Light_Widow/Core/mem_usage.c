@@ -0,0 +1,81 @@
+/*  \file mem_usage.c
+ *  \author Colton Crandell
+ *  \brief  RAM budget of the firmware and the stack high-water mark
+ *
+ *  Everything the firmware needs is allocated statically, the heap is only left for newlib.
+ *  The sizes come from the linker script symbols. memUsageInit paints the unused part of the
+ *  stack reservation at boot, the deepest painted word that changed since then is the peak.
+ *  The "memStats" CLI command reports it, Tools/mem_report.py breaks the static part down by
+ *  module from the map file.
+ */
+
+
+/*******************************************************************************
+ * INCLUDES
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#include "mem_usage.h"
+#include "main.h"
+
+/*******************************************************************************
+ * LOCAL DEFINES
+ *******************************************************************************/
+
+/*******************************************************************************
+ * LOCAL VARIABLES
+ *******************************************************************************/
+// Linker script symbols, only their addresses mean something
+extern uint32_t _sdata;
+extern uint32_t _ebss;
+extern uint32_t _end;
+extern uint32_t _estack;
+extern uint32_t _Min_Heap_Size;
+extern uint32_t _Min_Stack_Size;
+
+/*******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ *******************************************************************************/
+extern caddr_t _sbrk(int incr);
+
+static uint32_t *stackLimit(void);
+
+/*******************************************************************************
+ * GLOBAL FUNCTIONS
+ *******************************************************************************/
+// Call first thing in main, before the stack gets deep
+void memUsageInit(void) {
+	uint32_t *p = stackLimit();
+	uint32_t *sp = (uint32_t *) (__get_MSP() - MEM_STACK_PAINT_GUARD);
+
+	while (p < sp) {
+		*p++ = MEM_STACK_PAINT;
+	}
+}
+
+void memUsageGet(memUsage_t *usage) {
+	uint32_t *limit = stackLimit();
+	uint32_t *p = limit;
+
+	usage->ramSize = (uint32_t) &_estack - (uint32_t) &_sdata;
+	usage->staticSize = (uint32_t) &_ebss - (uint32_t) &_sdata;
+	usage->heapReserved = (uint32_t) &_Min_Heap_Size;
+	usage->heapUsed = (uint32_t) _sbrk(0) - (uint32_t) &_end;
+	usage->stackReserved = (uint32_t) &_Min_Stack_Size;
+
+	// The stack grows down, find the lowest word that lost its paint
+	while ((p < &_estack) && (*p == MEM_STACK_PAINT)) {
+		p++;
+	}
+	usage->stackPeak = (uint32_t) &_estack - (uint32_t) p;
+	usage->stackOverflow = (p == limit);
+}
+
+/*******************************************************************************
+ * LOCAL FUNCTIONS
+ *******************************************************************************/
+static uint32_t *stackLimit(void) {
+	return (uint32_t *) ((uint32_t) &_estack - (uint32_t) &_Min_Stack_Size);
+}
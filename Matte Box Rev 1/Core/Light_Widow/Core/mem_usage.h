@@ -0,0 +1,37 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MEM_USAGE_H_
+#define MEM_USAGE_H_
+
+
+/********************************************************************************
+ * INCLUDES
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/********************************************************************************
+ * DEFINES
+ *******************************************************************************/
+#define MEM_STACK_PAINT				0xA5A5A5A5	/* Fill of the unused stack, a changed word was used		*/
+#define MEM_STACK_PAINT_GUARD		64			/* Bytes below the painting frame left alone				*/
+
+/********************************************************************************
+ * TYPES
+ *******************************************************************************/
+typedef struct {								/* RAM use, all sizes in bytes							*/
+	uint32_t ramSize;							/* Whole RAM											*/
+	uint32_t staticSize;						/* .data and .bss										*/
+	uint32_t heapReserved;						/* _Min_Heap_Size of the linker script					*/
+	uint32_t heapUsed;							/* Handed out by _sbrk so far							*/
+	uint32_t stackReserved;						/* _Min_Stack_Size of the linker script					*/
+	uint32_t stackPeak;							/* Deepest stack use since memUsageInit					*/
+	bool stackOverflow;							/* The stack used its whole reservation					*/
+} memUsage_t;
+
+/********************************************************************************
+ * PROTOTYPES
+ *******************************************************************************/
+void memUsageInit(void);
+void memUsageGet(memUsage_t *usage);
+
+#endif // MEM_USAGE_H_
@@ -20,6 +20,7 @@
 #include "process_controller.h"			/* Process Controller		*/
 #include "rfid_controller.h"			/* RFID Controller			*/
 #include "filter_controller.h"			/* Filter Controller		*/
+#include "slot_locator.h"				/* Filter Stage Estimation	*/
 
 #include "LW_USB_CLI.h"					/* USB CLI Interface		*/
 #include "dataLogger.h"					/* SD Card Datalogger		*/
@@ -51,12 +52,11 @@ EPD_HandleTypeDef epd1;					/* EPD Handle Type					  */
 Canvas canvas1;							/* To Handle Writing an Image to EPD  */
 
 /* RFID ----------------------------------------------------------------------*/
-uint8_t globalCommProtectCnt;			/* RFID Interrupt Protection Counter  */
 detectedTags_t dTags;					/* Detected Tags					  */
 filterSection_t fSection;				/* Filter Section					  */
 
 uint8_t changeFilterPos1;				/* Filter Change Position 1			  */
-uint16_t timeoutCtr;					/* Filter Change Counter			  */
+uint32_t changeFilterTick;				/* Filter Change Start Tick			  */
 
 /*******************************************************************************
  * LOCAL FUNCTION PROTOTYPES
@@ -64,6 +64,7 @@ uint16_t timeoutCtr;					/* Filter Change Counter			  */
 void checkISREvents(void);
 void changeFilterPosition(uint8_t firstBtn, uint8_t secondBtn);
 void gotoSleep(void);
+void idleDelay(uint32_t ms);
 
 /*******************************************************************************
  * EXTERNAL FUNCTIONS
@@ -80,11 +81,14 @@ void setupIOs(void){
 	LM75B_Init(&hi2c1, AUX_POWER_GPIO_Port, AUX_POWER_Pin);
 
 	// Initialize and Setup the E-Paper Display
-	EPD_Init(EPD_2_0, &hspi2, &epd1);
+	EPD_Init(MATTE_BOX_EPD_SIZE, &hspi2, &epd1);
 
-	// Initialize the GFX Library for the EPD
-	Canvas_Init(&canvas1, epd1.dots_per_line, epd1.lines_per_display);
-	// Text rotation for a vertical display orientation
+	// Initialize the GFX Library for the EPD. The frame buffers are sized for MATTE_BOX_EPD_SIZE,
+	// a panel that doesn't fit them would leave the canvas without an image to draw to
+	if (Canvas_Init(&canvas1, epd1.dots_per_line, epd1.lines_per_display) != CANVAS_OK) {
+		Error_Handler();
+	}
+	// Text rotation for a vertical display orientation, lays the slots out for it
 	canvas_SetRotate(&canvas1, ROTATE_90);
 
 	// Clear the EPD
@@ -92,9 +96,8 @@ void setupIOs(void){
 	EPD_clear(&epd1);
 	EPD_end(&epd1);
 
-	// Render a string of text to the buffer image
-	canvas_setBGImage(&canvas1, image_background);
-	canvas_DrawStringAt(&canvas1, 10, 3, "FILTERS", &Font16, 1);
+	// Render the header and the empty slots to the buffer image
+	canvas_DrawLayout(&canvas1);
 	// Update the EPD with the new image
 	canvas_PrintEPD(&canvas1, &epd1);
 
@@ -111,6 +114,9 @@ void setupIOs(void){
 	spiInit(&hspi1);
 
 	rfidControllerInit();
+
+	// Load the stage calibration used to place newly inserted filters
+	slotLocatorInit();
 }
 
 
@@ -121,24 +127,38 @@ void processIOs(void) {
 	uint8_t ampMeas, phsMeas;
 	char tmpStr[30];
 	int8_t tmpTemp;
+	rfSignature_t wakeSig;
+	slotTrace_t slotTrace;
 
 	while (1) {
 
 		// Keep the RFAL Happy
 		rfalWorker();
 
+		// Step the EPD update, the display refreshes while the box keeps running
+		canvas_Process(&canvas1, &epd1);
+
+		// Write the buffered log records when due, powers the card down once idle
+		dataLoggerProcess();
+
+		// Check on the CLI to see if any new commands are present, in every state
+		checkCliStatus();
+
 		// Check ISR events
 		checkISREvents();
 
 		switch (processState) {
 			case NORMAL_OPERATION:
 
-				// Check on the CLI to see if any new commands are present
-				//checkCliStatus();
-
 				// Find filters present in the matte box
 				checkFilterTags(&dTags);
 
+				// Estimate the stage of a newly inserted filter from the wake-up signature. Also printed so traces can be recorded for evaluation.
+				if (slotLocatorApply(&dTags, &fSection, &slotTrace)) {
+					sprintf(tmpStr, "SLOT %d,%d,%d,%d\r\n", slotTrace.sig.ampDelta, slotTrace.sig.phaseDelta, slotTrace.calStage, slotTrace.estimate);
+					CDC_Transmit_FS(tmpStr, strlen((char *)tmpStr));
+				}
+
 				// Compare found filter tags with previous filter section
 				filterStatus = updateFilterSection(&dTags, &fSection);
 
@@ -161,7 +181,8 @@ void processIOs(void) {
 						break;
 				}
 
-				// Set the RFID Chip into Wake Up Mode
+				// Reference for the next wake-up signature, then set the RFID Chip into Wake Up Mode
+				slotLocatorCaptureBaseline();
 				ReturnCode err = startWakeUpMode();
 				if (err == ERR_NONE) {
 					processState = RFID_WAKEUP_MODE;
@@ -170,19 +191,16 @@ void processIOs(void) {
 //				gotoSleep();
 //				SystemClock_Config();
 
-				HAL_Delay(500);
+				idleDelay(500);
 				break;
 
 			case CHANGE_FILTER_POS:
 				// Wait for another button press. Timeout after X amount of time.
-				if (timeoutCtr >= FILTER_POSITION_TIMEOUT) {
+				if (HAL_GetTick() - changeFilterTick >= FILTER_POSITION_TIMEOUT) {
 					// Draw stored
 					canvas_DrawFilters(&canvas1, &epd1, &fSection, 0);
 					processState = RFID_WAKEUP_MODE;
 				}
-
-				HAL_Delay(1);
-				timeoutCtr++;
 				break;
 
 			case UPDATE_FILTER_NAME:
@@ -192,11 +210,19 @@ void processIOs(void) {
 				break;
 
 			case RFID_WAKEUP_MODE:
+				// Clean up the ghosting of partial updates while nobody uses the box
+				canvas_Maintenance(&canvas1, &epd1);
+
 				// Handle an external wake up from the RFID chip
 				if (rfalWakeUpModeHasWoke()){
 					rfalWakeUpModeStop();
 					processState = NORMAL_OPERATION;
-					CDC_Transmit_FS("INTERRUPT\r\n", 11);
+
+					// Signature of whatever woke the reader. Also printed so traces can be recorded for evaluation.
+					if (slotLocatorCaptureEvent(&wakeSig) == ERR_NONE) {
+						sprintf(tmpStr, "WAKEUP %d,%d\r\n", wakeSig.ampDelta, wakeSig.phaseDelta);
+						CDC_Transmit_FS(tmpStr, strlen((char *)tmpStr));
+					}
 				}
 				break;
 
@@ -249,7 +275,7 @@ void checkISREvents(void) {
 					if (posFound) {
 						// Change filter position. Store button 1 as the first button.
 						changeFilterPos1 = 1;			// Log Button 1 as the first Selected Filter
-						timeoutCtr = 0;
+						changeFilterTick = HAL_GetTick();
 						// Highlight the Filter Name
 						canvas_DrawFilters(&canvas1, &epd1, &fSection, 1);
 						processState = CHANGE_FILTER_POS;
@@ -335,7 +361,7 @@ void checkISREvents(void) {
 					if (posFound) {
 						// Change filter position. Store button 1 as the first button.
 						changeFilterPos1 = 2;			// Log Button 2 as the first Selected Filter
-						timeoutCtr = 0;
+						changeFilterTick = HAL_GetTick();
 						// Highlight the Filter Name
 						canvas_DrawFilters(&canvas1, &epd1, &fSection, 2);
 						processState = CHANGE_FILTER_POS;
@@ -421,7 +447,7 @@ void checkISREvents(void) {
 					if (posFound) {
 						// Change filter position. Store button 1 as the first button.
 						changeFilterPos1 = 3;			// Log Button 3 as the first Selected Filter
-						timeoutCtr = 0;
+						changeFilterTick = HAL_GetTick();
 						// Highlight the Filter Name
 						canvas_DrawFilters(&canvas1, &epd1, &fSection, 3);
 						processState = CHANGE_FILTER_POS;
@@ -536,7 +562,29 @@ void changeFilterPosition(uint8_t firstBtn, uint8_t secondBtn) {
 }
 
 
+void idleDelay(uint32_t ms) {
+	uint32_t start = HAL_GetTick();
+
+	// HAL_Delay, without stalling an EPD update in the middle of a stage
+	while (HAL_GetTick() - start < ms + 1) {
+		canvas_Process(&canvas1, &epd1);
+	}
+}
+
+// The SD driver waits on its DMA transfers and the card programming here.
+// The EPD update keeps going while the log is written, nothing in it touches the card.
+void SD_WaitCallback(void) {
+	canvas_Process(&canvas1, &epd1);
+}
+
+
 void gotoSleep( void ) {
+	// The EPD update has to finish before the clocks stop, a held COG is powered down
+	canvas_Flush(&canvas1, &epd1);
+	EPD_release(&epd1);
+	// Buffered log records are lost if the battery runs out during sleep
+	dataLoggerSync();
+
 	HAL_GPIO_WritePin(RFID_POWER_GPIO_Port, RFID_POWER_Pin, GPIO_PIN_RESET);
 
 	// Set SLEEPDEEP bit of Cortex System Control Register
@@ -14,8 +14,11 @@
 #define MATTE_BOX_FW_ID				0x010101	/* Firmware Revision										*/
 #define FILTER_SECTION_SIZE			3			/* Number of filter slots installed							*/
 #define FILTER_NAME_LEN				10			/* String Length for Filter Names							*/
+#ifndef MATTE_BOX_EPD_SIZE
+#define MATTE_BOX_EPD_SIZE			EPD_2_0		/* E-Paper panel fitted, sizes the canvas frame buffers		*/
+#endif
 
-#define FILTER_POSITION_TIMEOUT		4000		/* Amount of process cycles until filter position timeout	*/
+#define FILTER_POSITION_TIMEOUT		4000		/* Time in ms until filter position timeout					*/
 
 /********************************************************************************
  * TYPES
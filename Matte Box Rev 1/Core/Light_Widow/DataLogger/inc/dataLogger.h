@@ -23,6 +23,38 @@
  * DEFINES
  *******************************************************************************/
 #define TAG_UID_LEN			8U
+
+// Write-behind policy. Records are formatted into RAM and reach the card in whole sectors,
+// the card is only powered while buffered records are written.
+#define DL_BUF_SIZE			2048U		/* Write-behind buffer, 4 sectors								*/
+#define DL_SECTOR_SIZE		512U		/* Flush granularity, the FatFs sector size						*/
+#define DL_FLUSH_AGE_MS		120000U		/* Oldest buffered record is written after this long			*/
+#define DL_FLUSH_IDLE_MS	20000U		/* No record for this long: write all, close, power the card down	*/
+#define DL_SYNC_MS			30000U		/* f_sync at most this far apart while full sectors stream		*/
+#define DL_PREALLOC_SIZE	65536U		/* Space reserved ahead of the records, given back on close		*/
+#define DL_CLMT_SIZE		16U			/* Cluster link map entries, 7 fragments of a reserved file		*/
+#define DL_BENCH_MAX_KB		4096U		/* Largest dataLoggerBenchmark file, the DWT counts for 40 s	*/
+
+/*	Binary log, Tools/log_export.py turns a file back into the CSV layout.
+ *	Header:	"LWL", version, CRC seed of the file's blocks (2 bytes), CRC-16 of the bytes before it
+ *	Block:	sync, payload length, base time (s since midnight, 3 bytes), payload,
+ *			CRC-16 of everything before it (CCITT, LSB first as in ISO 15693), preset with the seed
+ *	Record:	event, seconds since the previous record of the block (7 bits per byte, LSB first), event data
+ *	Names are sent once per file as DL_EVT_NAME records, later records use the index.
+ *	The seed is drawn when the file is created, blocks a deleted log left in the clusters
+ *	the file reserves fail its CRC. Version 1 files have no header and the preset 0xFFFF.
+ * */
+#define DL_LOG_VERSION		2U
+#define DL_FILE_HEADER		8U			/* Magic, version, seed, CRC									*/
+#define DL_LEGACY_SEED		0xFFFFU		/* Block CRC preset of a file without a header					*/
+#define DL_BLOCK_SYNC		0xB5U		/* First byte of every block									*/
+#define DL_BLOCK_HEADER		5U			/* Sync, length, base time										*/
+#define DL_BLOCK_PAYLOAD	240U		/* Record bytes per block, at most 255							*/
+#define DL_DELTA_MAX		3U			/* Encoded time delta bytes, a day fits in 3					*/
+#define DL_NAME_COUNT		32U			/* String table entries per file, a full table starts over		*/
+#define DL_NO_NAME			0xFFU		/* Name index of an empty slot									*/
+#define DL_TEMP_STEP		8			/* Log the temperature with a filter change when it moved 1 deg C	*/
+#define DL_TEMP_MAX_AGE_MS	60000U		/* Cached LM75B reading used for it								*/
 /******************************************************************************
  * TYPES
  *******************************************************************************/
@@ -56,6 +88,63 @@ typedef enum {
 	DATALOG_ERR
 } DL_error;
 
+typedef enum {							/* Event data after the record header							*/
+	DL_EVT_FILE,						/* Version, year (2 bytes), month, day, ID length, Matte Box ID	*/
+	DL_EVT_NAME,						/* Name index, length, characters								*/
+	DL_EVT_FILTERS,						/* Slot mask, a name index for every slot in the mask			*/
+	DL_EVT_BATTERY,						/* State of charge %, voltage mV (2 bytes)						*/
+	DL_EVT_TEMPERATURE,					/* 1/8 deg C (2 bytes)											*/
+	DL_EVT_ERROR						/* Source, code													*/
+} DL_event;
+
+typedef enum {
+	DL_SRC_LOGGER,						/* FRESULT of a failed write									*/
+	DL_SRC_RFID,
+	DL_SRC_EPD,
+	DL_SRC_GAUGE
+} DL_source;
+
+typedef enum {							/* Step a dataLoggerBenchmark run stopped at					*/
+	DL_BENCH_DONE,
+	DL_BENCH_NOT_READY,					/* Logger not initialized or size out of range					*/
+	DL_BENCH_NO_CARD,
+	DL_BENCH_FLUSH,						/* The buffered records couldn't be written first				*/
+	DL_BENCH_MOUNT,
+	DL_BENCH_OPEN,
+	DL_BENCH_WRITE,
+	DL_BENCH_READ						/* A FatFs error, or FR_OK with pieces read back wrong			*/
+} DL_bench_step;
+
+typedef struct {
+	uint32_t records;					/* Records accepted into the buffer						*/
+	uint32_t blocks;					/* Blocks closed										*/
+	uint32_t dropped;					/* Records lost to a full buffer						*/
+	uint32_t lost;						/* Buffered bytes of an old day or a block cut by a card change	*/
+	uint32_t flushes;					/* f_write calls										*/
+	uint32_t bytes;						/* Bytes written to the card							*/
+	uint32_t syncs;						/* f_sync and f_close calls								*/
+	uint32_t opens;						/* Log file opens										*/
+	uint32_t reserves;					/* Log file space reservations							*/
+	uint32_t powerUps;					/* Card power cycles									*/
+	uint32_t errors;					/* Failed writes, the records stay buffered				*/
+	uint32_t poweredMs;					/* Time the card was powered							*/
+	uint16_t buffered;					/* Bytes waiting in the buffer							*/
+} DL_stats;
+
+typedef struct {
+	uint32_t bytes;						/* Written and read back								*/
+	uint32_t writeMs;
+	uint32_t writeCycles;				/* DWT cycles of the pass, FatFs and the SD driver		*/
+	uint32_t writeWaitCycles;			/* Part of them waiting on the SDIO DMA and the card	*/
+	uint32_t readMs;
+	uint32_t readCycles;
+	uint32_t readWaitCycles;
+	uint32_t scratch;					/* Sectors copied through the driver's unaligned path	*/
+	uint32_t mismatches;				/* Pieces read back with the wrong content				*/
+	DL_bench_step step;					/* DL_BENCH_DONE, or the step that failed				*/
+	uint8_t fr;							/* FRESULT of the failed step, FR_OK before the card is opened	*/
+} DL_bench;
+
 /******************************************************************************
  * PROTOTYPES
  *******************************************************************************/
@@ -66,6 +155,19 @@ DL_error stopSDCard(void);
 
 DL_error logDataToSD(sdLog_record_t *sdLog);
 DL_error SDDataLog(filterSection_t *fSection);
+DL_error dataLogBattery(uint8_t soc, uint16_t voltage);
+DL_error dataLogTemperature(int16_t temp);
+DL_error dataLogError(DL_source source, uint8_t code);
+
+// Flush policy, call from the main loop
+void dataLoggerProcess(void);
+// Write everything, close the file at its last record and power the card down.
+// Before sleep, on card removal or low battery.
+DL_error dataLoggerSync(void);
+void dataLoggerGetStats(DL_stats *stats);
+// Sequential write and read of a scratch file, the buffered records are written first.
+// bench->step and bench->fr tell where a failed run stopped.
+DL_error dataLoggerBenchmark(uint32_t kbytes, DL_bench *bench);
 
 DL_error dataLogTest(void);
 #endif // DATA_LOGGER_H
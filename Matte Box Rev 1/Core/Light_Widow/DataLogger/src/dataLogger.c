@@ -13,21 +13,23 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "dataLogger.h"
 #include "fatfs.h"
 
 #include "rtc.h"
+#include "lm75b.h"
 #include "filter_controller.h"
+#include "rfal_crc.h"
 
 /******************************************************************************
  * DEFINES
  *******************************************************************************/
 #define DL_LOG_DIR_PATH		"0:/LIGHT_WIDOW"
-#define DL_DELIM			","
-#define DL_ENDL				"\n"
+#define DL_BLOCK_SIZE		(DL_BLOCK_HEADER + DL_BLOCK_PAYLOAD + 2)
+#define DL_BENCH_PATH		DL_LOG_DIR_PATH "/SDBENCH.BIN"
+#define DL_FILE_MAGIC		"LWL"
 
 /******************************************************************************
  * MODULAR VARIABLES
@@ -38,10 +40,49 @@ static bool dlModInit = false;
 
 static GPIO_TypeDef* sdPowerPort = NULL;
 static uint16_t sdPowerPin;
+static bool sdPowered = false;
+static uint32_t sdPowerTick;		/* Tick the card was powered up							*/
+
+static FIL logFil;					/* Day's log file, stays open while the card is powered	*/
+static bool logFilOpen = false;
+static char logFilePath[64];		/* File the buffered records belong to					*/
+static FSIZE_t logUsed;				/* End of the records, the file is reserved beyond it	*/
+static bool logUsedKnown = false;	/* Found by findLogEnd after a reset or a card change	*/
+static bool logFileRestart = false;	/* Card changed, the file record and names go out again	*/
+static uint16_t logSeed;			/* Block CRC preset of the file, from its header		*/
+static DWORD logClmt[DL_CLMT_SIZE];	/* Cluster link map of the reserved file				*/
+
+__ALIGN_BEGIN static uint8_t logBuf[DL_BUF_SIZE] __ALIGN_END;	/* Write-behind buffer, word aligned for the SDIO DMA	*/
+static uint16_t logBufLen = 0;
+static uint16_t logBufSplit = 0;	/* Tail of a block whose head is on the card already	*/
+static uint32_t logBufTick;			/* Tick of the oldest buffered record					*/
+static uint32_t lastRecordTick;
+static uint32_t lastSyncTick;
+
+static uint8_t block[DL_BLOCK_SIZE];	/* Block being filled, goes to logBuf with its CRC	*/
+static uint8_t blockLen = 0;		/* Payload bytes										*/
+static uint32_t blockLast;			/* Time of the last record in the block, s since midnight	*/
+
+static char nameTable[DL_NAME_COUNT][FILTER_NAME_LEN + 1];	/* String table of the file	*/
+static uint8_t nameCount = 0;
+static uint8_t lastSlots[FILTER_SECTION_SIZE];	/* Name indexes of the last filter record	*/
+static bool lastSlotsValid = false;
+static int16_t lastTemp;
+static bool lastTempValid = false;
+
+static bool writeFailed = false;	/* Only the first error of a run of failed writes is logged	*/
+static uint8_t pendingError = FR_OK;
+
+static DL_stats dlStats;
 
 /******************************************************************************
  * PRIVATE FUNCTIONS
  *******************************************************************************/
+static DL_error closeBlock(void);
+static void setWriteError(FRESULT fr);
+static void suspendLogger(bool truncate);
+static void closeLogFile(bool truncate);
+
 bool isLogDirValid(void) {
 	bool retVal = false;
 	DIR logDir;
@@ -58,14 +99,490 @@ bool isLogDirValid(void) {
 	return retVal;
 }
 
+// Power the card back up for a flush. Mounts without the f_mkfs fallback of FatFsInit,
+// a card that doesn't answer keeps its content and the records stay buffered.
+static DL_error resumeSDCard(void) {
+	if (sdPowered) {
+		return DATALOG_OK;
+	}
+
+	if (HAL_GPIO_ReadPin(SD_DETECT_GPIO_Port, SD_DETECT_Pin) == GPIO_PIN_SET) {
+		return DATALOG_ERR;
+	}
+
+	HAL_GPIO_WritePin(sdPowerPort, sdPowerPin, GPIO_PIN_SET);
+	HAL_Delay(5);
+	if (FatFsMount() != SD_OK) {
+		HAL_GPIO_WritePin(sdPowerPort, sdPowerPin, GPIO_PIN_RESET);
+		return DATALOG_ERR;
+	}
+
+	sdPowered = true;
+	sdPowerTick = HAL_GetTick();
+	dlStats.powerUps++;
+	return DATALOG_OK;
+}
+
+// Store the CRC of a whole block behind its payload
+static void sealBlock(uint8_t *blk) {
+	uint16_t crc = rfalCrcCalculateCcitt(logSeed, blk, DL_BLOCK_HEADER + blk[1]);
+
+	blk[DL_BLOCK_HEADER + blk[1]] = crc & 0xFF;
+	blk[DL_BLOCK_HEADER + blk[1] + 1] = crc >> 8;
+}
+
+static bool isBlock(const uint8_t *blk, UINT len) {
+	uint16_t crc;
+
+	if ((blk[0] != DL_BLOCK_SYNC) || (blk[1] > DL_BLOCK_PAYLOAD) || (DL_BLOCK_HEADER + blk[1] + 2 > len)) {
+		return false;
+	}
+	crc = rfalCrcCalculateCcitt(logSeed, blk, DL_BLOCK_HEADER + blk[1]);
+	return (blk[DL_BLOCK_HEADER + blk[1]] == (crc & 0xFF)) && (blk[DL_BLOCK_HEADER + blk[1] + 1] == (crc >> 8));
+}
+
+// A new file's seed. No RNG on the F411, the cycle counter of the moment it is drawn will do.
+static uint16_t newLogSeed(void) {
+	uint32_t entropy[2] = {DWT->CYCCNT, HAL_GetTick()};
+	uint16_t seed = rfalCrcCalculateCcitt(0xFFFF, (uint8_t *) entropy, sizeof(entropy));
+
+	return (seed == DL_LEGACY_SEED) ? (uint16_t) ~DL_LEGACY_SEED : seed;
+}
+
+/*	End of the records in a file that may hold reserved space from before a reset or a card
+ * removal. The seed comes from the header and the whole file is scanned: a damaged block is
+ * skipped, the records end behind the last good one. A file without a good block starts over,
+ * it gets a new seed and openLogFile writes its header.
+ * The buffered blocks are sealed with the seed, a block tail whose head was written before is lost.
+ * */
+static DL_error findLogEnd(void) {
+	uint8_t buf[DL_BLOCK_SIZE];
+	uint8_t *sync;
+	FSIZE_t pos = 0;
+	UINT br;
+
+	logSeed = DL_LEGACY_SEED;
+	logUsed = 0;
+	if (f_size(&logFil) >= DL_FILE_HEADER) {
+		if ((f_lseek(&logFil, 0) != FR_OK) ||
+				(f_read(&logFil, buf, DL_FILE_HEADER, &br) != FR_OK) || (br != DL_FILE_HEADER)) {
+			return DATALOG_ERR;
+		}
+		if ((memcmp(buf, DL_FILE_MAGIC, 3) == 0) &&
+				(rfalCrcCalculateCcitt(0xFFFF, buf, DL_FILE_HEADER - 2) == (buf[6] | (buf[7] << 8)))) {
+			logSeed = buf[4] | (buf[5] << 8);
+			pos = DL_FILE_HEADER;
+			logUsed = DL_FILE_HEADER;
+		}
+	}
+
+	while (pos + DL_BLOCK_HEADER + 2 <= f_size(&logFil)) {
+		if ((f_lseek(&logFil, pos) != FR_OK) || (f_read(&logFil, buf, DL_BLOCK_SIZE, &br) != FR_OK)) {
+			return DATALOG_ERR;
+		}
+		if (isBlock(buf, br)) {
+			pos += DL_BLOCK_HEADER + buf[1] + 2;
+			logUsed = pos;
+			continue;
+		}
+		// Damaged or not a block, the next sync byte may start one
+		sync = memchr(&buf[1], DL_BLOCK_SYNC, br - 1);
+		pos += (sync != NULL) ? (FSIZE_t) (sync - buf) : br;
+	}
+
+	if (logUsed == 0) {
+		logSeed = newLogSeed();
+	}
+	logUsedKnown = true;
+
+	if (logBufSplit > 0) {
+		dlStats.lost += logBufSplit;
+		memmove(logBuf, &logBuf[logBufSplit], logBufLen - logBufSplit);
+		logBufLen -= logBufSplit;
+		logBufSplit = 0;
+	}
+	for (uint16_t i = 0; i < logBufLen; i += DL_BLOCK_HEADER + logBuf[i + 1] + 2) {
+		sealBlock(&logBuf[i]);
+	}
+	return DATALOG_OK;
+}
+
+static DL_error writeLogHeader(void) {
+	uint8_t hdr[DL_FILE_HEADER];
+	uint16_t crc;
+	FRESULT fr;
+	UINT bw;
+
+	memcpy(hdr, DL_FILE_MAGIC, 3);
+	hdr[3] = DL_LOG_VERSION;
+	hdr[4] = logSeed & 0xFF;
+	hdr[5] = logSeed >> 8;
+	crc = rfalCrcCalculateCcitt(0xFFFF, hdr, DL_FILE_HEADER - 2);
+	hdr[6] = crc & 0xFF;
+	hdr[7] = crc >> 8;
+	fr = f_write(&logFil, hdr, DL_FILE_HEADER, &bw);
+	if ((fr != FR_OK) || (bw != DL_FILE_HEADER)) {
+		setWriteError((fr != FR_OK) ? fr : FR_DENIED);
+		return DATALOG_ERR;
+	}
+	logUsed = DL_FILE_HEADER;
+	return DATALOG_OK;
+}
+
+/*	Keep the file reserved up to at least end, in DL_PREALLOC_SIZE steps. A new file gets
+ * its space in one contiguous run from f_expand, a longer one is stretched with f_lseek.
+ * The link map then gives the sector of every offset, records stream into the reserved
+ * clusters without following or extending the FAT chain.
+ * */
+static DL_error reserveLogSpace(FSIZE_t end) {
+	FRESULT fr = FR_DENIED;
+	FSIZE_t size = f_size(&logFil);
+
+	// Only the FAT chain can be stretched
+	logFil.cltbl = NULL;
+
+	if (end > size) {
+		size = ((end + DL_PREALLOC_SIZE - 1) / DL_PREALLOC_SIZE) * DL_PREALLOC_SIZE;
+		if (f_size(&logFil) == 0) {
+			fr = f_expand(&logFil, size, 1);
+		}
+		if (fr != FR_OK) {
+			// No contiguous run left, or a file that already holds records
+			fr = f_lseek(&logFil, size);
+		}
+		if ((fr != FR_OK) || (f_size(&logFil) < end)) {
+			setWriteError((fr != FR_OK) ? fr : FR_DENIED);
+			return DATALOG_ERR;
+		}
+		dlStats.reserves++;
+	}
+
+	logClmt[0] = DL_CLMT_SIZE;
+	logFil.cltbl = logClmt;
+	if (f_lseek(&logFil, CREATE_LINKMAP) != FR_OK) {
+		// More fragments than the map holds, stay on the FAT chain
+		logFil.cltbl = NULL;
+	}
+
+	fr = f_lseek(&logFil, logUsed);
+	if (fr != FR_OK) {
+		setWriteError(fr);
+		return DATALOG_ERR;
+	}
+	return DATALOG_OK;
+}
+
+static DL_error openLogFile(void) {
+	FRESULT fr;
+
+	if (logFilOpen) {
+		return DATALOG_OK;
+	}
+
+	if (resumeSDCard() != DATALOG_OK) {
+		setWriteError(FR_NOT_READY);
+		return DATALOG_ERR;
+	}
+
+	// If the file exists, open it. Otherwise, create the log file.
+	fr = f_open(&logFil, (const TCHAR*) logFilePath, FA_OPEN_ALWAYS | FA_WRITE | FA_READ);
+	if (fr != FR_OK) {
+		setWriteError(fr);
+		return DATALOG_ERR;
+	}
+	logFilOpen = true;
+	dlStats.opens++;
+
+	if ((!logUsedKnown && (findLogEnd() != DATALOG_OK)) || (reserveLogSpace(logUsed + 1) != DATALOG_OK) ||
+			((logUsed == 0) && (writeLogHeader() != DATALOG_OK))) {
+		closeLogFile(false);
+		return DATALOG_ERR;
+	}
+	return DATALOG_OK;
+}
+
+// Truncating gives the reserved space back, the file ends with its last record
+static void closeLogFile(bool truncate) {
+	if (logFilOpen) {
+		logFil.cltbl = NULL;
+		if (truncate && (f_tell(&logFil) == logUsed) && (f_size(&logFil) > logUsed)) {
+			f_truncate(&logFil);
+		}
+		f_close(&logFil);
+		logFilOpen = false;
+		lastSyncTick = HAL_GetTick();
+		dlStats.syncs++;
+	}
+}
+
+/*	Write the buffer to the log file. Without all, only whole sectors are written: the first write
+ * after an open fills up the sector the file ends in, the rest go to the card sector by sector
+ * without the read-modify-write of a partial one. A failed write keeps the records for the next try.
+ * */
+static DL_error writeBuffered(bool all) {
+	FRESULT fr;
+	UINT bw;
+	uint16_t len;
+	uint16_t pos;
+
+	if (all) {
+		closeBlock();
+	}
+	len = logBufLen;
+
+	if (logBufLen == 0) {
+		return DATALOG_OK;
+	}
+
+	if (openLogFile() != DATALOG_OK) {
+		dlStats.errors++;
+		return DATALOG_ERR;
+	}
+
+	if (!all) {
+		uint16_t align = (DL_SECTOR_SIZE - (logUsed % DL_SECTOR_SIZE)) % DL_SECTOR_SIZE;
+
+		if (align > logBufLen) {
+			return DATALOG_OK;
+		}
+		len = align + ((logBufLen - align) / DL_SECTOR_SIZE) * DL_SECTOR_SIZE;
+		if (len == 0) {
+			return DATALOG_OK;
+		}
+	}
+
+	if ((logUsed + len > f_size(&logFil)) && (reserveLogSpace(logUsed + len) != DATALOG_OK)) {
+		dlStats.errors++;
+		closeLogFile(false);
+		stopSDCard();
+		return DATALOG_ERR;
+	}
+
+	fr = f_write(&logFil, logBuf, len, &bw);
+	if ((fr != FR_OK) || (bw != len)) {
+		// Leave the card alone until the next flush, the file is reopened then. The
+		// records go to the same place again.
+		setWriteError((fr != FR_OK) ? fr : FR_DENIED);
+		dlStats.errors++;
+		closeLogFile(false);
+		stopSDCard();
+		return DATALOG_ERR;
+	}
+	logUsed += len;
+
+	// The block the write ended in, its head is on the card now
+	pos = logBufSplit;
+	while (pos < len) {
+		pos += DL_BLOCK_HEADER + logBuf[pos + 1] + 2;
+	}
+	logBufSplit = pos - len;
+
+	memmove(logBuf, &logBuf[len], logBufLen - len);
+	logBufLen -= len;
+	writeFailed = false;
+	dlStats.flushes++;
+	dlStats.bytes += len;
+	return DATALOG_OK;
+}
+
+static void setWriteError(FRESULT fr) {
+	if (!writeFailed) {
+		writeFailed = true;
+		pendingError = fr;
+	}
+}
+
+static void syncLogFile(void) {
+	if (logFilOpen && (f_sync(&logFil) == FR_OK)) {
+		lastSyncTick = HAL_GetTick();
+		dlStats.syncs++;
+	}
+}
+
+
+// Move the block into the write buffer: header, payload, CRC
+static DL_error closeBlock(void) {
+	uint16_t len = DL_BLOCK_HEADER + blockLen + 2;
+
+	if (blockLen == 0) {
+		return DATALOG_OK;
+	}
+
+	if (logBufLen + len > DL_BUF_SIZE) {
+		writeBuffered(false);
+		if (logBufLen + len > DL_BUF_SIZE) {
+			return DATALOG_ERR;
+		}
+	}
+
+	block[0] = DL_BLOCK_SYNC;
+	block[1] = blockLen;
+	// Sealed again by findLogEnd when the file's seed isn't known yet
+	sealBlock(block);
+
+	memcpy(&logBuf[logBufLen], block, len);
+	logBufLen += len;
+	blockLen = 0;
+	dlStats.blocks++;
+	return DATALOG_OK;
+}
+
+/*	Add a record to the block. A full block, or a clock that went back, starts a new one.
+ * The record is dropped when the write buffer has no room for the full block.
+ * */
+static DL_error appendRecord(uint32_t seconds, DL_event event, const uint8_t *data, uint8_t len) {
+	uint8_t *rec;
+	uint32_t delta;
+
+	if ((blockLen > 0) && ((seconds < blockLast) || (blockLen + 1 + DL_DELTA_MAX + len > DL_BLOCK_PAYLOAD))) {
+		if (closeBlock() != DATALOG_OK) {
+			dlStats.dropped++;
+			return DATALOG_ERR;
+		}
+	}
+
+	if ((logBufLen == 0) && (blockLen == 0)) {
+		logBufTick = HAL_GetTick();
+	}
+
+	if (blockLen == 0) {
+		block[2] = seconds & 0xFF;
+		block[3] = (seconds >> 8) & 0xFF;
+		block[4] = (seconds >> 16) & 0xFF;
+		blockLast = seconds;
+	}
+
+	rec = &block[DL_BLOCK_HEADER + blockLen];
+	*rec++ = event;
+	delta = seconds - blockLast;
+	do {
+		*rec = delta & 0x7F;
+		delta >>= 7;
+		if (delta > 0) {
+			*rec |= 0x80;
+		}
+		rec++;
+	} while (delta > 0);
+	memcpy(rec, data, len);
+	rec += len;
+
+	blockLen = rec - &block[DL_BLOCK_HEADER];
+	blockLast = seconds;
+	lastRecordTick = HAL_GetTick();
+	dlStats.records++;
+	return DATALOG_OK;
+}
+
+static uint32_t secondsOfDay(const datetime_record_t *dt) {
+	return dt->hours * 3600UL + dt->minutes * 60UL + dt->seconds;
+}
+
+static void getDateTime(datetime_record_t *dt) {
+	RTC_DateTypeDef dateStamp;
+	RTC_TimeTypeDef timeStamp;
+
+	rtcGetDateTime(&dateStamp, &timeStamp);
+
+	dt->month = dateStamp.Month;
+	dt->day = dateStamp.Date;
+	dt->year = dateStamp.Year + 2000;
+
+	dt->hours = timeStamp.Hours;
+	dt->minutes = timeStamp.Minutes;
+	dt->seconds = timeStamp.Seconds;
+}
+
+/*	Records go to the file of their day. A new file starts with a DL_EVT_FILE record and an empty
+ * string table. It is also written after a reset and after a card change, the file may be new
+ * on this card. The exporter takes the names defined last.
+ * */
+static DL_error selectLogFile(const datetime_record_t *dt, const char *boxID) {
+	char path[64];
+	uint8_t rec[6 + 9];
+	uint8_t idLen = strnlen(boxID, 9);
+
+	// File Name Format: FilterLog_Date_Matte Box ID
+	// Example: FilterLog_01-01-2020_LBSA0100P
+	sprintf(path, DL_LOG_DIR_PATH "/FilterLog_%02d-%02d-%d_%.9s.lwl", dt->month, dt->day, dt->year, boxID);
+	if (strcmp(path, logFilePath) != 0) {
+		// The buffered records still belong to the old file. When they can't be written they
+		// are given up, kept they would be flushed into the new day's file.
+		if (writeBuffered(true) != DATALOG_OK) {
+			dlStats.lost += logBufLen + blockLen;
+			logBufLen = 0;
+			logBufSplit = 0;
+			blockLen = 0;
+		}
+		closeLogFile(true);
+
+		strcpy(logFilePath, path);
+		logUsedKnown = false;
+	} else if (!logFileRestart) {
+		return DATALOG_OK;
+	}
+
+	logFileRestart = false;
+	nameCount = 0;
+	lastSlotsValid = false;
+	lastTempValid = false;
+
+	rec[0] = DL_LOG_VERSION;
+	rec[1] = dt->year & 0xFF;
+	rec[2] = dt->year >> 8;
+	rec[3] = dt->month;
+	rec[4] = dt->day;
+	rec[5] = idLen;
+	memcpy(&rec[6], boxID, idLen);
+	return appendRecord(secondsOfDay(dt), DL_EVT_FILE, rec, 6 + idLen);
+}
+
+// String table index of a name, sends a DL_EVT_NAME record the first time it shows up in the file
+static uint8_t nameIndex(uint32_t seconds, const char *name) {
+	uint8_t rec[2 + FILTER_NAME_LEN];
+	uint8_t len = strnlen(name, FILTER_NAME_LEN);
+
+	if (len == 0) {
+		return DL_NO_NAME;
+	}
+
+	for (uint8_t i = 0; i < nameCount; i++) {
+		if ((strncmp(nameTable[i], name, FILTER_NAME_LEN) == 0) && (nameTable[i][len] == '\0')) {
+			return i;
+		}
+	}
+
+	rec[0] = nameCount;
+	rec[1] = len;
+	memcpy(&rec[2], name, len);
+	if (appendRecord(seconds, DL_EVT_NAME, rec, 2 + len) != DATALOG_OK) {
+		return DL_NO_NAME;
+	}
+
+	memcpy(nameTable[nameCount], name, len);
+	nameTable[nameCount][len] = '\0';
+	return nameCount++;
+}
+
+static DL_error logEvent(DL_event event, const uint8_t *data, uint8_t len) {
+	datetime_record_t dt;
+
+	if (!dlModInit) {
+		return DATALOG_ERR;
+	}
+
+	getDateTime(&dt);
+	if (selectLogFile(&dt, MATTE_BOX_HW_ID) != DATALOG_OK) {
+		return DATALOG_ERR;
+	}
+	return appendRecord(secondsOfDay(&dt), event, data, len);
+}
+
 
 /********************************************************************************
  * PUBLIC FUNCTIONS
  *******************************************************************************/
 
 DL_error dataLoggerInit(GPIO_TypeDef* sd_Port, uint16_t sd_Pin) {
-	DL_error retVal = DATALOG_ERR;
-
 	// Check RTC. Initialize if needed.
 	if (!rtcModuleIsInit()) {
 		rtcModuleInit(&hrtc);
@@ -77,34 +594,40 @@ DL_error dataLoggerInit(GPIO_TypeDef* sd_Port, uint16_t sd_Pin) {
 		sdPowerPin = sd_Pin;
 	}
 
+	// A card swapped while powered
+	stopSDCard();
+
 	if (startSDCard() != DATALOG_OK) {
 		return DATALOG_ERR;
 	}
 
 	// Verify that FatFs is initialized
-	if (FatFsIsModuleInit()) {
-		if (!isLogDirValid()) {
-			// Create the new directory and file
-			FRESULT fr;
-			fr = f_mkdir(DL_LOG_DIR_PATH);
-			if (fr == FR_OK) {
-				// The directory was created successfully
-				retVal = DATALOG_OK;
-			} else {
-				// FatFs Error
-				return retVal;
-			}
-		}
-	} else {
+	if (!FatFsIsModuleInit()) {
 		// FatFs Not Initialized
-		return retVal;
+		return DATALOG_ERR;
 	}
 
+	if (!isLogDirValid()) {
+		// Create the new directory
+		if (f_mkdir(DL_LOG_DIR_PATH) != FR_OK) {
+			// FatFs Error
+			return DATALOG_ERR;
+		}
+	}
+
+	// The card powers down once the logger went idle. The end of the open file
+	// is looked up again, this may be another card. Its file may lack the names.
+	logUsedKnown = false;
+	logFileRestart = true;
+	lastRecordTick = HAL_GetTick();
 	dlModInit = true;
-	return retVal;
+	return DATALOG_OK;
 }
 
 DL_error dataLoggerDeInit(void) {
+	// The card may still answer right after the detect switch opened. Records that
+	// can't be written stay buffered for the next card.
+	dataLoggerSync();
 	dlModInit = false;
 	return stopSDCard();
 }
@@ -123,148 +646,307 @@ DL_error startSDCard(void) {
 	// If there is a problem with the FatFs, turn off the power.
 	if (ret != DATALOG_OK) {
 		HAL_GPIO_WritePin(sdPowerPort, sdPowerPin, GPIO_PIN_RESET);
+	} else {
+		sdPowered = true;
+		sdPowerTick = HAL_GetTick();
+		dlStats.powerUps++;
 	}
 	return ret;
 }
 
 DL_error stopSDCard(void) {
+	// An open file is left behind, the FIL dies with the mount
+	logFilOpen = false;
+
+	if (sdPowered) {
+		dlStats.poweredMs += HAL_GetTick() - sdPowerTick;
+		sdPowered = false;
+	}
+
 	// Unlink the FatFs and turn off the SD Card
-	DL_error ret = FatFsDeInit();
+	DL_error ret = DATALOG_OK;
+	if (FatFsIsModuleInit()) {
+		ret = FatFsDeInit();
+	}
 	HAL_GPIO_WritePin(sdPowerPort, sdPowerPin, GPIO_PIN_RESET);
 	return ret;
 }
 
 /*	This function get's called from the FilterMachine whenever there's
  * a filter change. It first fills out a Log Record, then sends it to
- * this function to be copied to the SD Card.
+ * this function to be queued for the SD Card as a DL_EVT_FILTERS record.
+ * The card is written from dataLoggerProcess.
  * */
 
 DL_error logDataToSD(sdLog_record_t *sdLog) {
+	uint32_t seconds = secondsOfDay(&sdLog->dateTimeStamp);
+	uint8_t slots[FILTER_SECTION_SIZE];
+	uint8_t rec[1 + FILTER_SECTION_SIZE];
+	uint8_t len = 1;
+	uint8_t newNames = 0;
 
 	// Ensure the modules are initialized
-	if (dlModInit) {
+	if (!dlModInit) {
+		return DATALOG_ERR;
+	}
 
-		// Verify that the directory has been initialized
-		if (!isLogDirValid()) {
-			return DATALOG_ERR;
-		}
+	if (selectLogFile(&sdLog->dateTimeStamp, sdLog->matteBoxID) != DATALOG_OK) {
+		return DATALOG_ERR;
+	}
 
-		// The log directory is valid. Start organizing the data.
-		// Convert all non-string fields
-		char dateStamp_s[11] = {0};
-		char logFileName_s[35] = {0};
-		char timeStamp_s[11] = {0};
-
-		// Compile the Date
-		sprintf(dateStamp_s, "%02d-%02d-%d",
-				sdLog->dateTimeStamp.month,
-				sdLog->dateTimeStamp.day,
-				sdLog->dateTimeStamp.year);
-
-		// File Name Format: FilterLog_Date_Matte Box ID
-		// Example: FilterLog_01-01-2020_LBSA0100P
-		sprintf(logFileName_s, "FilterLog_%s_%s.csv",
-				dateStamp_s,
-				sdLog->matteBoxID);
-
-		// Compile the time
-		sprintf(timeStamp_s, "%02d:%02d:%02d,",
-				sdLog->dateTimeStamp.hours,
-				sdLog->dateTimeStamp.minutes,
-				sdLog->dateTimeStamp.seconds);
-
-		// Prepare to write the file
-		FRESULT fr;
-		FIL* logFil = malloc(sizeof(FIL));
-
-		// Change to the directory
-		fr = f_chdir(DL_LOG_DIR_PATH);
-		// If the file exists, open it. Otherwise, create the log file.
-		fr = f_open(logFil, (const TCHAR*) logFileName_s, FA_OPEN_APPEND | FA_WRITE);
+	// Start the string table over before it runs out, not in the middle of a record
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
+		if (sdLog->filterNames[i].filterName[0] == '\0') {
+			continue;
+		}
+		newNames++;
+		for (uint8_t j = 0; j < nameCount; j++) {
+			if (strncmp(nameTable[j], sdLog->filterNames[i].filterName, FILTER_NAME_LEN) == 0) {
+				newNames--;
+				break;
+			}
+		}
+	}
+	if (nameCount + newNames > DL_NAME_COUNT) {
+		nameCount = 0;
+		lastSlotsValid = false;
+	}
 
-		if (fr != FR_OK) {
-			// Can't open the file
-			return DATALOG_ERR;
+	// Only the slots that changed since the last record, every slot in the first one of a file
+	rec[0] = 0;
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
+		slots[i] = nameIndex(seconds, sdLog->filterNames[i].filterName);
+		if (!lastSlotsValid || (slots[i] != lastSlots[i])) {
+			rec[0] |= 1 << i;
+			rec[len++] = slots[i];
 		}
+	}
 
-		// The file is open and ready. Write the fields to the file.
-		// Check to see if the file is empty
-		if (logFil->fptr == 0){
-			// Brand New File. Make the Headers
-			char headers[100] = {0};
+	if (appendRecord(seconds, DL_EVT_FILTERS, rec, len) != DATALOG_OK) {
+		return DATALOG_ERR;
+	}
+	memcpy(lastSlots, slots, sizeof(lastSlots));
+	lastSlotsValid = true;
+	return DATALOG_OK;
+}
 
-			sprintf(headers, "Light Widow Matte Box\nMatte Box ID:,%s\nDate:,%s\nNotes:\n\n",
-					sdLog->matteBoxID,
-					dateStamp_s);
-			const char tmpStr[50] = "Time,Filter Slot 1,Filter Slot 2,Filter Slot 3\n";
+DL_error dataLogBattery(uint8_t soc, uint16_t voltage) {
+	uint8_t rec[3] = {soc, voltage & 0xFF, voltage >> 8};
 
-			f_puts(headers, (FIL*) logFil);
-			f_puts(tmpStr, (FIL*) logFil);
+	return logEvent(DL_EVT_BATTERY, rec, sizeof(rec));
+}
+
+DL_error dataLogTemperature(int16_t temp) {
+	uint8_t rec[2] = {(uint16_t) temp & 0xFF, (uint16_t) temp >> 8};
+
+	if (logEvent(DL_EVT_TEMPERATURE, rec, sizeof(rec)) != DATALOG_OK) {
+		return DATALOG_ERR;
+	}
+	lastTemp = temp;
+	lastTempValid = true;
+	return DATALOG_OK;
+}
+
+DL_error dataLogError(DL_source source, uint8_t code) {
+	uint8_t rec[2] = {source, code};
+
+	return logEvent(DL_EVT_ERROR, rec, sizeof(rec));
+}
+
+/*	Flush policy. Whole sectors are written as soon as they fill up, the rest after
+ * DL_FLUSH_AGE_MS. Once no record came in for DL_FLUSH_IDLE_MS everything is written,
+ * the file is closed and the card is powered down until the next flush.
+ * */
+void dataLoggerProcess(void) {
+	uint32_t now = HAL_GetTick();
+
+	if (!dlModInit) {
+		return;
+	}
+
+	// Written with the records that made it, or once the card is back
+	if (pendingError != FR_OK) {
+		dataLogError(DL_SRC_LOGGER, pendingError);
+		pendingError = FR_OK;
+	}
+
+	if (logBufLen >= DL_SECTOR_SIZE) {
+		if ((writeBuffered(false) == DATALOG_OK) && (now - lastSyncTick >= DL_SYNC_MS)) {
+			syncLogFile();
+		}
+	}
+
+	if ((logBufLen + blockLen > 0) && (now - logBufTick >= DL_FLUSH_AGE_MS)) {
+		if (writeBuffered(true) == DATALOG_OK) {
+			syncLogFile();
+		} else {
+			// Retry after another period instead of every loop
+			logBufTick = now;
+		}
+	}
+
+	if ((sdPowered || (logBufLen + blockLen > 0)) && (now - lastRecordTick >= DL_FLUSH_IDLE_MS)) {
+		// The reserved space stays with the file for the next records of the day
+		if (writeBuffered(true) != DATALOG_OK) {
+			// No card to take the records, retry after another idle period
+			lastRecordTick = now;
 		}
+		suspendLogger(false);
+	}
+}
+
+DL_error dataLoggerSync(void) {
+	DL_error ret = writeBuffered(true);
+
+	suspendLogger(true);
+	return ret;
+}
+
+static void suspendLogger(bool truncate) {
+	closeLogFile(truncate);
+	if (sdPowered) {
+		stopSDCard();
+	}
+}
+
+void dataLoggerGetStats(DL_stats *stats) {
+	*stats = dlStats;
+	stats->buffered = logBufLen + blockLen;
+	if (sdPowered) {
+		stats->poweredMs += HAL_GetTick() - sdPowerTick;
+	}
+}
 
-		// Write the Time Stamp
-		f_puts(timeStamp_s, (FIL*) logFil);
+/*	Sequential throughput of the card in the logger's flush size. A contiguous file is written and
+ * read back DL_BUF_SIZE at a time from the write buffer, so the buffered records go to the card first.
+ * The cycles the SD driver waited are the ones the main loop gets back through SD_WaitCallback.
+ * */
+DL_error dataLoggerBenchmark(uint32_t kbytes, DL_bench *bench) {
+	uint32_t *words = (uint32_t *) logBuf;
+	uint32_t pieces = (kbytes * 1024U) / DL_BUF_SIZE;
+	bool powered = sdPowered;
+	DL_bench_step step = DL_BENCH_OPEN;
+	SD_stats before, after;
+	uint32_t start, tick;
+	FRESULT fr;
+	UINT bw;
+
+	memset(bench, 0, sizeof(DL_bench));
+
+	if (!dlModInit || (pieces == 0) || (kbytes > DL_BENCH_MAX_KB)) {
+		bench->step = DL_BENCH_NOT_READY;
+		return DATALOG_ERR;
+	}
 
-		// Write the Filter Name in Slot 1
-		f_puts(sdLog->filterNames[0].filterName, (FIL*) logFil);
-		f_puts(DL_DELIM, (FIL*) logFil);
+	if (HAL_GPIO_ReadPin(SD_DETECT_GPIO_Port, SD_DETECT_Pin) == GPIO_PIN_SET) {
+		bench->step = DL_BENCH_NO_CARD;
+		return DATALOG_ERR;
+	}
 
-		// Write the Filter Name in Slot 2
-		f_puts(sdLog->filterNames[1].filterName, (FIL*) logFil);
-		f_puts(DL_DELIM, (FIL*) logFil);
+	if ((writeBuffered(true) != DATALOG_OK) || (logBufLen > 0)) {
+		bench->step = DL_BENCH_FLUSH;
+		return DATALOG_ERR;
+	}
 
-		// Write the Filter Name in Slot 3
-		f_puts(sdLog->filterNames[2].filterName, (FIL*) logFil);
+	if (resumeSDCard() != DATALOG_OK) {
+		bench->step = DL_BENCH_MOUNT;
+		return DATALOG_ERR;
+	}
 
-		// Make a new line
-		f_puts(DL_ENDL, (FIL*) logFil);
+	fr = f_open(&SDFile, DL_BENCH_PATH, FA_CREATE_ALWAYS | FA_WRITE | FA_READ);
+	if (fr == FR_OK) {
+		// Contiguous like the reserved log. A fragmented card still gets measured, with the FAT walks.
+		f_expand(&SDFile, pieces * DL_BUF_SIZE, 1);
 
-		// Finish and Close the file
-		fr = f_close((FIL*) logFil);
+		for (uint16_t i = 0; i < DL_BUF_SIZE / 4; i++) {
+			words[i] = 0xA5000000U | i;
+		}
 
-		// De-allocate the FatFs
-		free(logFil);
+		step = DL_BENCH_WRITE;
+		SD_GetStats(&before);
+		tick = HAL_GetTick();
+		start = DWT->CYCCNT;
+		for (uint32_t i = 0; (i < pieces) && (fr == FR_OK); i++) {
+			words[0] = i;
+			fr = f_write(&SDFile, logBuf, DL_BUF_SIZE, &bw);
+			if ((fr == FR_OK) && (bw != DL_BUF_SIZE)) {
+				fr = FR_DENIED;
+			}
+		}
+		if (fr == FR_OK) {
+			fr = f_sync(&SDFile);
+		}
+		bench->writeCycles = DWT->CYCCNT - start;
+		bench->writeMs = HAL_GetTick() - tick;
+		SD_GetStats(&after);
+		bench->writeWaitCycles = after.waitCycles - before.waitCycles;
+		bench->scratch = after.scratch - before.scratch;
 
 		if (fr == FR_OK) {
-			// The file closed successfully
-			return DATALOG_OK;
+			step = DL_BENCH_READ;
+			fr = f_lseek(&SDFile, 0);
+		}
+
+		before = after;
+		tick = HAL_GetTick();
+		start = DWT->CYCCNT;
+		for (uint32_t i = 0; (i < pieces) && (fr == FR_OK); i++) {
+			fr = f_read(&SDFile, logBuf, DL_BUF_SIZE, &bw);
+			// The piece number and the last word are enough to catch a misplaced or short sector
+			if ((fr == FR_OK) && ((bw != DL_BUF_SIZE) || (words[0] != i) || (words[DL_BUF_SIZE / 4 - 1] != (0xA5000000U | (DL_BUF_SIZE / 4 - 1))))) {
+				bench->mismatches++;
+			}
 		}
+		bench->readCycles = DWT->CYCCNT - start;
+		bench->readMs = HAL_GetTick() - tick;
+		SD_GetStats(&after);
+		bench->readWaitCycles = after.waitCycles - before.waitCycles;
+		bench->scratch += after.scratch - before.scratch;
+
+		f_close(&SDFile);
+		f_unlink(DL_BENCH_PATH);
+		bench->bytes = pieces * DL_BUF_SIZE;
+	}
+
+	if (!powered) {
+		suspendLogger(false);
 	}
-	return DATALOG_ERR;
+
+	if ((fr != FR_OK) || (bench->mismatches > 0)) {
+		bench->step = step;
+		bench->fr = fr;
+		return DATALOG_ERR;
+	}
+	return DATALOG_OK;
 }
 
 DL_error SDDataLog(filterSection_t *fSection) {
-	RTC_DateTypeDef dateStamp;
-	RTC_TimeTypeDef timeStamp;
 	sdLog_record_t sdLog = {0};
+	DL_error ret;
+	int16_t temp;
 
 	if (!dlModInit) {
 		return DATALOG_ERR;
 	}
 
-	// See if FATFS and SD Card are ready
-
-
 	strcpy(sdLog.matteBoxID, MATTE_BOX_HW_ID);
 
 	// Get the Time and Store it
-	rtcGetDateTime(&dateStamp, &timeStamp);
-
-	// Load the DateTime results into the DataLog structure
-	sdLog.dateTimeStamp.month = dateStamp.Month;
-	sdLog.dateTimeStamp.day = dateStamp.Date;
-	sdLog.dateTimeStamp.year = dateStamp.Year + 2000;
-
-	sdLog.dateTimeStamp.hours = timeStamp.Hours;
-	sdLog.dateTimeStamp.minutes = timeStamp.Minutes;
-	sdLog.dateTimeStamp.seconds = timeStamp.Seconds;
+	getDateTime(&sdLog.dateTimeStamp);
 
 	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
 		strcpy(&sdLog.filterNames[i].filterName, fSection->filter[i].filterName);
 	}
 
 	// Log to the SD Card
-	return logDataToSD(&sdLog);
+	ret = logDataToSD(&sdLog);
+
+	// The temperature goes along when it moved since the last record
+	if ((LM75B_GetCachedTemp(&temp, DL_TEMP_MAX_AGE_MS) == LM75B_OK) &&
+			(!lastTempValid || (temp - lastTemp >= DL_TEMP_STEP) || (lastTemp - temp >= DL_TEMP_STEP))) {
+		dataLogTemperature(temp);
+	}
+	return ret;
 }
 
 DL_error dataLogTest(void) {
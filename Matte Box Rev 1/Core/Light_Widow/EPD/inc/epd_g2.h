@@ -19,6 +19,22 @@
 #define EPD_IMAGE_ONE_ARG     0
 #define EPD_IMAGE_TWO_ARG     1
 #define EPD_PARTIAL_AVAILABLE 1
+#ifndef EPD_PIXEL_LUT
+#define EPD_PIXEL_LUT         1  // line encoder uses the tables in epd_g2_lut.c (Tools/epd_lut_gen.py)
+#endif
+
+// EPD_begin reuses an LM75B reading for this long (ms)
+#define EPD_TEMPERATURE_MAX_AGE  60000
+
+// EPD_start_update leaves the COG powered this long (ms) after an update, the next one
+// skips the power up. 0 = power down after every update.
+// The panel sits at drive voltage while held, keep it below EPD_COG_HOLD_MAX_MS
+#define EPD_COG_HOLD_MS       3000
+#define EPD_COG_HOLD_MAX_MS   10000
+
+#if EPD_COG_HOLD_MS > EPD_COG_HOLD_MAX_MS
+#error "EPD_COG_HOLD_MS is longer than the COG may be held"
+#endif
 
 // display panels supported
 #define EPD_1_44_SUPPORT      1
@@ -27,6 +43,42 @@
 #define EPD_2_6_SUPPORT       1
 #define EPD_2_7_SUPPORT       1
 
+// panel geometry, dots per line x lines. EPD_PANEL_DOTS(EPD_2_0) works in #if as well
+#define EPD_1_44_DOTS         128
+#define EPD_1_44_LINES        96
+#define EPD_1_9_DOTS          144
+#define EPD_1_9_LINES         128
+#define EPD_2_0_DOTS          200
+#define EPD_2_0_LINES         96
+#define EPD_2_6_DOTS          232
+#define EPD_2_6_LINES         128
+#define EPD_2_7_DOTS          264
+#define EPD_2_7_LINES         176
+
+#define EPD_PANEL_DOTS(size)   EPD_PANEL_DOTS_(size)
+#define EPD_PANEL_DOTS_(size)  size##_DOTS
+#define EPD_PANEL_LINES(size)  EPD_PANEL_LINES_(size)
+#define EPD_PANEL_LINES_(size) size##_LINES
+
+// largest panel, sizes the per line bitmaps and the line buffers
+#define EPD_MAX_LINES         EPD_2_7_LINES
+#define EPD_MAX_DOTS          EPD_2_7_DOTS
+#define EPD_LINE_MAP_SIZE     ((EPD_MAX_LINES + 7) / 8)
+
+// one frame line: data bytes (two per byte for all_pixels), scan bytes, command,
+// pre_border and border byte. Both scan layouts come out at lines / 4 scan bytes
+#define EPD_LINE_BUFFER_SIZE  (2 * (EPD_MAX_DOTS / 8) + EPD_MAX_LINES / 4 + 3)
+
+// CS stays high this long (us) after every transfer
+#define EPD_CS_GUARD_US       10
+
+// refresh cost model of EPD_estimate, check it against the epdSpi CLI command
+#define EPD_COST_TRANSFER_US  3    // HAL call and CS handling per transfer, without the guard
+#define EPD_COST_POWER_UP_MS  355  // waits of the power up sequence, one charge pump try
+
+// repeat frames of a stage timed one by one, later ones add to the last
+#define EPD_STATS_FRAMES      8
+
 // values for border byte
 #define BORDER_BYTE_BLACK 0xff
 #define BORDER_BYTE_WHITE 0xaa
@@ -55,6 +107,66 @@ typedef enum {
 	EPD_BORDER_BYTE_SET,   // border byte needs to be set
 } EPD_border_byte;
 
+typedef enum {           // what an update drives, see update_plans in epd_g2.c
+	EPD_UPDATE_NONE,       // power up/down only
+	EPD_UPDATE_CLEAR,      // anything -> white
+	EPD_UPDATE_IMAGE_0,    // white -> new image
+	EPD_UPDATE_IMAGE,      // old image -> new image
+	EPD_UPDATE_PARTIAL     // old image -> new image, changed pixels of the line_map lines only
+} EPD_update;
+
+typedef enum {           // steps of the update sequence, EPD_process runs one per call
+	EPD_STEP_IDLE,
+	EPD_STEP_POWER_ON,     // power up: all pins low
+	EPD_STEP_PANEL_ON,     //   panel power
+	EPD_STEP_RESET_HIGH,   //   reset pulse
+	EPD_STEP_RESET_LOW,
+	EPD_STEP_RESET_DONE,
+	EPD_STEP_COG_SETUP,    //   wait for busy, COG ID, panel check and setup
+	EPD_STEP_PUMP_POS,     //   charge pumps, up to 4 tries
+	EPD_STEP_PUMP_NEG,
+	EPD_STEP_PUMP_VCOM,
+	EPD_STEP_DC_CHECK,
+	EPD_STEP_STAGE,        // one frame of the current stage
+	EPD_STEP_HOLD,         // COG held: nothing frame and dummy line, no row left driven
+	EPD_STEP_NOTHING,      // power down: nothing frame and border
+	EPD_STEP_LATCH_RESET,  //   charge pumps off
+	EPD_STEP_DISCHARGE,    //   internal discharge, oscillator off
+	EPD_STEP_POWER_OFF,    //   panel power off, external discharge
+	EPD_STEP_DISCHARGE_END
+} EPD_step;
+
+typedef struct {         // SPI traffic, see EPD_get_spi_stats
+	uint32_t bytes;        // commands and line buffers
+	uint32_t transactions; // CS low periods
+	uint32_t cs_toggles;   // CS edges
+	uint32_t guards;       // EPD_CS_GUARD_US waits after CS high
+	uint32_t guard_cycles; // DWT cycles spent in them
+	uint32_t wait_cycles;  // DWT cycles blocked on the SPI, blocking transfers and DMA tails of lines
+} EPD_spi_counters;
+
+typedef struct {
+	EPD_spi_counters power;                      // power up and down steps of the update
+	EPD_spi_counters stage[4];                   // compensate, white, inverse, normal
+	uint32_t frame_cycles[4][EPD_STATS_FRAMES];  // DWT cycles of each repeat frame of a stage
+	uint16_t frames[4];                          // repeat frames of each stage
+	uint16_t lines_changed;
+	int16_t temperature;                         // 1/8 deg C, at the first frame
+	uint16_t stage_time;                         // ms, factored_stage_time at the first frame
+	uint32_t update_ms;                          // first frame to the end of the last stage
+} EPD_spi_stats;
+
+typedef struct {         // EPD_estimate, one update
+	uint32_t total_ms;     // power up and stages
+	uint16_t power_up_ms;  // 0 while the COG is on
+	uint16_t stage_ms;     // factored stage time at the temperature
+	uint8_t stages;
+	uint16_t frames;       // per stage, a stage ends after the frame that runs past stage_ms
+	uint32_t frame_us;     // one frame of the lines driven
+	uint32_t bytes;        // sent by the stages
+	uint32_t guard_us;     // time of the stages in CS guards
+} EPD_cost;
+
 typedef struct __EPD_HandleTypeDef {
 	EPD_error			status;					/*!< EPD Status					              */
 
@@ -79,6 +191,7 @@ typedef struct __EPD_HandleTypeDef {
 
 	uint16_t base_stage_time;
 	uint16_t factored_stage_time;
+	int16_t temperature;						/*!< Temperature of factored_stage_time, 1/8 deg C	      */
 	uint16_t lines_per_display;
 	uint16_t dots_per_line;
 	uint16_t bytes_per_line;
@@ -92,10 +205,35 @@ typedef struct __EPD_HandleTypeDef {
 	const uint8_t *channel_select;
 	size_t channel_select_length;
 
-	uint8_t *line_buffer;
+	uint8_t *line_buffer;						/*!< Two line buffers, one fills while DMA sends the other,  */
+												/*!< static, EPD_LINE_BUFFER_SIZE each	                   */
 	size_t line_buffer_size;
+	uint8_t line_buffer_index;					/*!< Buffer the next line is built in				      */
+	bool line_pending;							/*!< A line is on its way out, output not yet latched	  */
 
 	bool COG_on;
+	bool COG_held;								/*!< Left on by EPD_start_update, powers down on timeout  */
+	uint32_t COG_idle_start;					/*!< Tick the held COG went idle					      */
+
+	uint16_t lines_changed;						/*!< Lines driven by the last update		              */
+	uint32_t lines_sent;						/*!< one_line calls of the last update, all repeats	      */
+	uint16_t iterations[4];						/*!< Frames per stage of the last update: compensate,     */
+												/*!< white, inverse, normal						          */
+
+	EPD_step step;								/*!< Next step of the running update, IDLE = none        */
+	uint32_t wait_start;						/*!< Tick the wait before the next step started          */
+	uint16_t wait_ticks;						/*!< Length of that wait, 0 = run the step right away     */
+	uint8_t dc_tries;							/*!< Charge pump tries of this power up		              */
+	bool power_down;							/*!< Power the COG down after the stages		          */
+
+	EPD_update update;							/*!< Update being driven and its frames		              */
+	const uint8_t *old_image;
+	const uint8_t *new_image;
+	uint8_t line_map[EPD_LINE_MAP_SIZE];
+	uint8_t stage;								/*!< Current stage, its frames so far and start tick      */
+	uint16_t stage_frames;
+	uint32_t stage_start;
+	uint32_t frames_start;						/*!< Tick the first frame of the update was sent          */
 } EPD_HandleTypeDef;
 
 
@@ -105,23 +243,38 @@ typedef struct __EPD_HandleTypeDef {
 // Initialize Function
 void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd);
 
-// set the temperature compensation (call before begin)
+// set the temperature compensation. EPD_begin sets it from the LM75B, the
+// value given here is kept when the sensor can't be read
 void EPD_set_temperature(EPD_HandleTypeDef *epd, int temperature);
 
-// external temperature enable
-void EPD_set_enable_temperature(void);
+// same in 1/8 deg C steps, the LM75B resolution
+void EPD_set_temperature_fine(EPD_HandleTypeDef *epd, int16_t temperature);
 
 // set factored_stage_time directly ('F' command)
 	//void EPD_set_factored_stage_time(EPD_type *epd, int pu_stagetime);
 
-// sequence start/end
+// sequence start/end, blocking
 void EPD_begin(EPD_HandleTypeDef *epd);
 void EPD_end(EPD_HandleTypeDef *epd);
 
 // ok/error status
 EPD_error EPD_status(EPD_HandleTypeDef *epd);
 
-// items below must be bracketed by begin/end
+// non-blocking update: power up, stages and power down are stepped by EPD_process.
+// The images must stay unchanged until it is done, line_map is copied (EPD_UPDATE_PARTIAL only).
+// A partial update of identical images is done right away. Returns false while another update is running.
+bool EPD_start_update(EPD_HandleTypeDef *epd, EPD_update update, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map);
+
+// runs the next step of the update when its wait is over, call it from the main loop.
+// A stage sends one frame per call. A held COG is powered down here once
+// EPD_COG_HOLD_MS have passed. Returns true while an update or the power down is running.
+bool EPD_process(EPD_HandleTypeDef *epd);
+bool EPD_busy(EPD_HandleTypeDef *epd);
+
+// powers a held COG down right away, blocking
+void EPD_release(EPD_HandleTypeDef *epd);
+
+// items below block and must be bracketed by begin/end
 // ==========================================
 
 // clear the screen
@@ -136,5 +289,26 @@ void EPD_image(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *
 // change from old image to new image only updating changed pixels
 void EPD_partial_image(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image);
 
+// as EPD_partial_image, only the lines set in line_map (bit n = line n) are driven
+void EPD_partial_lines(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map);
+
+// set a bit in line_map for every line that differs between the images, returns the number of lines
+uint16_t EPD_changed_lines(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image, uint8_t *line_map);
+
+
+// statistics
+// ==========
+
+// SPI traffic of the last update of each kind, EPD_UPDATE_NONE holds the last power
+// sequence without an update (EPD_begin, EPD_end, a held COG timing out)
+void EPD_get_spi_stats(EPD_update update, EPD_spi_stats *stats);
+
+// kind of the last update that sent frames
+EPD_update EPD_last_update(void);
+
+// predicted time of an update driving lines lines (EPD_UPDATE_PARTIAL, the others drive
+// all of them) at temperature (1/8 deg C), from the SPI clock and the stage times
+void EPD_estimate(EPD_HandleTypeDef *epd, EPD_update update, uint16_t lines, int16_t temperature, EPD_cost *cost);
+
 
 #endif  /* EPD_H */
@@ -0,0 +1,28 @@
+/*
+ * epd_g2_lut.h
+ *
+ *  Pixel transform tables of the G2 line encoder, generated by Tools/epd_lut_gen.py
+ */
+
+#ifndef EPD_G2_LUT_H
+#define EPD_G2_LUT_H
+
+#include <stdint.h>
+
+#include "epd_g2.h"
+
+#if EPD_PIXEL_LUT
+
+// [stage][data byte] -> bytes sent to the panel
+extern const uint8_t epd_lut_even[4][256];
+extern const uint8_t epd_lut_odd[4][256];
+extern const uint16_t epd_lut_all[4][256];
+
+// [mask ^ data] -> pixels kept, the rest become "nothing" in a partial update
+extern const uint8_t epd_lut_even_mask[256];
+extern const uint8_t epd_lut_odd_mask[256];
+extern const uint16_t epd_lut_all_mask[256];
+
+#endif // EPD_PIXEL_LUT
+
+#endif // EPD_G2_LUT_H
@@ -12,7 +12,6 @@
 #include "epd_g2.h"  // EPD V231_G2 Driver
 
 #include "fonts.h"
-#include "LW_Logo.h"
 
 #include "filter_controller.h"
 #include "process_controller.h"
@@ -27,7 +26,55 @@
 // Color inverse. 1 or 0 = set or reset a bit if set a colored pixel
 #define IF_INVERT_COLOR     0
 
-#define CYCLES_UNTIL_REFRESH		6			/* The number of partial write cycles before a full refresh */
+// Orientation the glyphs in fonts_rotated.c and assets_packed.c were generated for
+// (Tools/font_rotate.py, Tools/asset_pack.py).
+// Text on a canvas in any other orientation is drawn pixel by pixel.
+#define CANVAS_FONT_ROTATE  ROTATE_90
+
+// Filter display layout, see canvas_ComputeLayout. Rotated coordinates
+#define CANVAS_LAYOUT_HEADER		17			/* Rows above the first slot */
+#define CANVAS_LAYOUT_GAP			2			/* White rows between two slots */
+#define CANVAS_LAYOUT_MARGIN		2			/* Slot edge to the area that gets highlighted */
+#define CANVAS_LAYOUT_LABEL			"FILTERS"	/* Header text */
+#define CANVAS_LAYOUT_LABEL_Y		3			/* Header text row, the capitals of the fonts start 2 rows down */
+#define CANVAS_NAME_MAX_LINES		2			/* A name that needs more lines takes a smaller font */
+
+// Rendered filter names kept for redraws, CANVAS_NAME_MAX_COLS * CANVAS_NAME_COL_BYTES each
+// (576 bytes on EPD_2_0, 1056 on EPD_2_7)
+#define CANVAS_NAME_CACHE_SIZE		8
+#define CANVAS_NAME_COL_BYTES		((CANVAS_NAME_MAX_LINES * MAX_HEIGHT_FONT + 7) / 8)	/* Lines of the largest font */
+
+#ifndef CANVAS_BENCHMARK
+#define CANVAS_BENCHMARK	0			/* 1 = build canvas_Benchmark for the "gfxBench" CLI command */
+#endif
+
+// Partial updates of one slot before a full refresh clears the ghosting, by stage temperature
+#define CANVAS_GHOST_LIMIT_WARM		8			/* 15 deg C and up */
+#define CANVAS_GHOST_LIMIT_MILD		6			/* 5 to 15 deg C */
+#define CANVAS_GHOST_LIMIT_COLD		3			/* Below 5 deg C */
+
+#define CANVAS_IDLE_REFRESH_MS		600000		/* Full refresh after this long without redraws, 0 = off */
+
+#define CANVAS_MAX_DAMAGE			8			/* Dirty rectangles kept before they get merged */
+
+// Frame buffers are static, sized for the panel in use (MATTE_BOX_EPD_SIZE)
+#define CANVAS_MAX_WIDTH			(((EPD_PANEL_DOTS(MATTE_BOX_EPD_SIZE) + 7) / 8) * 8)
+#define CANVAS_MAX_HEIGHT			EPD_PANEL_LINES(MATTE_BOX_EPD_SIZE)
+#define CANVAS_BUFFER_SIZE			(CANVAS_MAX_WIDTH * CANVAS_MAX_HEIGHT / 8)
+
+#if (EPD_PANEL_DOTS(MATTE_BOX_EPD_SIZE) == 0) || (CANVAS_MAX_HEIGHT == 0)
+#error "MATTE_BOX_EPD_SIZE is not a panel listed in epd_g2.h"
+#endif
+#if (CANVAS_MAX_WIDTH > EPD_MAX_DOTS) || (CANVAS_MAX_HEIGHT > EPD_MAX_LINES)
+#error "MATTE_BOX_EPD_SIZE is larger than the EPD line buffers and line maps (EPD_MAX_DOTS/LINES)"
+#endif
+
+// A cached name holds one line across the canvas as the glyphs are rotated for it
+#if (CANVAS_FONT_ROTATE == ROTATE_90) || (CANVAS_FONT_ROTATE == ROTATE_270)
+#define CANVAS_NAME_MAX_COLS		CANVAS_MAX_HEIGHT
+#else
+#define CANVAS_NAME_MAX_COLS		CANVAS_MAX_WIDTH
+#endif
 
 typedef enum {           // error codes
 	CANVAS_OK,
@@ -35,26 +82,112 @@ typedef enum {           // error codes
 	CANVAS_ERR
 } Canvas_error;
 
+typedef struct {			// Inclusive pixel coordinates, absolute (unrotated) unless noted
+	uint16_t x0;
+	uint16_t y0;
+	uint16_t x1;
+	uint16_t y1;
+} Canvas_rect;
+
+typedef struct {
+	uint32_t pixelCycles;		// 3 slots with the text drawn pixel by pixel
+	uint32_t blitCycles;		// Same slots with canvas_BlitGlyph, pre-rotated glyphs unless FONT_ASSET_PACK
+	uint32_t packedCycles;		// Same slots with the glyphs unpacked from the asset pack
+	uint32_t cachedCycles;		// Same slots from the name cache
+	bool match;					// All frames are identical
+} Canvas_bench;
+
+typedef struct {			// 1 bpp frame image, PackBits compressed (Tools/asset_pack.py)
+	uint16_t width;
+	uint16_t height;
+	uint16_t size;				// Bytes of data
+	const uint8_t* data;
+} Canvas_image;
+
+typedef struct {
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t evictions;
+} Canvas_cache_stats;
+
+typedef struct {
+	uint32_t requests;			// canvas_DrawFilters calls
+	uint32_t coalesced;			// Requests replaced by a newer one before they were drawn
+	uint32_t refreshes;			// EPD updates started, full and partial
+	uint32_t lastLatency;		// ms from a request to the first frame of its update
+	uint32_t maxLatency;
+	uint32_t renderCycles;		// Cycles to draw the slots of the last redraw
+	uint32_t maxRenderCycles;
+} Canvas_refresh_stats;
+
+typedef struct {
+	sFONT* font;				// NULL = the name doesn't fit the slot
+	uint8_t lineLen;			// Characters per line, longer names wrap
+	uint8_t lines;
+	uint16_t dx;				// Text origin, relative to the slot area
+	uint16_t dy;
+} Canvas_text_fit;
+
+typedef struct {				// Rotated, inclusive coordinates
+	uint8_t slots;
+	Canvas_rect header;
+	Canvas_rect band[FILTER_SECTION_SIZE];			// Filled slot background
+	Canvas_rect area[FILTER_SECTION_SIZE];			// Redrawn and highlighted part of a band
+	Canvas_text_fit fit[FILTER_NAME_LEN + 1];		// By name length, the same for every slot
+	sFONT* labelFont;
+	uint16_t labelX;
+} Canvas_layout;
+
 typedef struct Canvas_t {
-	uint8_t* image;
+	uint8_t* image;							// Back buffer, all drawing goes here
+	uint8_t* front;							// Frame currently on the display
     uint16_t width;
     uint16_t height;
     uint8_t rotate;
+
+    Canvas_rect damage[CANVAS_MAX_DAMAGE];	// Areas drawn since the last EPD update
+    uint8_t damage_count;
+
+    Canvas_layout layout;					// Filter display, follows the size, rotation and slot count
 } Canvas;
 
 Canvas_error Canvas_Init(Canvas* canvas, uint16_t width, uint16_t height);
 void canvas_DrawFilters(Canvas* canvas, EPD_HandleTypeDef* epd, filterSection_t *currentFilters, uint8_t invPosition);
+void canvas_Process(Canvas* canvas, EPD_HandleTypeDef* epd);
+void canvas_Flush(Canvas* canvas, EPD_HandleTypeDef* epd);
+void canvas_GetRefreshStats(Canvas_refresh_stats* stats);
 
 void canvas_SetRotate(Canvas* canvas, uint8_t rotate);
+void canvas_SetSlots(Canvas* canvas, uint8_t slots);
+void canvas_DrawLayout(Canvas* canvas);
 
 void canvas_DrawAbsolutePixel(Canvas* canvas, uint16_t x, uint16_t y, int colored);
 void canvas_DrawPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored);
 void canvas_DrawCharAt(Canvas* canvas, uint16_t x, uint16_t y, char ascii_char, sFONT* font, int colored);
 void canvas_DrawStringAt(Canvas* canvas, uint16_t x, uint16_t y, const char* text, sFONT* font, int colored);
+void canvas_DrawFilledRectangle(Canvas* canvas, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t colored);
+
+void canvas_AddDamage(Canvas* canvas, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void canvas_ClearDamage(Canvas* canvas);
+uint16_t canvas_DamageLineMap(Canvas* canvas, uint8_t* line_map);
 
 void canvas_PrintEPD(Canvas* canvas, EPD_HandleTypeDef* epd);
 void canvas_setBGImage(Canvas* canvas, const uint8_t* bg_image);
-void canvas_UpdateEPD(Canvas* canvas, EPD_HandleTypeDef* epd, uint8_t* old_img);
+Canvas_error canvas_setPackedBGImage(Canvas* canvas, const Canvas_image* bg_image);
+void canvas_RestoreBGRect(Canvas* canvas, const uint8_t* bg_image, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void canvas_UpdateEPD(Canvas* canvas, EPD_HandleTypeDef* epd);
+void canvas_Maintenance(Canvas* canvas, EPD_HandleTypeDef* epd);
+
+void canvas_GetNameCacheStats(Canvas_cache_stats* stats);
+
+// Images of the asset pack, assets_packed.c
+extern const Canvas_image Image_LightWidowLogo;
+extern const Canvas_image Image_SpiderLogo;
+extern const Canvas_image Image_Background;
+
+#if CANVAS_BENCHMARK
+Canvas_error canvas_Benchmark(Canvas* canvas, EPD_HandleTypeDef* epd, Canvas_bench* bench);
+#endif
 
 
 #endif // _EPD_GFX_H
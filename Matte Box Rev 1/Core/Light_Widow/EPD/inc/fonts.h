@@ -16,14 +16,39 @@
 #define MAX_WIDTH_FONT          17
 #define OFFSET_BITMAP           54
 
+/* Glyphs of the tables, ' ' to '~' */
+#define FONT_CHAR_COUNT         95
+
+/* 1 = text is drawn from the asset pack only (assets_packed.c, Tools/asset_pack.py),
+   the font tables and fonts_rotated.c are left for the linker to drop.
+   0 = all three are linked, canvas_Benchmark compares them */
+#ifndef FONT_ASSET_PACK
+#define FONT_ASSET_PACK         1
+#endif
+
+#if FONT_ASSET_PACK
+#define FONT_TABLE(table)       NULL
+#else
+#define FONT_TABLE(table)       (table)
+#endif
+
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include <stdint.h>
 
+typedef struct _tPackedFont
+{
+  const uint16_t *index;    /* Glyph c is data[index[c]] to data[index[c + 1]], none = blank */
+  const uint8_t *data;      /* Glyph box and its bit packed columns, see Tools/asset_pack.py */
+} sPackedFont;
+
 typedef struct _tFont
 {
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *rotated;   /* Glyph columns for canvas_BlitGlyph, see fonts_rotated.c */
+  const sPackedFont *packed;  /* Same columns from the asset pack, see assets_packed.c */
 
 } sFONT;
 
@@ -33,4 +58,16 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern const uint8_t Font24_Rotated[];
+extern const uint8_t Font20_Rotated[];
+extern const uint8_t Font16_Rotated[];
+extern const uint8_t Font12_Rotated[];
+extern const uint8_t Font8_Rotated[];
+
+extern const sPackedFont Font24_Packed;
+extern const sPackedFont Font20_Packed;
+extern const sPackedFont Font16_Packed;
+extern const sPackedFont Font12_Packed;
+extern const sPackedFont Font8_Packed;
+
 #endif /* __FONTS_H */
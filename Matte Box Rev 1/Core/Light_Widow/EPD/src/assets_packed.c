@@ -0,0 +1,1246 @@
+/*
+ * assets_packed.c
+ *
+ *  Subset and packed glyphs of the ST fonts, PackBits compressed frame images.
+ *  Generated by Tools/asset_pack.py, do not edit.
+ */
+
+#include "fonts.h"
+#include "epd_gfx.h"
+
+#if CANVAS_FONT_ROTATE != ROTATE_90
+#error "assets_packed.c was generated for ROTATE_90, run Tools/asset_pack.py --rotate"
+#endif
+
+// Font8, 5 x 8, 94 of 95 glyphs
+static const uint16_t Font8_Index[] =
+{
+	0, 0, 4, 8, 16, 22, 28, 34, 38, 43, 48, 53, 60, 64, 68, 72,
+	79, 85, 92, 98, 104, 110, 116, 122, 128, 134, 140, 144, 148, 154, 159, 165,
+	171, 178, 185, 192, 198, 205, 212, 219, 225, 232, 238, 244, 251, 258, 265, 272,
+	278, 285, 292, 299, 305, 312, 319, 326, 333, 340, 347, 353, 358, 365, 370, 375,
+	379, 383, 388, 395, 400, 406, 411, 417, 423, 430, 436, 442, 449, 455, 461, 467,
+	472, 479, 485, 490, 495, 502, 508, 514, 520, 525, 532, 537, 543, 547, 553, 557
+};
+
+static const uint8_t Font8_Data[] =
+{
+	// '!'
+	0x22, 0x08, 0x03, 0x3d,
+	// '"'
+	0x61, 0x18, 0x01, 0x33,
+	// '#'
+	0xa0, 0x84, 0x03, 0x15, 0x5f, 0xd5, 0x47, 0x05,
+	// '$'
+	0x61, 0x84, 0x03, 0x92, 0x3d, 0x0b,
+	// '%'
+	0x81, 0x08, 0x03, 0x04, 0xbd, 0x20,
+	// '&'
+	0x81, 0x88, 0x02, 0xa7, 0xcf, 0x08,
+	// '''
+	0x22, 0x94, 0x01, 0x07,
+	// '('
+	0x42, 0x84, 0x03, 0xbe, 0x20,
+	// ')'
+	0x41, 0x84, 0x03, 0x41, 0x1f,
+	// '*'
+	0x61, 0x10, 0x02, 0xe5, 0x05,
+	// '+'
+	0xa0, 0x88, 0x02, 0x84, 0x7c, 0x42, 0x00,
+	// ','
+	0x42, 0x84, 0x01, 0x23,
+	// '-'
+	0x61, 0x90, 0x00, 0x07,
+	// '.'
+	0x22, 0x88, 0x00, 0x01,
+	// '/'
+	0x80, 0x84, 0x03, 0x01, 0x03, 0x0e, 0x08,
+	// '0'
+	0x61, 0x08, 0x03, 0x5e, 0xe8, 0x01,
+	// '1'
+	0xa0, 0x08, 0x03, 0x41, 0xf8, 0x07, 0x01,
+	// '2'
+	0x61, 0x08, 0x03, 0x53, 0x1b, 0x01,
+	// '3'
+	0x61, 0x08, 0x03, 0x51, 0xa9, 0x01,
+	// '4'
+	0x81, 0x08, 0x03, 0x4c, 0xf5, 0x17,
+	// '5'
+	0x61, 0x08, 0x03, 0x7a, 0x6a, 0x02,
+	// '6'
+	0x61, 0x08, 0x03, 0x5f, 0x6a, 0x02,
+	// '7'
+	0x61, 0x08, 0x03, 0xf0, 0x89, 0x03,
+	// '8'
+	0x61, 0x08, 0x03, 0x56, 0x6a, 0x01,
+	// '9'
+	0x61, 0x08, 0x03, 0x59, 0xe9, 0x03,
+	// ':'
+	0x22, 0x08, 0x02, 0x09,
+	// ';'
+	0x42, 0x08, 0x02, 0xa1,
+	// '<'
+	0x80, 0x88, 0x02, 0x84, 0xa8, 0x08,
+	// '='
+	0x61, 0x90, 0x01, 0x6d, 0x01,
+	// '>'
+	0x81, 0x88, 0x02, 0x51, 0x11, 0x02,
+	// '?'
+	0x61, 0x08, 0x03, 0x50, 0x89, 0x01,
+	// '@'
+	0x81, 0x84, 0x03, 0xbe, 0x60, 0xb2, 0x07,
+	// 'A'
+	0xa0, 0x08, 0x03, 0x43, 0x4b, 0x37, 0x03,
+	// 'B'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0xa6, 0x16,
+	// 'C'
+	0x61, 0x08, 0x03, 0x7e, 0x18, 0x03,
+	// 'D'
+	0xa0, 0x08, 0x03, 0xe1, 0x1f, 0x86, 0x1e,
+	// 'E'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0x86, 0x33,
+	// 'F'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0x82, 0x30,
+	// 'G'
+	0x81, 0x08, 0x03, 0x7e, 0x78, 0x12,
+	// 'H'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0x22, 0x3f,
+	// 'I'
+	0x61, 0x08, 0x03, 0xe1, 0x1f, 0x02,
+	// 'J'
+	0x81, 0x08, 0x03, 0x46, 0xe8, 0x83,
+	// 'K'
+	0xa0, 0x08, 0x03, 0xe1, 0xcf, 0xdc, 0x21,
+	// 'L'
+	0xa0, 0x08, 0x03, 0xe1, 0x1f, 0x06, 0x03,
+	// 'M'
+	0xa0, 0x08, 0x03, 0x7f, 0x4e, 0xe4, 0x3f,
+	// 'N'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0x99, 0x3f,
+	// 'O'
+	0x81, 0x08, 0x03, 0x5e, 0x18, 0x7a,
+	// 'P'
+	0xa0, 0x08, 0x03, 0xe1, 0x5f, 0x92, 0x18,
+	// 'Q'
+	0x81, 0x84, 0x03, 0x3c, 0xe1, 0xb0, 0x07,
+	// 'R'
+	0xa0, 0x08, 0x03, 0xe1, 0x5f, 0x92, 0x1b,
+	// 'S'
+	0x61, 0x08, 0x03, 0x73, 0x7a, 0x03,
+	// 'T'
+	0xa0, 0x08, 0x03, 0x70, 0xf8, 0x87, 0x30,
+	// 'U'
+	0xa0, 0x08, 0x03, 0xa0, 0x1f, 0x84, 0x3e,
+	// 'V'
+	0xa0, 0x08, 0x03, 0xb0, 0x1b, 0x9c, 0x38,
+	// 'W'
+	0xa0, 0x08, 0x03, 0x7e, 0xe8, 0x84, 0x3e,
+	// 'X'
+	0xa0, 0x08, 0x03, 0xe1, 0xcc, 0xcc, 0x21,
+	// 'Y'
+	0xa0, 0x08, 0x03, 0x70, 0x7a, 0xa4, 0x30,
+	// 'Z'
+	0x81, 0x08, 0x03, 0x73, 0x99, 0xce,
+	// '['
+	0x42, 0x84, 0x03, 0xff, 0x20,
+	// '\'
+	0x80, 0x84, 0x03, 0x40, 0x98, 0x23, 0x00,
+	// ']'
+	0x41, 0x84, 0x03, 0xc1, 0x3f,
+	// '^'
+	0x61, 0x94, 0x01, 0x71, 0x00,
+	// '_'
+	0xa0, 0x80, 0x00, 0x1f,
+	// '`'
+	0x42, 0x18, 0x01, 0x06,
+	// 'a'
+	0x81, 0x08, 0x02, 0xb3, 0x1f,
+	// 'b'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0x24, 0x06,
+	// 'c'
+	0x61, 0x08, 0x02, 0x9f, 0x09,
+	// 'd'
+	0x81, 0x08, 0x03, 0x46, 0x92, 0xfe,
+	// 'e'
+	0x61, 0x08, 0x02, 0xde, 0x0d,
+	// 'f'
+	0x61, 0x08, 0x03, 0xc9, 0x97, 0x02,
+	// 'g'
+	0x81, 0x00, 0x03, 0x58, 0x59, 0xfa,
+	// 'h'
+	0xa0, 0x08, 0x03, 0xe1, 0x9f, 0x20, 0x07,
+	// 'i'
+	0x61, 0x08, 0x03, 0xc9, 0x1b, 0x00,
+	// 'j'
+	0x61, 0x00, 0x04, 0x21, 0xa1, 0x3f,
+	// 'k'
+	0xa0, 0x08, 0x03, 0xe1, 0x4f, 0x3c, 0x09,
+	// 'l'
+	0x61, 0x08, 0x03, 0xe1, 0x1f, 0x00,
+	// 'm'
+	0xa0, 0x08, 0x02, 0x8f, 0x87, 0x07,
+	// 'n'
+	0xa0, 0x08, 0x02, 0xf9, 0x88, 0x07,
+	// 'o'
+	0x81, 0x08, 0x02, 0x96, 0x69,
+	// 'p'
+	0xa0, 0x00, 0x03, 0xe1, 0x5f, 0x92, 0x18,
+	// 'q'
+	0x81, 0x00, 0x03, 0x18, 0x59, 0xfe,
+	// 'r'
+	0x81, 0x08, 0x02, 0xf9, 0x89,
+	// 's'
+	0x61, 0x08, 0x02, 0xd1, 0x0a,
+	// 't'
+	0xa0, 0x88, 0x02, 0xc8, 0xa7, 0x24, 0x00,
+	// 'u'
+	0xa0, 0x08, 0x02, 0xe8, 0x91, 0x0f,
+	// 'v'
+	0xa0, 0x08, 0x02, 0xc8, 0x33, 0x0c,
+	// 'w'
+	0xa0, 0x08, 0x02, 0x9e, 0x96, 0x0e,
+	// 'x'
+	0x81, 0x08, 0x02, 0x69, 0x96,
+	// 'y'
+	0xa0, 0x00, 0x03, 0x60, 0x7e, 0xe0, 0x20,
+	// 'z'
+	0x81, 0x08, 0x02, 0xbd, 0xbd,
+	// '{'
+	0x61, 0x84, 0x03, 0x08, 0x5f, 0x10,
+	// '|'
+	0x22, 0x84, 0x03, 0x7f,
+	// '}'
+	0x61, 0x84, 0x03, 0x41, 0x1f, 0x02,
+	// '~'
+	0x81, 0x0c, 0x01, 0x99
+};
+
+const sPackedFont Font8_Packed = { Font8_Index, Font8_Data };
+
+// Font12, 7 x 12, 94 of 95 glyphs
+static const uint16_t Font12_Index[] =
+{
+	0, 0, 4, 9, 18, 26, 34, 41, 45, 51, 57, 64, 74, 79, 83, 87,
+	96, 104, 112, 120, 128, 137, 145, 153, 161, 169, 177, 182, 188, 197, 202, 211,
+	218, 228, 238, 247, 255, 264, 273, 282, 291, 301, 309, 317, 327, 335, 345, 355,
+	363, 371, 380, 390, 398, 408, 418, 428, 438, 448, 458, 466, 473, 481, 488, 494,
+	498, 502, 510, 519, 526, 535, 542, 550, 559, 569, 577, 585, 594, 602, 611, 620,
+	627, 636, 645, 652, 659, 668, 677, 686, 695, 703, 713, 720, 727, 732, 739, 744
+};
+
+static const uint8_t Font12_Data[] =
+{
+	// '!'
+	0x23, 0x0c, 0x04, 0xf9,
+	// '"'
+	0xa1, 0xa0, 0x01, 0x27, 0x4e,
+	// '#'
+	0xa1, 0x88, 0x04, 0x2b, 0xf8, 0xac, 0xe6, 0x83, 0x1a,
+	// '$'
+	0x81, 0x88, 0x04, 0x6c, 0x28, 0x5d, 0xc6, 0x04,
+	// '%'
+	0xa1, 0x0c, 0x04, 0x48, 0xa8, 0x4a, 0x15, 0x12,
+	// '&'
+	0xa1, 0x0c, 0x03, 0x46, 0x56, 0x8a, 0x05,
+	// '''
+	0x23, 0x1c, 0x02, 0x0f,
+	// '('
+	0x43, 0x04, 0x05, 0xfc, 0x0c, 0x0c,
+	// ')'
+	0x42, 0x04, 0x05, 0x03, 0xf3, 0x03,
+	// '*'
+	0xa1, 0x98, 0x02, 0x68, 0xf1, 0x85, 0x00,
+	// '+'
+	0xe0, 0x8c, 0x03, 0x08, 0x04, 0xe2, 0x8f, 0x40, 0x20, 0x00,
+	// ','
+	0x62, 0x04, 0x02, 0xe3, 0x08,
+	// '-'
+	0xa1, 0x98, 0x00, 0x1f,
+	// '.'
+	0x42, 0x0c, 0x01, 0x0f,
+	// '/'
+	0xa1, 0x88, 0x04, 0x01, 0x0c, 0x60, 0x00, 0x03, 0x18,
+	// '0'
+	0xa1, 0x0c, 0x04, 0x7e, 0x81, 0x81, 0x81, 0x7e,
+	// '1'
+	0xa1, 0x0c, 0x04, 0x01, 0x81, 0xff, 0x01, 0x01,
+	// '2'
+	0xa1, 0x0c, 0x04, 0x43, 0x85, 0x89, 0x91, 0x63,
+	// '3'
+	0xa1, 0x0c, 0x04, 0x42, 0x81, 0x91, 0x91, 0x6e,
+	// '4'
+	0xc1, 0x0c, 0x04, 0x0c, 0x14, 0x64, 0x85, 0xff, 0x05,
+	// '5'
+	0xa1, 0x0c, 0x04, 0x02, 0xf1, 0x91, 0x91, 0x8e,
+	// '6'
+	0xa1, 0x0c, 0x04, 0x3e, 0x51, 0x91, 0x91, 0x8e,
+	// '7'
+	0xa1, 0x0c, 0x04, 0xc0, 0x80, 0x83, 0x9c, 0xe0,
+	// '8'
+	0xa1, 0x0c, 0x04, 0x6e, 0x91, 0x91, 0x91, 0x6e,
+	// '9'
+	0xa1, 0x0c, 0x04, 0x71, 0x89, 0x89, 0x8a, 0x7c,
+	// ':'
+	0x42, 0x0c, 0x03, 0xf3, 0x0c,
+	// ';'
+	0x62, 0x88, 0x03, 0x03, 0x33, 0x19,
+	// '<'
+	0xc0, 0x8c, 0x03, 0x08, 0x0a, 0x45, 0x14, 0x0c, 0x02,
+	// '='
+	0xa1, 0x94, 0x01, 0x6d, 0x5b,
+	// '>'
+	0xc0, 0x8c, 0x03, 0xc1, 0xa0, 0x88, 0x42, 0x41, 0x00,
+	// '?'
+	0x82, 0x8c, 0x03, 0xa1, 0x22, 0x12, 0x06,
+	// '@'
+	0xa1, 0x08, 0x05, 0xfe, 0x05, 0x18, 0x63, 0x92, 0xfa, 0x01,
+	// 'A'
+	0xe0, 0x0c, 0x04, 0x01, 0x07, 0xbd, 0xc4, 0x3d, 0x07, 0x01,
+	// 'B'
+	0xc0, 0x0c, 0x04, 0x81, 0xff, 0x91, 0x91, 0x91, 0x6e,
+	// 'C'
+	0xa1, 0x0c, 0x04, 0x7e, 0x81, 0x81, 0x81, 0xc2,
+	// 'D'
+	0xc0, 0x0c, 0x04, 0x81, 0xff, 0x81, 0x81, 0x42, 0x3c,
+	// 'E'
+	0xc0, 0x0c, 0x04, 0x81, 0xff, 0x91, 0xb9, 0x81, 0xc3,
+	// 'F'
+	0xc1, 0x0c, 0x04, 0x81, 0xff, 0x91, 0xb8, 0x80, 0xc0,
+	// 'G'
+	0xc1, 0x0c, 0x04, 0x7e, 0x81, 0x81, 0x89, 0xce, 0x08,
+	// 'H'
+	0xe0, 0x0c, 0x04, 0x81, 0xff, 0x91, 0x10, 0x91, 0xff, 0x81,
+	// 'I'
+	0xa1, 0x0c, 0x04, 0x81, 0x81, 0xff, 0x81, 0x81,
+	// 'J'
+	0xa1, 0x0c, 0x04, 0x0e, 0x81, 0x81, 0xfe, 0x80,
+	// 'K'
+	0xe0, 0x0c, 0x04, 0x81, 0xff, 0x89, 0x18, 0xa4, 0xc3, 0x81,
+	// 'L'
+	0xa1, 0x0c, 0x04, 0x81, 0xff, 0x81, 0x01, 0x07,
+	// 'M'
+	0xe0, 0x0c, 0x04, 0x81, 0xff, 0xe1, 0x18, 0xe1, 0xff, 0x81,
+	// 'N'
+	0xe0, 0x0c, 0x04, 0x81, 0xff, 0xe1, 0x1c, 0x83, 0xff, 0x80,
+	// 'O'
+	0xa1, 0x0c, 0x04, 0x7e, 0x81, 0x81, 0x81, 0x7e,
+	// 'P'
+	0xa1, 0x0c, 0x04, 0x81, 0xff, 0x89, 0x88, 0x70,
+	// 'Q'
+	0xa1, 0x88, 0x04, 0xfc, 0x04, 0x0e, 0x1c, 0xd8, 0x0f,
+	// 'R'
+	0xe0, 0x0c, 0x04, 0x81, 0xff, 0x89, 0x88, 0x8c, 0x72, 0x01,
+	// 'S'
+	0xa1, 0x0c, 0x04, 0x63, 0x92, 0x91, 0x51, 0xce,
+	// 'T'
+	0xe0, 0x0c, 0x04, 0xc0, 0x80, 0x81, 0xff, 0x81, 0x80, 0xc0,
+	// 'U'
+	0xe0, 0x0c, 0x04, 0x80, 0xfe, 0x81, 0x01, 0x81, 0xfe, 0x80,
+	// 'V'
+	0xe0, 0x0c, 0x04, 0x80, 0xe0, 0x9c, 0x03, 0x9c, 0xe0, 0x80,
+	// 'W'
+	0xe0, 0x0c, 0x04, 0x80, 0xfe, 0x81, 0x1e, 0x81, 0xfe, 0x80,
+	// 'X'
+	0xe0, 0x0c, 0x04, 0x81, 0xc3, 0x24, 0x18, 0x24, 0xc3, 0x81,
+	// 'Y'
+	0xe0, 0x0c, 0x04, 0x80, 0xc0, 0xb1, 0x0f, 0xb1, 0xc0, 0x80,
+	// 'Z'
+	0xa1, 0x0c, 0x04, 0xc3, 0x85, 0x99, 0xa1, 0xc3,
+	// '['
+	0x62, 0x04, 0x05, 0xff, 0x07, 0x18, 0x20,
+	// '\'
+	0x81, 0x88, 0x04, 0x00, 0xc1, 0x61, 0x38, 0x00,
+	// ']'
+	0x62, 0x04, 0x05, 0x01, 0x06, 0xf8, 0x3f,
+	// '^'
+	0xa1, 0x1c, 0x02, 0x21, 0x2c, 0x01,
+	// '_'
+	0xe0, 0x80, 0x00, 0x7f,
+	// '`'
+	0x43, 0x24, 0x01, 0x06,
+	// 'a'
+	0xc1, 0x0c, 0x03, 0x56, 0x9a, 0xa6, 0x5f, 0x00,
+	// 'b'
+	0xc0, 0x0c, 0x04, 0x81, 0xff, 0x11, 0x21, 0x21, 0x1e,
+	// 'c'
+	0xa1, 0x0c, 0x03, 0x5e, 0x18, 0x86, 0x32,
+	// 'd'
+	0xc1, 0x0c, 0x04, 0x1e, 0x21, 0x21, 0x91, 0xff, 0x01,
+	// 'e'
+	0xa1, 0x0c, 0x03, 0x5e, 0x9a, 0xa6, 0x19,
+	// 'f'
+	0xa1, 0x0c, 0x04, 0x21, 0x7f, 0xa1, 0xa1, 0xa1,
+	// 'g'
+	0xc1, 0x04, 0x04, 0x78, 0x85, 0x85, 0x45, 0xfe, 0x80,
+	// 'h'
+	0xe0, 0x0c, 0x04, 0x81, 0xff, 0x11, 0x20, 0x21, 0x1f, 0x01,
+	// 'i'
+	0xa1, 0x0c, 0x04, 0x21, 0x21, 0xbf, 0x01, 0x01,
+	// 'j'
+	0x81, 0x04, 0x05, 0x81, 0x04, 0x12, 0xa8, 0x3f,
+	// 'k'
+	0xc0, 0x0c, 0x04, 0x81, 0xff, 0x08, 0x2d, 0x33, 0x21,
+	// 'l'
+	0xa1, 0x0c, 0x04, 0x01, 0x81, 0xff, 0x01, 0x01,
+	// 'm'
+	0xe0, 0x0c, 0x03, 0xe1, 0x1f, 0x7e, 0xe1, 0x17, 0x00,
+	// 'n'
+	0xe0, 0x0c, 0x03, 0xe1, 0x1f, 0x81, 0xe1, 0x17, 0x00,
+	// 'o'
+	0xa1, 0x0c, 0x03, 0x5e, 0x18, 0x86, 0x1e,
+	// 'p'
+	0xc0, 0x04, 0x04, 0x81, 0xff, 0x45, 0x84, 0x84, 0x78,
+	// 'q'
+	0xc1, 0x04, 0x04, 0x78, 0x84, 0x84, 0x45, 0xff, 0x81,
+	// 'r'
+	0xa1, 0x0c, 0x03, 0xe1, 0x1f, 0x85, 0x21,
+	// 's'
+	0xa1, 0x0c, 0x03, 0x53, 0x9a, 0xa6, 0x36,
+	// 't'
+	0xc1, 0x8c, 0x03, 0x20, 0x7f, 0x28, 0x14, 0x12, 0x00,
+	// 'u'
+	0xe0, 0x0c, 0x03, 0xa0, 0x1f, 0x04, 0xe2, 0x1f, 0x00,
+	// 'v'
+	0xe0, 0x0c, 0x03, 0x20, 0x6e, 0x06, 0x26, 0x0e, 0x02,
+	// 'w'
+	0xe0, 0x0c, 0x03, 0xa0, 0x1f, 0x3a, 0xa1, 0x0f, 0x02,
+	// 'x'
+	0xc0, 0x0c, 0x03, 0xe1, 0xcc, 0x30, 0x73, 0x08,
+	// 'y'
+	0xe0, 0x04, 0x04, 0x80, 0xc1, 0xb1, 0x0f, 0x99, 0xe0, 0x80,
+	// 'z'
+	0xa1, 0x0c, 0x03, 0x73, 0x99, 0xc6, 0x23,
+	// '{'
+	0x62, 0x04, 0x05, 0x10, 0xb8, 0x17, 0x20,
+	// '|'
+	0x23, 0x88, 0x04, 0xff, 0x01,
+	// '}'
+	0x62, 0x04, 0x05, 0x01, 0xba, 0x07, 0x01,
+	// '~'
+	0xa1, 0x14, 0x01, 0x59, 0x02
+};
+
+const sPackedFont Font12_Packed = { Font12_Index, Font12_Data };
+
+// Font16, 11 x 16, 94 of 95 glyphs
+static const uint16_t Font16_Index[] =
+{
+	0, 0, 6, 14, 28, 43, 56, 67, 72, 81, 90, 100, 110, 115, 119, 123,
+	139, 151, 164, 176, 189, 201, 213, 225, 237, 249, 261, 266, 274, 288, 295, 309,
+	320, 332, 347, 359, 373, 387, 399, 413, 427, 441, 453, 467, 481, 495, 511, 525,
+	539, 551, 567, 582, 593, 605, 619, 633, 649, 663, 678, 689, 698, 714, 723, 732,
+	737, 742, 752, 767, 777, 792, 803, 818, 833, 848, 861, 874, 889, 902, 914, 925,
+	936, 951, 966, 977, 987, 1000, 1011, 1022, 1035, 1046, 1062, 1072, 1081, 1087, 1096, 1102
+};
+
+static const uint8_t Font16_Data[] =
+{
+	// '!'
+	0x44, 0x14, 0x05, 0xfd, 0xf7, 0x0f,
+	// '"'
+	0xe3, 0xa4, 0x02, 0xf8, 0x63, 0x80, 0x3f, 0x06,
+	// '#'
+	0x02, 0x91, 0x05, 0x50, 0xf8, 0xc3, 0xff, 0xa1, 0xff, 0x87, 0xff, 0x43, 0x1f, 0x0a,
+	// '$'
+	0xe2, 0x8c, 0x06, 0x1c, 0x87, 0xf3, 0x11, 0xa7, 0x63, 0x4c, 0x8e, 0xf8, 0x1c, 0x8e, 0x03,
+	// '%'
+	0x02, 0x15, 0x05, 0x88, 0x61, 0x09, 0x25, 0x6c, 0x36, 0xa4, 0x90, 0x86, 0x11,
+	// '&'
+	0xe2, 0x94, 0x04, 0x06, 0xde, 0xe5, 0xef, 0x68, 0xf0, 0x61, 0x02,
+	// '''
+	0x65, 0xa4, 0x02, 0xf8, 0x63,
+	// '('
+	0x84, 0x0c, 0x06, 0xf8, 0xc1, 0x3f, 0x0f, 0x3f, 0xc0,
+	// ')'
+	0x83, 0x0c, 0x06, 0x03, 0x7c, 0xe0, 0xfe, 0x83, 0x1f,
+	// '*'
+	0x02, 0xa1, 0x03, 0x98, 0xcd, 0xc7, 0xef, 0xff, 0x6c, 0x30,
+	// '+'
+	0xe2, 0x98, 0x03, 0x08, 0x04, 0xe2, 0x8f, 0x40, 0x20, 0x00,
+	// ','
+	0x64, 0x88, 0x02, 0x87, 0x43,
+	// '-'
+	0xe2, 0xa4, 0x00, 0x7f,
+	// '.'
+	0x44, 0x14, 0x01, 0x0f,
+	// '/'
+	0x02, 0x8d, 0x06, 0x03, 0xe0, 0x01, 0xf0, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0f, 0x80, 0x07, 0xc0,
+	// '0'
+	0xe2, 0x14, 0x05, 0xfc, 0xf8, 0x37, 0x70, 0x80, 0x03, 0xfb, 0xc7, 0x0f,
+	// '1'
+	0x02, 0x15, 0x05, 0x01, 0x05, 0x14, 0xd0, 0xff, 0xff, 0x07, 0x10, 0x40, 0x00,
+	// '2'
+	0xe2, 0x14, 0x05, 0xc3, 0x1c, 0xd7, 0x70, 0x86, 0x31, 0x86, 0x1f, 0x1c,
+	// '3'
+	0x01, 0x15, 0x05, 0x02, 0x0d, 0x1c, 0x62, 0x88, 0x21, 0xc6, 0xf9, 0xbf, 0x67,
+	// '4'
+	0xe2, 0x14, 0x05, 0x0c, 0xf0, 0x50, 0x4e, 0xe1, 0xff, 0xff, 0x5f, 0x00,
+	// '5'
+	0xe2, 0x14, 0x05, 0x02, 0xc4, 0x1f, 0x7e, 0x88, 0x21, 0xfe, 0xe8, 0x21,
+	// '6'
+	0xe2, 0x14, 0x05, 0x7c, 0xf8, 0x37, 0x59, 0xc8, 0x21, 0xfe, 0xe8, 0x21,
+	// '7'
+	0xe1, 0x14, 0x05, 0x00, 0x03, 0x08, 0xe0, 0x81, 0x7f, 0xe2, 0x0f, 0x38,
+	// '8'
+	0xe2, 0x14, 0x05, 0xde, 0xfd, 0x1f, 0x62, 0x88, 0x21, 0xfe, 0xef, 0x1d,
+	// '9'
+	0xe2, 0x14, 0x05, 0xe1, 0xc5, 0x1f, 0xe1, 0x84, 0x26, 0xfb, 0x87, 0x0f,
+	// ':'
+	0x44, 0x94, 0x03, 0xe3, 0x31,
+	// ';'
+	0x84, 0x8c, 0x04, 0x03, 0x18, 0x20, 0x06, 0x0c,
+	// '<'
+	0x21, 0x95, 0x04, 0x10, 0x20, 0xa0, 0x40, 0x41, 0x44, 0x90, 0xa0, 0x80, 0x01, 0x01,
+	// '='
+	0x21, 0xa1, 0x01, 0x6d, 0xdb, 0xb6, 0x05,
+	// '>'
+	0x21, 0x95, 0x04, 0x01, 0x03, 0x0a, 0x12, 0x44, 0x04, 0x05, 0x0a, 0x08, 0x10, 0x00,
+	// '?'
+	0xe2, 0x94, 0x04, 0xc0, 0x80, 0x37, 0xec, 0x08, 0x11, 0x3e, 0x38,
+	// '@'
+	0xc2, 0x90, 0x05, 0xfc, 0x11, 0x50, 0x0c, 0x93, 0x98, 0x44, 0xfd, 0x01,
+	// 'A'
+	0x41, 0x95, 0x04, 0x01, 0x0e, 0xfe, 0xcc, 0x8f, 0x18, 0x71, 0xfe, 0x1f, 0x07, 0x02, 0x00,
+	// 'B'
+	0x01, 0x95, 0x04, 0x01, 0xff, 0xff, 0x8f, 0x18, 0x31, 0xe2, 0x7f, 0x77,
+	// 'C'
+	0x21, 0x95, 0x04, 0x7c, 0xfc, 0x0d, 0x0e, 0x18, 0x30, 0x60, 0x40, 0x41, 0xc4, 0x01,
+	// 'D'
+	0x21, 0x95, 0x04, 0x01, 0xff, 0xff, 0x0f, 0x18, 0x30, 0xe0, 0x60, 0x7f, 0x7c, 0x00,
+	// 'E'
+	0x01, 0x95, 0x04, 0x01, 0xff, 0xff, 0x8f, 0x18, 0x31, 0x67, 0xc0, 0xe3,
+	// 'F'
+	0x21, 0x95, 0x04, 0x01, 0xff, 0xff, 0x8f, 0x18, 0x11, 0x27, 0x40, 0x80, 0xc0, 0x01,
+	// 'G'
+	0x21, 0x95, 0x04, 0x7c, 0xfc, 0x0d, 0x0e, 0x98, 0x30, 0xe1, 0x23, 0xe7, 0x08, 0x00,
+	// 'H'
+	0x21, 0x95, 0x04, 0x01, 0xff, 0xff, 0x8f, 0x08, 0x21, 0xe2, 0xff, 0xff, 0x01, 0x01,
+	// 'I'
+	0x02, 0x95, 0x04, 0x01, 0x03, 0x06, 0xfc, 0xff, 0x3f, 0x60, 0xc0, 0x80,
+	// 'J'
+	0x21, 0x95, 0x04, 0x0e, 0x1e, 0x04, 0x0c, 0x18, 0xf0, 0xbf, 0x7f, 0x80, 0x00, 0x01,
+	// 'K'
+	0x21, 0x95, 0x04, 0x01, 0xff, 0xff, 0xcf, 0x88, 0x83, 0xed, 0xf1, 0xc1, 0x01, 0x01,
+	// 'L'
+	0x21, 0x95, 0x04, 0x01, 0x03, 0xfe, 0xff, 0x1f, 0x30, 0x60, 0x80, 0x00, 0x0f, 0x00,
+	// 'M'
+	0x60, 0x95, 0x04, 0x01, 0xff, 0xff, 0x0f, 0x93, 0x83, 0x41, 0x8e, 0x30, 0xff, 0xff, 0x07, 0x04,
+	// 'N'
+	0x21, 0x95, 0x04, 0x01, 0xff, 0xff, 0x0f, 0x83, 0x83, 0xe1, 0xff, 0xff, 0x00, 0x01,
+	// 'O'
+	0x21, 0x95, 0x04, 0x7c, 0xfc, 0x0d, 0x0e, 0x18, 0x30, 0xe0, 0x60, 0x7f, 0x7c, 0x00,
+	// 'P'
+	0x01, 0x95, 0x04, 0x01, 0xff, 0xff, 0x4f, 0x98, 0x30, 0x21, 0x7e, 0x78,
+	// 'Q'
+	0x21, 0x8d, 0x05, 0xf0, 0xc1, 0x5f, 0x83, 0x0f, 0x78, 0xc0, 0x02, 0x36, 0x78, 0x7f, 0xf2, 0x01,
+	// 'R'
+	0x41, 0x95, 0x04, 0x01, 0xff, 0xff, 0x8f, 0x18, 0x11, 0xa3, 0xfb, 0x73, 0x01, 0x02, 0x00,
+	// 'S'
+	0xe2, 0x94, 0x04, 0xe7, 0xee, 0xc7, 0x8c, 0x98, 0xf1, 0xbb, 0x73,
+	// 'T'
+	0x01, 0x95, 0x04, 0xe0, 0x03, 0x06, 0xfc, 0xff, 0x3f, 0x60, 0x40, 0xf0,
+	// 'U'
+	0x21, 0x95, 0x04, 0x00, 0xfd, 0xff, 0x0f, 0x18, 0x20, 0xe0, 0x7f, 0xff, 0x00, 0x01,
+	// 'V'
+	0x21, 0x95, 0x04, 0x00, 0x81, 0xe3, 0xff, 0x39, 0xe0, 0x27, 0x7e, 0xe0, 0x00, 0x01,
+	// 'W'
+	0x60, 0x95, 0x04, 0x00, 0xe1, 0xff, 0x3f, 0xe8, 0x13, 0x8e, 0xcf, 0x83, 0xff, 0xe1, 0x03, 0x04,
+	// 'X'
+	0x21, 0x95, 0x04, 0x01, 0x07, 0x1f, 0xef, 0x8b, 0xa3, 0xef, 0xf1, 0xc1, 0x01, 0x01,
+	// 'Y'
+	0x41, 0x95, 0x04, 0x00, 0x01, 0x07, 0x0f, 0xfb, 0xe3, 0x47, 0xd8, 0xe0, 0x80, 0x01, 0x02,
+	// 'Z'
+	0xe2, 0x94, 0x04, 0xc3, 0x0f, 0x36, 0xcc, 0x19, 0x36, 0xf8, 0x61,
+	// '['
+	0x85, 0x0c, 0x06, 0xff, 0xff, 0xff, 0x01, 0x18, 0x80,
+	// '\'
+	0x02, 0x8d, 0x06, 0x00, 0x18, 0xc0, 0x03, 0x1e, 0xe0, 0x00, 0x07, 0x78, 0xc0, 0x03, 0x18, 0x00,
+	// ']'
+	0x83, 0x0c, 0x06, 0x01, 0x18, 0x80, 0xff, 0xff, 0xff,
+	// '^'
+	0xe2, 0x28, 0x03, 0x03, 0x81, 0x81, 0x18, 0x31, 0x00,
+	// '_'
+	0x60, 0x81, 0x00, 0xff, 0x07,
+	// '`'
+	0x64, 0xb4, 0x01, 0x54, 0x00,
+	// 'a'
+	0x02, 0x95, 0x03, 0x86, 0x67, 0x32, 0xa9, 0xfc, 0xff, 0x02,
+	// 'b'
+	0x21, 0x15, 0x05, 0x01, 0xfe, 0xff, 0xbf, 0x08, 0x41, 0x04, 0x31, 0x86, 0x0f, 0x1c, 0x00,
+	// 'c'
+	0x01, 0x95, 0x03, 0x1c, 0xdf, 0x38, 0x18, 0x0c, 0x8e, 0xec,
+	// 'd'
+	0x21, 0x15, 0x05, 0x1c, 0xf8, 0x30, 0x46, 0x10, 0x41, 0x88, 0xf8, 0xff, 0xff, 0x01, 0x00,
+	// 'e'
+	0x21, 0x95, 0x03, 0x1c, 0xdf, 0x3a, 0x99, 0x4c, 0xa6, 0x77, 0x1a,
+	// 'f'
+	0x22, 0x15, 0x05, 0x41, 0x04, 0xf1, 0xdf, 0xff, 0x41, 0x06, 0x19, 0x24, 0x80, 0x00, 0x02,
+	// 'g'
+	0x21, 0x09, 0x05, 0xe0, 0xc0, 0x97, 0x71, 0x82, 0x09, 0x46, 0xf4, 0xbf, 0xff, 0x00, 0x02,
+	// 'h'
+	0x21, 0x15, 0x05, 0x01, 0xfe, 0xff, 0x7f, 0x08, 0x40, 0x04, 0xf1, 0xc7, 0x0f, 0x01, 0x00,
+	// 'i'
+	0x02, 0x15, 0x05, 0x01, 0x04, 0x11, 0xc4, 0xdf, 0x7f, 0x07, 0x10, 0x40, 0x00,
+	// 'j'
+	0xc2, 0x88, 0x06, 0x01, 0x22, 0x40, 0x04, 0x88, 0x00, 0xfd, 0xbf, 0xfd, 0x07,
+	// 'k'
+	0x21, 0x15, 0x05, 0x01, 0xfe, 0xff, 0x3f, 0x06, 0x7d, 0x9c, 0x31, 0x44, 0x10, 0x01, 0x00,
+	// 'l'
+	0x02, 0x15, 0x05, 0x01, 0x04, 0x18, 0xe0, 0xff, 0xff, 0x07, 0x10, 0x40, 0x00,
+	// 'm'
+	0x41, 0x95, 0x03, 0xc1, 0xff, 0x1f, 0xf8, 0xff, 0x03, 0xff, 0xbf, 0x00,
+	// 'n'
+	0x21, 0x95, 0x03, 0xc1, 0xff, 0x3f, 0x04, 0x0c, 0xfe, 0x7f, 0x01,
+	// 'o'
+	0x21, 0x95, 0x03, 0x1c, 0xdf, 0x38, 0x18, 0x0c, 0x8e, 0x7d, 0x1c,
+	// 'p'
+	0x21, 0x09, 0x05, 0x01, 0xfe, 0xff, 0x7f, 0x44, 0x09, 0x22, 0x88, 0x31, 0x7c, 0xe0, 0x00,
+	// 'q'
+	0x21, 0x09, 0x05, 0xe0, 0xc0, 0x87, 0x31, 0x82, 0x09, 0x46, 0xf4, 0xff, 0xff, 0x01, 0x02,
+	// 'r'
+	0x21, 0x95, 0x03, 0xc1, 0xe0, 0xff, 0x1f, 0x0a, 0x06, 0xc1, 0x20,
+	// 's'
+	0xe2, 0x94, 0x03, 0xb3, 0x7d, 0x36, 0xdb, 0x7c, 0x9b, 0x01,
+	// 't'
+	0x01, 0x15, 0x05, 0x40, 0x00, 0xe1, 0xff, 0xff, 0x41, 0x04, 0x11, 0x84, 0x00,
+	// 'u'
+	0x21, 0x95, 0x03, 0x40, 0xff, 0x3f, 0x10, 0x10, 0xfe, 0xff, 0x01,
+	// 'v'
+	0x21, 0x95, 0x03, 0x40, 0x38, 0xff, 0x39, 0x78, 0xf2, 0xe1, 0x40,
+	// 'w'
+	0x60, 0x95, 0x03, 0x40, 0xfc, 0xff, 0xe8, 0xc0, 0x38, 0x8e, 0x7f, 0x3c, 0x10,
+	// 'x'
+	0x21, 0x95, 0x03, 0xc1, 0xe0, 0xf8, 0xcf, 0xf9, 0x8f, 0x83, 0x41,
+	// 'y'
+	0x41, 0x09, 0x05, 0x00, 0x06, 0x1c, 0xfc, 0xbc, 0x1f, 0xf4, 0x00, 0x2f, 0xf0, 0x00, 0x03, 0x08,
+	// 'z'
+	0xe2, 0x94, 0x03, 0xe3, 0x63, 0x33, 0x99, 0x8d, 0x8f, 0x01,
+	// '{'
+	0x83, 0x0c, 0x06, 0x20, 0xe0, 0x7f, 0xdf, 0x1f, 0x80,
+	// '|'
+	0x45, 0x0c, 0x06, 0xff, 0xff, 0xff,
+	// '}'
+	0x84, 0x0c, 0x06, 0x01, 0xf8, 0xfd, 0xfe, 0x07, 0x02,
+	// '~'
+	0xe2, 0xa0, 0x01, 0x22, 0x95, 0x08
+};
+
+const sPackedFont Font16_Packed = { Font16_Index, Font16_Data };
+
+// Font20, 14 x 20, 94 of 95 glyphs
+static const uint16_t Font20_Index[] =
+{
+	0, 0, 8, 17, 40, 59, 77, 93, 99, 110, 121, 133, 149, 155, 161, 166,
+	185, 203, 219, 237, 257, 275, 293, 311, 329, 347, 365, 372, 382, 401, 413, 432,
+	447, 463, 484, 502, 520, 540, 558, 576, 596, 614, 629, 649, 669, 687, 708, 726,
+	744, 762, 784, 804, 822, 840, 858, 878, 901, 921, 939, 954, 965, 984, 995, 1005,
+	1012, 1017, 1032, 1053, 1068, 1089, 1104, 1122, 1143, 1163, 1179, 1199, 1219, 1235, 1252, 1267,
+	1282, 1303, 1324, 1339, 1351, 1369, 1384, 1400, 1416, 1431, 1452, 1464, 1479, 1486, 1501, 1509
+};
+
+static const uint8_t Font20_Data[] =
+{
+	// '!'
+	0x65, 0x98, 0x06, 0xc3, 0x7f, 0xfe, 0x0f, 0x7f,
+	// '"'
+	0x03, 0x31, 0x03, 0xf8, 0x8f, 0x03, 0x00, 0xfe, 0xe3,
+	// '#'
+	0x42, 0x11, 0x08, 0x60, 0x06, 0x60, 0x06, 0xff, 0xff, 0xff, 0xff, 0x60, 0x06, 0x60, 0x06, 0xff, 0xff, 0xff, 0xff, 0x60, 0x06, 0x60, 0x06,
+	// '$'
+	0x03, 0x11, 0x08, 0x78, 0x0e, 0x78, 0x1f, 0x18, 0x33, 0x1f, 0xf3, 0x1f, 0xf3, 0x98, 0x31, 0xf0, 0x39, 0xe0, 0x38,
+	// '%'
+	0x22, 0x99, 0x06, 0x30, 0x0e, 0x26, 0x82, 0x45, 0xb0, 0xe8, 0xe4, 0xa2, 0x41, 0x34, 0x88, 0x0c, 0x8e, 0x01,
+	// '&'
+	0x23, 0x99, 0x05, 0x1e, 0xf0, 0xdd, 0xfc, 0xe6, 0xbc, 0xe3, 0x0f, 0x7b, 0x78, 0xc7, 0x33, 0x00,
+	// '''
+	0x66, 0x30, 0x03, 0xf8, 0x8f, 0x03,
+	// '('
+	0x86, 0x0c, 0x08, 0xe0, 0x07, 0xfc, 0x3f, 0x1f, 0xf8, 0x03, 0xc0,
+	// ')'
+	0x84, 0x0c, 0x08, 0x03, 0xc0, 0x1f, 0xf8, 0xfc, 0x3f, 0xe0, 0x07,
+	// '*'
+	0x03, 0xa9, 0x04, 0x30, 0x66, 0x7c, 0xf0, 0xef, 0xff, 0xc3, 0x0c, 0x18,
+	// '+'
+	0x42, 0x1d, 0x05, 0x30, 0xc0, 0x00, 0x03, 0x0c, 0xff, 0xff, 0x0f, 0x03, 0x0c, 0x30, 0xc0, 0x00,
+	// ','
+	0x85, 0x0c, 0x03, 0x87, 0x8f, 0x83,
+	// '-'
+	0x22, 0x2d, 0x01, 0xff, 0xff, 0x03,
+	// '.'
+	0x66, 0x98, 0x01, 0xff, 0x01,
+	// '/'
+	0x03, 0x11, 0x08, 0x03, 0x00, 0x1f, 0x00, 0x7c, 0x00, 0xe0, 0x01, 0x80, 0x07, 0x00, 0x3e, 0x00, 0xf8, 0x00, 0xc0,
+	// '0'
+	0x22, 0x99, 0x06, 0xf8, 0xc3, 0xff, 0x1d, 0xf0, 0x01, 0x3c, 0x80, 0x07, 0xf0, 0x01, 0xf7, 0x7f, 0xf8, 0x03,
+	// '1'
+	0x03, 0x99, 0x06, 0x03, 0x6c, 0x80, 0x0d, 0xb0, 0xff, 0xff, 0xff, 0x07, 0xc0, 0x00, 0x18, 0x00,
+	// '2'
+	0x22, 0x99, 0x06, 0x03, 0xe6, 0xc0, 0x3d, 0xf0, 0x0d, 0x3c, 0x83, 0xc7, 0xf0, 0x30, 0x1f, 0x7c, 0x03, 0x07,
+	// '3'
+	0x41, 0x99, 0x06, 0x06, 0xe0, 0x80, 0x0d, 0xb0, 0x01, 0x3c, 0x8c, 0x87, 0xf1, 0x30, 0x3e, 0xef, 0xfe, 0x8f, 0xe7, 0x00,
+	// '4'
+	0x22, 0x99, 0x06, 0x38, 0x00, 0x0f, 0x60, 0x07, 0xcc, 0xb1, 0xe1, 0x36, 0xf8, 0xff, 0xff, 0xff, 0x1b, 0x00,
+	// '5'
+	0x22, 0x99, 0x06, 0x06, 0xe0, 0xf8, 0x0f, 0xff, 0xc1, 0x3c, 0x98, 0x07, 0xf3, 0x71, 0xf6, 0xc7, 0x7c, 0x00,
+	// '6'
+	0x22, 0x99, 0x06, 0xf8, 0xc1, 0xff, 0x98, 0xbd, 0x61, 0x36, 0xcc, 0x87, 0xf1, 0x39, 0xf6, 0xc3, 0x3c, 0x18,
+	// '7'
+	0x22, 0x99, 0x06, 0x00, 0x1c, 0x80, 0x03, 0x60, 0x00, 0x7c, 0x80, 0x7f, 0x30, 0x7e, 0x06, 0xfe, 0x00, 0x1e,
+	// '8'
+	0x22, 0x99, 0x06, 0x3c, 0xc7, 0xff, 0x9d, 0xf7, 0x61, 0x3c, 0x8c, 0x87, 0xf1, 0x79, 0xf7, 0x7f, 0x3c, 0x07,
+	// '9'
+	0x22, 0x99, 0x06, 0x83, 0x67, 0xf8, 0x8d, 0xf3, 0x31, 0x7c, 0x86, 0xcd, 0xb0, 0x37, 0xe3, 0x7f, 0xf0, 0x03,
+	// ':'
+	0x66, 0x98, 0x04, 0xc7, 0x8f, 0x1f, 0x07,
+	// ';'
+	0xa5, 0x90, 0x05, 0x07, 0xf0, 0x00, 0xc6, 0x21, 0x0e, 0x70,
+	// '<'
+	0x61, 0x99, 0x05, 0x20, 0x00, 0x01, 0x1c, 0xe0, 0x80, 0x0d, 0xc6, 0x30, 0xc6, 0x60, 0x06, 0x1b, 0xf0, 0x80, 0x01,
+	// '='
+	0x61, 0x25, 0x03, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0x03,
+	// '>'
+	0x62, 0x99, 0x05, 0x03, 0x1e, 0xb0, 0xc1, 0x0c, 0xc6, 0x18, 0xc6, 0x60, 0x03, 0x0e, 0x70, 0x00, 0x01, 0x08, 0x00,
+	// '?'
+	0x03, 0x19, 0x06, 0x00, 0x07, 0xf0, 0x03, 0x3c, 0xc3, 0x73, 0x0c, 0xc6, 0xc0, 0x07, 0x38,
+	// '@'
+	0xe3, 0x14, 0x07, 0xf8, 0x87, 0x01, 0x16, 0x00, 0x85, 0x83, 0x11, 0x61, 0x44, 0x2c, 0xff, 0x00,
+	// 'A'
+	0x81, 0x19, 0x06, 0x03, 0x70, 0x00, 0x1f, 0xbc, 0xc7, 0xf8, 0x8d, 0xf9, 0x18, 0x8e, 0xfd, 0xfb, 0xf1, 0x03, 0x07, 0x30, 0x00,
+	// 'B'
+	0x42, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc6, 0x63, 0x3c, 0xc6, 0xe3, 0x3c, 0x7f, 0xbf, 0xe3, 0x01,
+	// 'C'
+	0x42, 0x19, 0x06, 0xf8, 0xc1, 0x3f, 0x0e, 0x77, 0xe0, 0x03, 0x3c, 0xc0, 0x03, 0x7c, 0x60, 0x0e, 0xcf, 0xf0,
+	// 'D'
+	0x61, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc0, 0x03, 0x3c, 0xc0, 0x03, 0x7c, 0xe0, 0x0e, 0xc7, 0x3f, 0xf8, 0x01,
+	// 'E'
+	0x42, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc6, 0x63, 0x3c, 0xcf, 0xf3, 0x3c, 0xc0, 0x0f, 0xff, 0xf0,
+	// 'F'
+	0x42, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc6, 0x63, 0x3c, 0xcf, 0xf0, 0x0c, 0xc0, 0x00, 0x0f, 0xf0,
+	// 'G'
+	0x62, 0x19, 0x06, 0xf8, 0xe1, 0x7f, 0x06, 0x36, 0xc0, 0x03, 0x3c, 0xc3, 0x33, 0x3c, 0x63, 0x3e, 0xef, 0xf3, 0x30, 0x00,
+	// 'H'
+	0x42, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc6, 0x60, 0x00, 0x06, 0x63, 0xfc, 0xff, 0xff, 0x3f, 0xc0,
+	// 'I'
+	0x03, 0x19, 0x06, 0x03, 0x3c, 0xc0, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc0, 0x03, 0x3c, 0xc0,
+	// 'J'
+	0x62, 0x19, 0x06, 0x3e, 0xe0, 0x03, 0x03, 0x30, 0x00, 0x03, 0x3c, 0xc0, 0x07, 0xec, 0xff, 0xfc, 0x0f, 0xc0, 0x00, 0x0c,
+	// 'K'
+	0x62, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc6, 0xc3, 0x0c, 0x1e, 0x38, 0xef, 0xe1, 0x07, 0x3e, 0xc0, 0x03, 0x0c,
+	// 'L'
+	0x42, 0x19, 0x06, 0x03, 0x3c, 0xc0, 0xff, 0xff, 0xff, 0x03, 0x3c, 0xc0, 0x03, 0x30, 0x00, 0x1f, 0xf0, 0x01,
+	// 'M'
+	0x81, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xf0, 0xe3, 0x81, 0x07, 0x78, 0x30, 0x1e, 0x03, 0xff, 0xff, 0xff, 0x3f, 0xc0,
+	// 'N'
+	0x42, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0x78, 0xe3, 0x81, 0xc7, 0x1e, 0xfc, 0xff, 0xff, 0x0f, 0xc0,
+	// 'O'
+	0x42, 0x19, 0x06, 0xf8, 0xc1, 0x3f, 0x0e, 0x77, 0xe0, 0x03, 0x3c, 0xc0, 0x07, 0xee, 0x70, 0xfc, 0x83, 0x1f,
+	// 'P'
+	0x42, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc3, 0x33, 0x3c, 0xc3, 0x30, 0x0c, 0xe7, 0xe0, 0x07, 0x3c,
+	// 'Q'
+	0x42, 0x8d, 0x07, 0xc0, 0x0f, 0xf0, 0xcf, 0x1c, 0xee, 0x07, 0xee, 0x01, 0xf6, 0x00, 0xff, 0xc0, 0xe7, 0x70, 0xe7, 0x1f, 0xe3, 0x07,
+	// 'R'
+	0x62, 0x19, 0x06, 0x03, 0xfc, 0xff, 0xff, 0x3f, 0xc6, 0x63, 0x0c, 0xc6, 0x70, 0xcc, 0xef, 0xde, 0x77, 0x38, 0x03, 0x00,
+	// 'S'
+	0x42, 0x19, 0x06, 0x8f, 0xf3, 0x7c, 0xc6, 0x3e, 0xc6, 0x63, 0x3c, 0xc6, 0x63, 0x7c, 0x63, 0x3e, 0xcf, 0xf1,
+	// 'T'
+	0x42, 0x19, 0x06, 0x80, 0x0f, 0xf8, 0x03, 0x3c, 0xc0, 0xff, 0xff, 0xff, 0x03, 0x3c, 0xc0, 0x80, 0x0f, 0xf8,
+	// 'U'
+	0x42, 0x19, 0x06, 0x00, 0xcc, 0xff, 0xfe, 0x7f, 0xc0, 0x03, 0x30, 0x00, 0x07, 0xec, 0xff, 0xfc, 0x0f, 0xc0,
+	// 'V'
+	0x61, 0x19, 0x06, 0x00, 0x0c, 0xf0, 0xc0, 0x8f, 0xcf, 0x3f, 0x70, 0x00, 0x3f, 0x80, 0xcf, 0xc0, 0x0f, 0xf0, 0x00, 0x0c,
+	// 'W'
+	0xa1, 0x19, 0x06, 0x00, 0x0c, 0xfe, 0xff, 0xff, 0xc0, 0x3e, 0x0c, 0x1f, 0xc0, 0x01, 0x1f, 0x3e, 0xfc, 0xc0, 0xff, 0x0f, 0xfe, 0x00, 0x0c,
+	// 'X'
+	0x61, 0x19, 0x06, 0x03, 0x7c, 0xe0, 0x0f, 0xbf, 0xd9, 0xf0, 0x00, 0x06, 0xf0, 0xb0, 0xd9, 0x0f, 0x7f, 0xe0, 0x03, 0x0c,
+	// 'Y'
+	0x42, 0x19, 0x06, 0x00, 0x0c, 0xe0, 0x03, 0x3f, 0xdc, 0xff, 0xf0, 0x0f, 0xc3, 0x3d, 0xf0, 0x00, 0x0e, 0xc0,
+	// 'Z'
+	0x03, 0x19, 0x06, 0x07, 0xff, 0xf0, 0x1b, 0x3c, 0xc7, 0xe3, 0x3c, 0xd8, 0x0f, 0xff, 0xe0,
+	// '['
+	0x86, 0x0c, 0x08, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	// '\'
+	0x03, 0x11, 0x08, 0x00, 0xc0, 0x00, 0xf8, 0x00, 0x3e, 0x80, 0x07, 0xe0, 0x01, 0x7c, 0x00, 0x1f, 0x00, 0x03, 0x00,
+	// ']'
+	0x84, 0x0c, 0x08, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff,
+	// '^'
+	0x22, 0x35, 0x03, 0x83, 0xc1, 0x60, 0x30, 0xc6, 0x18, 0x03,
+	// '_'
+	0xc0, 0x01, 0x01, 0xff, 0xff, 0xff, 0x0f,
+	// '`'
+	0x85, 0xc0, 0x01, 0x94, 0x02,
+	// 'a'
+	0x42, 0x99, 0x04, 0x0e, 0x3e, 0xed, 0x9e, 0x3d, 0x7b, 0xb6, 0xed, 0xff, 0xff, 0x06, 0x00,
+	// 'b'
+	0x61, 0x99, 0x06, 0x03, 0xf8, 0xff, 0xff, 0x7f, 0x63, 0x30, 0x18, 0x06, 0xc3, 0x60, 0x18, 0x0c, 0xc6, 0xc0, 0x1f, 0xe0, 0x00,
+	// 'c'
+	0x42, 0x99, 0x04, 0x3c, 0xfc, 0x1d, 0x1b, 0x3c, 0x78, 0xf0, 0xe0, 0x41, 0xe6, 0xcd, 0x03,
+	// 'd'
+	0x62, 0x99, 0x06, 0x3c, 0xc0, 0x1f, 0x18, 0x83, 0xc1, 0x30, 0x18, 0x06, 0xc3, 0x60, 0x30, 0xc6, 0xff, 0xff, 0xff, 0x0f, 0x00,
+	// 'e'
+	0x42, 0x99, 0x04, 0x38, 0xfc, 0xd9, 0x9b, 0x3d, 0x7b, 0xf6, 0xec, 0x79, 0xf6, 0x6c, 0x00,
+	// 'f'
+	0x23, 0x99, 0x06, 0x83, 0x61, 0x30, 0xfc, 0xbf, 0xff, 0x3f, 0x98, 0x07, 0xf3, 0x60, 0x1e, 0xcc, 0x00, 0x18,
+	// 'g'
+	0x62, 0x89, 0x06, 0x80, 0x03, 0xfc, 0x8d, 0xb1, 0x19, 0x3c, 0x83, 0x67, 0xf0, 0x0c, 0x3e, 0x63, 0xfe, 0x9f, 0xff, 0x03, 0x60,
+	// 'h'
+	0x42, 0x99, 0x06, 0x03, 0xf8, 0xff, 0xff, 0xff, 0x61, 0x00, 0x18, 0x00, 0xc3, 0x60, 0xf8, 0x0f, 0xff, 0x60, 0x00, 0x00,
+	// 'i'
+	0x03, 0x99, 0x06, 0x83, 0x61, 0x30, 0x0c, 0x86, 0xff, 0xfc, 0x9f, 0x07, 0xc0, 0x00, 0x18, 0x00,
+	// 'j'
+	0x02, 0x89, 0x08, 0x03, 0x00, 0x06, 0x30, 0x0c, 0x60, 0x18, 0xc0, 0x30, 0x80, 0xf9, 0x00, 0xb3, 0xff, 0x07, 0xfe, 0x0f,
+	// 'k'
+	0x42, 0x99, 0x06, 0x03, 0xf8, 0xff, 0xff, 0x7f, 0x18, 0x80, 0x1f, 0x9e, 0xc3, 0x61, 0x18, 0x0c, 0x83, 0x61, 0x00, 0x00,
+	// 'l'
+	0x03, 0x99, 0x06, 0x03, 0x78, 0x00, 0x0f, 0xe0, 0xff, 0xff, 0xff, 0x07, 0xc0, 0x00, 0x18, 0x00,
+	// 'm'
+	0x81, 0x99, 0x04, 0x83, 0xff, 0xff, 0x1f, 0x0c, 0xf8, 0xff, 0xbf, 0xc1, 0x80, 0xff, 0xff, 0x1b, 0x00,
+	// 'n'
+	0x42, 0x99, 0x04, 0x83, 0xff, 0xff, 0x1f, 0x06, 0x18, 0xf0, 0xe0, 0xff, 0xff, 0x06, 0x00,
+	// 'o'
+	0x42, 0x99, 0x04, 0x38, 0xfc, 0x19, 0x1b, 0x3c, 0x78, 0xf0, 0x60, 0x63, 0xfe, 0x70, 0x00,
+	// 'p'
+	0x61, 0x89, 0x06, 0x03, 0xf8, 0xff, 0xff, 0xff, 0x31, 0x36, 0x83, 0x61, 0x30, 0x0c, 0x86, 0xc1, 0x60, 0x0c, 0xfc, 0x01, 0x0e,
+	// 'q'
+	0x62, 0x89, 0x06, 0x80, 0x03, 0xfc, 0x81, 0x31, 0x18, 0x0c, 0x83, 0x61, 0xf0, 0x0c, 0x1e, 0x63, 0xff, 0xff, 0xff, 0x0f, 0x60,
+	// 'r'
+	0x42, 0x99, 0x04, 0x83, 0x07, 0xff, 0xff, 0x3f, 0x66, 0xd8, 0xe0, 0xc1, 0xc0, 0x81, 0x01,
+	// 's'
+	0x03, 0x99, 0x04, 0xe7, 0xee, 0xcd, 0x9e, 0xbd, 0x79, 0xb3, 0x77, 0xe7,
+	// 't'
+	0x42, 0x19, 0x06, 0x80, 0x01, 0x18, 0xfe, 0xff, 0xff, 0x83, 0x31, 0x18, 0x83, 0x31, 0x18, 0x86, 0x61, 0x00,
+	// 'u'
+	0x42, 0x99, 0x04, 0x80, 0xfd, 0xff, 0x1f, 0x30, 0x60, 0x80, 0xe1, 0xff, 0xff, 0x07, 0x00,
+	// 'v'
+	0x61, 0x99, 0x04, 0x80, 0x81, 0xc3, 0xe7, 0xfd, 0x60, 0xc0, 0x03, 0xde, 0xf0, 0x81, 0x03, 0x06,
+	// 'w'
+	0x61, 0x99, 0x04, 0x80, 0xe1, 0xff, 0x7f, 0xcc, 0x01, 0x0e, 0x87, 0xcf, 0xff, 0xe1, 0x03, 0x06,
+	// 'x'
+	0x42, 0x99, 0x04, 0x83, 0x07, 0x1f, 0x7f, 0x8f, 0x03, 0xc7, 0xfb, 0xe3, 0x83, 0x07, 0x03,
+	// 'y'
+	0x61, 0x89, 0x06, 0x03, 0x78, 0x80, 0x0f, 0xfc, 0xe3, 0xfd, 0x0f, 0xf6, 0xc0, 0x38, 0x00, 0xde, 0x00, 0x1f, 0x80, 0x03, 0x60,
+	// 'z'
+	0x03, 0x99, 0x04, 0xc3, 0x8f, 0x3f, 0xde, 0x3c, 0x7b, 0xfc, 0xf1, 0xc3,
+	// '{'
+	0xc4, 0x0c, 0x08, 0x80, 0x00, 0xc0, 0x01, 0xfe, 0x7f, 0x7f, 0xff, 0x03, 0xc0, 0x03, 0xc0,
+	// '|'
+	0x46, 0x0c, 0x08, 0xff, 0xff, 0xff, 0xff,
+	// '}'
+	0xc3, 0x0c, 0x08, 0x03, 0xc0, 0x03, 0xc0, 0x7f, 0xff, 0xfe, 0x7f, 0xc0, 0x01, 0x80, 0x00,
+	// '~'
+	0x42, 0x29, 0x02, 0x66, 0xcc, 0x7e, 0x33, 0x67
+};
+
+const sPackedFont Font20_Packed = { Font20_Index, Font20_Data };
+
+// Font24, 17 x 24, 94 of 95 glyphs
+static const uint16_t Font24_Index[] =
+{
+	0, 0, 9, 19, 44, 69, 91, 112, 118, 135, 152, 168, 189, 197, 203, 208,
+	236, 258, 280, 304, 326, 350, 374, 396, 418, 440, 462, 471, 484, 510, 523, 549,
+	568, 593, 624, 650, 674, 700, 724, 748, 774, 802, 823, 849, 879, 905, 936, 964,
+	988, 1012, 1041, 1069, 1090, 1114, 1142, 1172, 1205, 1233, 1261, 1284, 1299, 1327, 1342, 1356,
+	1363, 1369, 1389, 1417, 1437, 1465, 1485, 1511, 1540, 1570, 1596, 1622, 1648, 1674, 1699, 1722,
+	1742, 1771, 1800, 1820, 1837, 1863, 1886, 1909, 1930, 1950, 1983, 2000, 2017, 2025, 2042, 2052
+};
+
+static const uint8_t Font24_Data[] =
+{
+	// '!'
+	0x66, 0x9c, 0x07, 0xc3, 0xff, 0xf9, 0xff, 0xf0, 0x1f,
+	// '"'
+	0x04, 0xb9, 0x03, 0xf0, 0x3f, 0x1c, 0x00, 0x80, 0xff, 0xe1,
+	// '#'
+	0x62, 0x19, 0x08, 0x60, 0x06, 0x60, 0x06, 0xff, 0x06, 0xff, 0xff, 0x60, 0xff, 0x60, 0x06, 0xff, 0x06, 0xff, 0xff, 0x60, 0xff, 0x60, 0x06, 0x60,
+	0x06,
+	// '$'
+	0x23, 0x91, 0x09, 0xf0, 0x71, 0x80, 0xcf, 0x07, 0x38, 0x67, 0x60, 0x18, 0xf3, 0xc3, 0xf8, 0x1f, 0xc7, 0xc3, 0x99, 0x03, 0xfc, 0x3c, 0xc0, 0xe3,
+	0x01,
+	// '%'
+	0x43, 0x9d, 0x07, 0x40, 0x1e, 0xa0, 0x1f, 0xff, 0xdc, 0x3f, 0x7c, 0x1e, 0x1e, 0x9e, 0x0f, 0xff, 0xce, 0x3f, 0x7e, 0x01, 0x9e, 0x00,
+	// '&'
+	0x63, 0x9d, 0x06, 0x1c, 0xc0, 0xe7, 0xcc, 0xbf, 0x71, 0x3c, 0x87, 0x77, 0xf0, 0x07, 0xf7, 0xe0, 0x3f, 0x78, 0x06, 0xcc, 0x00,
+	// '''
+	0x66, 0xb8, 0x03, 0xf0, 0x3f, 0x1c,
+	// '('
+	0xc7, 0x10, 0x09, 0xc0, 0x0f, 0xc0, 0xff, 0xc1, 0xff, 0x8f, 0x0f, 0x7c, 0x0f, 0xc0, 0x0f, 0x00, 0x0c,
+	// ')'
+	0xc3, 0x10, 0x09, 0x03, 0x00, 0x3f, 0x00, 0xef, 0x03, 0x1f, 0xff, 0x3f, 0xf8, 0x3f, 0x00, 0x3f, 0x00,
+	// '*'
+	0x43, 0x31, 0x05, 0x60, 0x80, 0x31, 0xc7, 0x0f, 0xfc, 0xf3, 0xff, 0xc3, 0x1c, 0x60, 0x80, 0x01,
+	// '+'
+	0x82, 0x21, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0xf0, 0xff, 0xff, 0x0f, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06,
+	// ','
+	0xa6, 0x8c, 0x03, 0x83, 0x0f, 0x1f, 0x0e, 0x04,
+	// '-'
+	0x43, 0x35, 0x01, 0xff, 0xff, 0x0f,
+	// '.'
+	0x86, 0x9c, 0x01, 0xff, 0x0f,
+	// '/'
+	0x43, 0x11, 0x0a, 0x07, 0x00, 0xf0, 0x01, 0x00, 0x7c, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x07, 0x00, 0xe0, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x3e, 0x00,
+	0x80, 0x0f, 0x00, 0xe0,
+	// '0'
+	0x43, 0x9d, 0x07, 0xf0, 0x07, 0xfe, 0x8f, 0x03, 0x6e, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x0f, 0x80, 0x1d, 0x70, 0xfc, 0x1f, 0xf8, 0x03,
+	// '1'
+	0x43, 0x9d, 0x07, 0x03, 0x98, 0x01, 0xcc, 0x00, 0x6e, 0x00, 0xf6, 0xff, 0xfb, 0xff, 0x0f, 0x00, 0x06, 0x00, 0x03, 0x80, 0x01, 0x00,
+	// '2'
+	0x62, 0x9d, 0x07, 0x03, 0x9c, 0x03, 0xde, 0x03, 0x6c, 0x03, 0x3c, 0x03, 0x1e, 0x03, 0x8f, 0x81, 0x87, 0xc1, 0x83, 0xb1, 0x81, 0xdf, 0x80, 0x03,
+	// '3'
+	0x43, 0x9d, 0x07, 0x06, 0x80, 0x03, 0xd8, 0x00, 0x6c, 0x30, 0x3c, 0x18, 0x1e, 0x0c, 0x0f, 0xcf, 0x8d, 0x7d, 0x7e, 0x1c, 0x1e, 0x00,
+	// '4'
+	0x62, 0x9d, 0x07, 0x38, 0x00, 0x3c, 0x00, 0x76, 0x00, 0xf3, 0xb0, 0xe1, 0xd8, 0xc0, 0x6d, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xc0, 0x06, 0x00,
+	// '5'
+	0x62, 0x9d, 0x07, 0x06, 0x00, 0xc3, 0xff, 0xe0, 0x7f, 0x30, 0x3c, 0x30, 0x1e, 0x18, 0x0f, 0x8c, 0x07, 0xc6, 0x86, 0x61, 0xff, 0x30, 0x1e, 0x00,
+	// '6'
+	0x43, 0x9d, 0x07, 0xf8, 0x03, 0xff, 0x87, 0x31, 0x67, 0x30, 0x37, 0x18, 0x1b, 0x0c, 0x0f, 0x86, 0x8f, 0xc1, 0xfe, 0x60, 0x1e, 0x30,
+	// '7'
+	0x43, 0x9d, 0x07, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x18, 0x00, 0x7c, 0x00, 0xfe, 0x01, 0xf3, 0x87, 0xc1, 0xdf, 0x00, 0x7f, 0x00, 0x3c,
+	// '8'
+	0x43, 0x9d, 0x07, 0x3c, 0x1c, 0x3f, 0xdf, 0xf1, 0x7c, 0x30, 0x3c, 0x18, 0x1e, 0x0c, 0x0f, 0x86, 0x8f, 0xe7, 0x7e, 0x3e, 0x1e, 0x0e,
+	// '9'
+	0x43, 0x9d, 0x07, 0x03, 0x9e, 0xc1, 0xdf, 0x60, 0x7c, 0x18, 0x3c, 0x0c, 0x36, 0x06, 0x3b, 0x83, 0x39, 0x63, 0xf8, 0x3f, 0xf0, 0x07,
+	// ':'
+	0x86, 0x9c, 0x05, 0x07, 0x3f, 0xf8, 0xc1, 0x0f, 0x0e,
+	// ';'
+	0xc6, 0x94, 0x06, 0x03, 0xc0, 0x03, 0xf0, 0x70, 0x18, 0x0e, 0xc2, 0x01, 0x38,
+	// '<'
+	0xc0, 0x9d, 0x06, 0x40, 0x00, 0x08, 0x80, 0x03, 0x70, 0x00, 0x1b, 0x60, 0x03, 0xc6, 0xc0, 0x18, 0x0c, 0x86, 0xc1, 0x18, 0xb0, 0x03, 0x3e, 0x80,
+	0x07, 0x30,
+	// '='
+	0xa1, 0x2d, 0x03, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0x33,
+	// '>'
+	0xc1, 0x9d, 0x06, 0x03, 0x78, 0x00, 0x1f, 0x70, 0x03, 0xc6, 0x60, 0x18, 0x0c, 0xc6, 0xc0, 0x18, 0xb0, 0x01, 0x36, 0x80, 0x03, 0x70, 0x00, 0x04,
+	0x80, 0x00,
+	// '?'
+	0x23, 0x1d, 0x07, 0x00, 0x0e, 0x80, 0x37, 0x00, 0xcf, 0xc1, 0x73, 0x30, 0x38, 0x0c, 0x9c, 0x03, 0x7e, 0x00, 0x0f,
+	// '@'
+	0x43, 0x95, 0x08, 0xf0, 0x1f, 0xf8, 0xff, 0x38, 0x80, 0x3b, 0x00, 0x3e, 0x78, 0x78, 0xf8, 0xf1, 0x18, 0xe7, 0x31, 0xec, 0xe6, 0xff, 0xcc, 0xff,
+	0x00,
+	// 'A'
+	0x00, 0x1e, 0x07, 0x03, 0xc0, 0x00, 0x70, 0x00, 0x7c, 0xc0, 0x7b, 0xf0, 0x7c, 0x0c, 0x7b, 0xc3, 0xf8, 0x30, 0xf8, 0x8c, 0x37, 0x7f, 0xcc, 0x07,
+	0x3f, 0xc0, 0x03, 0x30, 0x00, 0x0c, 0x00,
+	// 'B'
+	0xa1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x70, 0x3e, 0xfe, 0xf9, 0x3d,
+	0x3c, 0x00,
+	// 'C'
+	0x82, 0x1d, 0x07, 0xf0, 0x03, 0xff, 0xe3, 0xc0, 0x19, 0x60, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x01, 0xe6, 0xe0, 0x33, 0xf8,
+	// 'D'
+	0xa1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x01, 0xe6, 0xc0, 0xf1, 0x3f,
+	0xf0, 0x03,
+	// 'E'
+	0x81, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0x30, 0x3c, 0x3f, 0xcf, 0xcf, 0x03, 0xf0, 0x00, 0xfc, 0xe1, 0x7f, 0xf8,
+	// 'F'
+	0x82, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0x30, 0x3c, 0x3f, 0xcf, 0xcf, 0x00, 0x30, 0x00, 0x0c, 0xe0, 0x03, 0xf8,
+	// 'G'
+	0xa2, 0x1d, 0x07, 0xf8, 0x03, 0xff, 0xe3, 0xc0, 0x19, 0x60, 0x03, 0xf0, 0x00, 0x3c, 0x06, 0x8f, 0xc1, 0x63, 0xf0, 0x19, 0xe6, 0xe7, 0xfb, 0xf9,
+	0x60, 0x00,
+	// 'H'
+	0xc1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0x30, 0x0c, 0x0c, 0x00, 0x03, 0xc3, 0xf0, 0x30, 0xfc, 0xff, 0xff, 0xff,
+	0x03, 0xf0, 0x00, 0x0c,
+	// 'I'
+	0x43, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x0c,
+	// 'J'
+	0xa2, 0x1d, 0x07, 0x7e, 0x80, 0x1f, 0x30, 0x00, 0x0c, 0xc0, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x1b, 0xc0, 0xfe, 0x3f, 0xfe, 0x0f, 0x00, 0x03, 0xc0,
+	0x00, 0x30,
+	// 'K'
+	0xe1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x63, 0xf0, 0x30, 0x3c, 0x1c, 0x83, 0x0f, 0x70, 0x06, 0x0f, 0xff, 0x81, 0x1f, 0xc0,
+	0x03, 0xf0, 0x00, 0x3c, 0x00, 0x00,
+	// 'L'
+	0xa1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x03, 0xc0, 0x00, 0x30, 0x00, 0xfc, 0x00,
+	0x3f, 0x00,
+	// 'M'
+	0x00, 0x1e, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x03, 0xde, 0xe0, 0x31, 0x1e, 0xc0, 0x01, 0x70, 0xc0, 0x78, 0x30, 0x78, 0x0c, 0x78,
+	0xff, 0xff, 0xff, 0x3f, 0x00, 0x0f, 0xc0,
+	// 'N'
+	0xc1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x03, 0xce, 0xe0, 0x31, 0x3c, 0xc0, 0xc3, 0x78, 0x30, 0x07, 0xfc, 0xff, 0xff, 0xff,
+	0x00, 0x30, 0x00, 0x0c,
+	// 'O'
+	0x82, 0x1d, 0x07, 0xf0, 0x03, 0xff, 0xe3, 0xe1, 0x19, 0x60, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x06, 0x98, 0x87, 0xc7, 0xff, 0xc0, 0x0f,
+	// 'P'
+	0x82, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x63, 0xf0, 0x18, 0x3c, 0x06, 0x8f, 0xc1, 0x60, 0x30, 0x30, 0x0e, 0xfc, 0x01, 0x3c,
+	// 'Q'
+	0x82, 0x91, 0x08, 0x80, 0x1f, 0xc0, 0xff, 0xcc, 0xc3, 0xfb, 0x01, 0xe6, 0x01, 0xd8, 0x03, 0xb0, 0x07, 0x60, 0x0f, 0xc0, 0x33, 0xc0, 0xe6, 0xe1,
+	0x9d, 0xff, 0x31, 0xfc, 0x00,
+	// 'R'
+	0xc1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x83, 0xc3, 0xf0, 0x30, 0x6f, 0xee, 0xf9, 0x1d, 0x3c,
+	0x03, 0xc0, 0x00, 0x00,
+	// 'S'
+	0x43, 0x1d, 0x07, 0x1f, 0xcf, 0xe7, 0x67, 0x98, 0x0f, 0xc7, 0xc3, 0xf0, 0x30, 0x3c, 0x0e, 0x9f, 0x61, 0x7e, 0x3e, 0x8f, 0x0f,
+	// 'T'
+	0x82, 0x1d, 0x07, 0x00, 0x3f, 0xc0, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x0c, 0xf0, 0x03, 0xfc,
+	// 'U'
+	0xc1, 0x1d, 0x07, 0x00, 0x30, 0x00, 0x8c, 0xff, 0xfb, 0xff, 0x06, 0xf0, 0x00, 0x3c, 0x00, 0x0c, 0x00, 0x03, 0xb0, 0x01, 0xec, 0xff, 0xe3, 0xff,
+	0x00, 0x30, 0x00, 0x0c,
+	// 'V'
+	0xe1, 0x1d, 0x07, 0x00, 0x30, 0x00, 0x0c, 0x80, 0x03, 0xfc, 0xc0, 0x37, 0x3e, 0xec, 0x03, 0x1f, 0x00, 0x3e, 0x30, 0x3e, 0x0c, 0x7c, 0x03, 0xfc,
+	0x00, 0x38, 0x00, 0x0c, 0x00, 0x03,
+	// 'W'
+	0x20, 0x1e, 0x07, 0x00, 0x30, 0x00, 0x0c, 0xe0, 0xc3, 0xff, 0xff, 0xf1, 0x07, 0xcc, 0x07, 0x83, 0x07, 0x80, 0x03, 0x7c, 0xc0, 0x07, 0x7f, 0xc0,
+	0xff, 0x31, 0xfc, 0x0f, 0xe0, 0x03, 0xc0, 0x00, 0x30,
+	// 'X'
+	0xc1, 0x1d, 0x07, 0x03, 0xf0, 0x00, 0x7c, 0x80, 0x3f, 0xf0, 0x1b, 0xf6, 0xcc, 0x0c, 0x1e, 0x80, 0x07, 0x33, 0xf3, 0x86, 0xfd, 0xc0, 0x1f, 0xe0,
+	0x03, 0xf0, 0x00, 0x0c,
+	// 'Y'
+	0xc1, 0x1d, 0x07, 0x00, 0x30, 0x00, 0x0c, 0x80, 0x0f, 0xf0, 0x03, 0xf7, 0xe0, 0xf0, 0x0f, 0xfc, 0x03, 0x83, 0xf3, 0xc0, 0x3d, 0xc0, 0x03, 0xe0,
+	0x00, 0x30, 0x00, 0x0c,
+	// 'Z'
+	0x62, 0x1d, 0x07, 0x07, 0xc0, 0xc3, 0xbf, 0xf1, 0xcf, 0xc0, 0x63, 0xf0, 0x30, 0x3c, 0x18, 0x0f, 0xcc, 0x03, 0xf6, 0x0f, 0xff, 0x83, 0x03,
+	// '['
+	0xa7, 0x10, 0x09, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf0, 0x00, 0xc0, 0x03, 0x00, 0x03,
+	// '\'
+	0x43, 0x11, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0xf8, 0x00, 0xe0, 0x03, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x78, 0x00, 0xf0, 0x01, 0xc0, 0x07, 0x00, 0x1f,
+	0x00, 0x70, 0x00, 0x00,
+	// ']'
+	0xa4, 0x10, 0x09, 0x03, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03,
+	// '^'
+	0x63, 0x3d, 0x04, 0x03, 0x06, 0x1c, 0x38, 0x70, 0xe0, 0x70, 0x38, 0x1c, 0x06, 0x03,
+	// '_'
+	0x00, 0x02, 0x01, 0xff, 0xff, 0xff, 0xff,
+	// '`'
+	0xa6, 0x4c, 0x02, 0xcc, 0x36, 0x03,
+	// 'a'
+	0x82, 0x9d, 0x05, 0x1c, 0xf0, 0xd1, 0x8c, 0xc7, 0x3c, 0xe6, 0x31, 0x8f, 0xd9, 0xcc, 0xff, 0xfb, 0xcf, 0x00, 0x06, 0x00,
+	// 'b'
+	0xa1, 0x9d, 0x07, 0x03, 0xe0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0x6f, 0x30, 0x18, 0x30, 0x0c, 0x18, 0x06, 0x0c, 0x03, 0x86, 0x01, 0x83, 0xc1, 0xc0,
+	0x7f, 0x80, 0x0f, 0x00,
+	// 'c'
+	0x82, 0x9d, 0x05, 0xf8, 0xe0, 0x8f, 0xe3, 0x0c, 0x36, 0xe0, 0x01, 0x0f, 0x78, 0xc0, 0x03, 0x3e, 0x98, 0xf3, 0x99, 0x0f,
+	// 'd'
+	0xa2, 0x9d, 0x07, 0xf8, 0x00, 0xff, 0x81, 0xc1, 0x60, 0xc0, 0x30, 0x60, 0x18, 0x30, 0x0c, 0x18, 0x06, 0xcc, 0x06, 0xe3, 0xff, 0xff, 0xff, 0x7f,
+	0x00, 0x30, 0x00, 0x00,
+	// 'e'
+	0x82, 0x9d, 0x05, 0xf8, 0xf0, 0x9f, 0xd9, 0xc6, 0x3c, 0xe6, 0x31, 0x8f, 0x79, 0xcc, 0x63, 0x1e, 0x9b, 0xf9, 0xcc, 0x01,
+	// 'f'
+	0x82, 0x9d, 0x07, 0x03, 0x86, 0x01, 0xc3, 0x80, 0xe1, 0xff, 0xf3, 0xff, 0x1b, 0x30, 0x0f, 0x98, 0x07, 0xcc, 0x03, 0xe6, 0x01, 0x33, 0x80, 0x19,
+	0x00, 0x0c,
+	// 'g'
+	0xa2, 0x09, 0x08, 0x00, 0x1f, 0xc0, 0x7f, 0xc3, 0x60, 0x63, 0xc0, 0x63, 0xc0, 0x63, 0xc0, 0x63, 0xc0, 0x63, 0xc0, 0xc6, 0x60, 0xfe, 0xff, 0xfc,
+	0xff, 0x00, 0xc0, 0x00, 0xc0,
+	// 'h'
+	0xc1, 0x9d, 0x07, 0x03, 0xe0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0x3f, 0x30, 0x18, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x03, 0x86, 0x81, 0xc3, 0xff, 0xe0,
+	0x3f, 0x30, 0x00, 0x18, 0x00, 0x00,
+	// 'i'
+	0x82, 0x9d, 0x07, 0x03, 0x80, 0x01, 0xc3, 0x80, 0x61, 0xc0, 0x30, 0x60, 0xf8, 0x3f, 0xff, 0x9f, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0x60,
+	0x00, 0x00,
+	// 'j'
+	0x23, 0x09, 0x0a, 0x03, 0xc0, 0x30, 0x00, 0x0c, 0x03, 0xc0, 0x30, 0x00, 0x0c, 0x03, 0xc0, 0x30, 0x00, 0xcc, 0x06, 0xc0, 0xec, 0xff, 0x0f, 0xfc,
+	0xff, 0x00,
+	// 'k'
+	0x82, 0x9d, 0x07, 0x03, 0xe0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0x0f, 0x07, 0xc0, 0x07, 0x70, 0x1f, 0x1e, 0x0e, 0x07, 0x86, 0x01, 0xc3, 0x80, 0x61,
+	0x00, 0x00,
+	// 'l'
+	0x82, 0x9d, 0x07, 0x03, 0x80, 0x01, 0xf0, 0x00, 0x78, 0x00, 0x3c, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0x60,
+	0x00, 0x00,
+	// 'm'
+	0x00, 0x9e, 0x05, 0x03, 0x1e, 0xf0, 0xff, 0xff, 0x3f, 0xb0, 0x01, 0x03, 0xf8, 0xff, 0xff, 0x1b, 0xf8, 0x80, 0x01, 0xfc, 0xff, 0xff, 0x0d, 0x60,
+	0x00,
+	// 'n'
+	0xc1, 0x9d, 0x05, 0x03, 0x1e, 0xf0, 0xff, 0xff, 0x3f, 0xb0, 0x01, 0x03, 0x18, 0xc0, 0x03, 0x1e, 0xf8, 0xff, 0xfe, 0x33, 0x80, 0x01, 0x00,
+	// 'o'
+	0x82, 0x9d, 0x05, 0xf8, 0xe0, 0x8f, 0xe3, 0x0c, 0x36, 0xe0, 0x01, 0x0f, 0x78, 0xc0, 0x06, 0x73, 0x1c, 0x7f, 0xf0, 0x01,
+	// 'p'
+	0xa1, 0x09, 0x08, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x60, 0x63, 0xc0, 0x63, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0xc0,
+	0x60, 0xc0, 0x7f, 0x00, 0x1f,
+	// 'q'
+	0xa2, 0x09, 0x08, 0x00, 0x1f, 0xc0, 0x7f, 0xc0, 0x60, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x63, 0xc0, 0x63, 0xc0, 0xc3, 0x60, 0xff, 0xff, 0xff,
+	0xff, 0x03, 0xc0, 0x03, 0xc0,
+	// 'r'
+	0x82, 0x9d, 0x05, 0x03, 0x1e, 0xf0, 0x80, 0xff, 0xff, 0xff, 0xc1, 0x0c, 0x6c, 0xe0, 0x03, 0x1e, 0x30, 0xc0, 0x01, 0x06,
+	// 's'
+	0x43, 0x9d, 0x05, 0xcf, 0x79, 0xdf, 0x98, 0xc7, 0x3c, 0xe6, 0x39, 0xcf, 0xf8, 0xc6, 0xbe, 0xe7, 0x3c,
+	// 't'
+	0x82, 0x9d, 0x07, 0x00, 0x06, 0x00, 0x03, 0xff, 0xdf, 0xff, 0x3f, 0x60, 0x18, 0x30, 0x0c, 0x18, 0x06, 0x0c, 0x03, 0x86, 0x03, 0x83, 0x01, 0xc0,
+	0x00, 0x00,
+	// 'u'
+	0xc1, 0x9d, 0x05, 0x00, 0x06, 0x30, 0xff, 0xfd, 0x3f, 0x80, 0x01, 0x0c, 0x60, 0x00, 0x03, 0x36, 0xf0, 0xff, 0xff, 0x3f, 0x80, 0x01, 0x00,
+	// 'v'
+	0xc1, 0x9d, 0x05, 0x00, 0x06, 0x30, 0xe0, 0xc1, 0xcf, 0xe7, 0x0f, 0x1c, 0xe0, 0x00, 0x1f, 0xe0, 0x33, 0xf8, 0x01, 0x0f, 0x60, 0x00, 0x03,
+	// 'w'
+	0xa1, 0x9d, 0x05, 0x00, 0x06, 0x3e, 0xff, 0x7f, 0xfc, 0x01, 0x7c, 0x00, 0x07, 0x1f, 0x1f, 0xf8, 0x31, 0xfe, 0x81, 0x0f, 0x60,
+	// 'x'
+	0x82, 0x9d, 0x05, 0x03, 0x1e, 0xf0, 0xc1, 0x1f, 0xbf, 0x6d, 0x38, 0xc0, 0x61, 0xdb, 0x8f, 0x3f, 0xf8, 0x80, 0x07, 0x0c,
+	// 'y'
+	0xe1, 0x09, 0x08, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x03, 0xf8, 0x03, 0xde, 0x87, 0xc7, 0xdf, 0x01, 0xfb, 0x00, 0xe3, 0x01, 0x80, 0x07, 0x00,
+	0xde, 0x00, 0xf8, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xc0,
+	// 'z'
+	0x43, 0x9d, 0x05, 0x83, 0x3f, 0xfc, 0x83, 0x37, 0x3c, 0xe3, 0x31, 0x0f, 0x7b, 0xf0, 0x0f, 0x7f, 0x30,
+	// '{'
+	0xc5, 0x10, 0x09, 0x00, 0x01, 0x00, 0x0e, 0xe0, 0xff, 0xdf, 0xbf, 0xff, 0x03, 0x00, 0x0f, 0x00, 0x0c,
+	// '|'
+	0x47, 0x10, 0x09, 0xff, 0xff, 0xff, 0xff, 0x0f,
+	// '}'
+	0xc5, 0x10, 0x09, 0x03, 0x00, 0x0f, 0x00, 0xfc, 0xef, 0xbf, 0xff, 0x7f, 0x80, 0x03, 0x00, 0x04, 0x00,
+	// '~'
+	0x62, 0xad, 0x02, 0xc6, 0x71, 0xcc, 0xdd, 0x19, 0xc7, 0x31
+};
+
+const sPackedFont Font24_Packed = { Font24_Index, Font24_Data };
+
+// Image_LightWidowLogo, 200 x 96, 2400 bytes unpacked
+static const uint8_t Image_LightWidowLogo_Data[] =
+{
+	0x81, 0x00, 0x81, 0x00, 0x85, 0x00, 0x0e, 0x0f, 0x00, 0x80, 0x07, 0x00, 0xff, 0x3f, 0x00, 0x78, 0x00, 0x80, 0x07, 0xfc, 0xff, 0x7f, 0xf7, 0x00,
+	0x0e, 0x0f, 0x00, 0x80, 0x07, 0xc0, 0xff, 0x7f, 0x00, 0x78, 0x00, 0x80, 0x07, 0xfc, 0xff, 0x7f, 0xf7, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xe0,
+	0xff, 0xff, 0x07, 0x01, 0x78, 0x00, 0x80, 0x07, 0xfc, 0xff, 0x7f, 0xf7, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xff, 0xff, 0x07, 0x03, 0x78,
+	0x00, 0x80, 0x07, 0xfc, 0xff, 0x7f, 0xf7, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6,
+	0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0,
+	0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x01, 0x78, 0x00, 0x80, 0x07,
+	0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe, 0x00, 0x05, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00,
+	0x80, 0x07, 0xf0, 0xfe, 0x00, 0x05, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe, 0x00, 0x05, 0x78,
+	0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe, 0x00, 0x05, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00,
+	0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe, 0x00, 0x05, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe,
+	0x00, 0x00, 0xf8, 0xff, 0xff, 0x02, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x02,
+	0x07, 0x00, 0x3c, 0xf6, 0x00, 0x04, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0xfe, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x02, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x08,
+	0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xfe, 0x03, 0xf8, 0xff, 0xff, 0x02, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00,
+	0xfe, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xfe, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00,
+	0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xe0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80,
+	0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00,
+	0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d,
+	0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0,
+	0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c,
+	0xf6, 0x00, 0x0d, 0x0f, 0x00, 0x80, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0xff, 0xff, 0x0b, 0x80, 0x07,
+	0xf0, 0x00, 0xe0, 0x03, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0xff, 0xff, 0x02, 0x80, 0x07, 0xf0, 0xff, 0xff, 0x06, 0x01, 0x78, 0x00,
+	0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00, 0xff, 0xff, 0x02, 0x80, 0x07, 0xc0, 0xff, 0xff, 0x06, 0x00, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0xf6, 0x00,
+	0xff, 0xff, 0x0b, 0x80, 0x07, 0x00, 0xff, 0x3f, 0x00, 0x78, 0x00, 0x80, 0x07, 0x00, 0x3c, 0x81, 0x00, 0xe3, 0x00, 0x07, 0xf0, 0x03, 0xf0, 0x07,
+	0xc0, 0x07, 0x7e, 0x80, 0xff, 0xff, 0x0a, 0x07, 0x00, 0xfc, 0xff, 0x07, 0xf8, 0x01, 0xf0, 0x03, 0xe0, 0x07, 0xfd, 0x00, 0x07, 0xf0, 0x03, 0xf0,
+	0x07, 0xc0, 0x07, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x0f, 0x00, 0xff, 0xff, 0x06, 0x0f, 0xf0, 0x01, 0xf0, 0x07, 0xe0, 0x07, 0xfd, 0x00, 0x07, 0xe0,
+	0x03, 0xf0, 0x07, 0xe0, 0x07, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x3f, 0xc0, 0xff, 0xff, 0x06, 0x3f, 0xf0, 0x03, 0xf0, 0x07, 0xe0, 0x03, 0xfd, 0x00,
+	0x07, 0xe0, 0x03, 0xf0, 0x0f, 0xe0, 0x07, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x3f, 0xc0, 0xff, 0xff, 0x06, 0x3f, 0xf0, 0x03, 0xf8, 0x07, 0xe0, 0x03,
+	0xfd, 0x00, 0x07, 0xe0, 0x03, 0xf0, 0x0f, 0xe0, 0x03, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x3f, 0xc0, 0xff, 0xff, 0x06, 0x3f, 0xe0, 0x03, 0xf8, 0x0f,
+	0xf0, 0x03, 0xfd, 0x00, 0x0b, 0xe0, 0x07, 0xf8, 0x0f, 0xe0, 0x03, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0xff, 0xff, 0x06, 0x3f, 0xe0, 0x03, 0xf8,
+	0x0f, 0xf0, 0x03, 0xfd, 0x00, 0x0b, 0xe0, 0x07, 0xf8, 0x0f, 0xf0, 0x03, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0xff, 0xff, 0x06, 0x3f, 0xe0, 0x03,
+	0xfc, 0x0f, 0xf0, 0x01, 0xfd, 0x00, 0x0b, 0xc0, 0x07, 0xf8, 0x1f, 0xf0, 0x03, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0xff, 0xff, 0x06, 0x3f, 0xe0,
+	0x07, 0xfc, 0x0f, 0xf8, 0x01, 0xfd, 0x00, 0x14, 0xc0, 0x0f, 0xfc, 0x1f, 0xf0, 0x01, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x0f, 0x00, 0x3f, 0xe0,
+	0x07, 0xfc, 0x0f, 0xf8, 0x01, 0xfd, 0x00, 0x13, 0xc0, 0x0f, 0xfc, 0x1f, 0xf0, 0x01, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x0f, 0x00, 0x3f, 0xc0,
+	0x07, 0xfc, 0x1f, 0xf8, 0xfc, 0x00, 0x13, 0x80, 0x0f, 0x7c, 0x3f, 0xf8, 0x01, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x1f, 0x80, 0x3f, 0xc0, 0x0f,
+	0x3e, 0x1f, 0xf8, 0xfc, 0x00, 0x13, 0x80, 0x0f, 0x7c, 0x3f, 0xf8, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x0f, 0x3e,
+	0x1f, 0xf8, 0xfc, 0x00, 0x13, 0x80, 0x1f, 0x7e, 0x3e, 0xf8, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0x80, 0x0f, 0x3e, 0x3f,
+	0xfc, 0xfc, 0x00, 0x01, 0x80, 0x1f, 0xff, 0x3e, 0x0c, 0xf8, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x7f, 0xe0, 0x3f, 0x80, 0x0f, 0xff, 0x3e,
+	0x00, 0xfc, 0xfb, 0x00, 0x12, 0x1f, 0x3e, 0x7e, 0xfc, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0xff, 0xf0, 0x3f, 0x80, 0x1f, 0x3f, 0x3e, 0x7c,
+	0xfb, 0x00, 0x0e, 0x1f, 0x3e, 0x7c, 0xfc, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0xff, 0xf0, 0x3f, 0x80, 0xff, 0x1f, 0x01, 0x3e, 0x7c, 0xfb,
+	0x00, 0x01, 0x1f, 0x3f, 0xff, 0x7c, 0x0a, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x7f, 0xe0, 0x3f, 0x00, 0xff, 0x1f, 0xff, 0x7e, 0xfb, 0x00,
+	0x01, 0x3f, 0x1f, 0xff, 0x7c, 0x0e, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x7f, 0xe0, 0x3f, 0x00, 0x9f, 0x1f, 0x7c, 0x7e, 0xfb, 0x00, 0x12,
+	0x3f, 0x1f, 0xfc, 0x7e, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0x00, 0x9f, 0x1f, 0x7c, 0x3e, 0xfb, 0x00, 0x12, 0xbe, 0x1f,
+	0xf8, 0x7e, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0x00, 0xbf, 0x0f, 0x7c, 0x3f, 0xfb, 0x00, 0x12, 0xfe, 0x0f, 0xf8, 0x3f,
+	0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0xfe, 0x0f, 0xfc, 0x3f, 0xfb, 0x00, 0x12, 0xfe, 0x0f, 0xf8, 0x3f, 0x00, 0x7e,
+	0x80, 0x0f, 0x00, 0x3f, 0xc0, 0x0f, 0x00, 0x3f, 0x00, 0xfe, 0x0f, 0xf8, 0x1f, 0xfb, 0x00, 0x12, 0xfc, 0x0f, 0xf8, 0x3f, 0x00, 0x7e, 0x80, 0x0f,
+	0x00, 0x3f, 0xc0, 0x0f, 0x00, 0x3f, 0x00, 0xfe, 0x07, 0xf8, 0x1f, 0xfb, 0x00, 0x0a, 0xfc, 0x0f, 0xf0, 0x1f, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f,
+	0xc0, 0xff, 0xff, 0x05, 0x3f, 0x00, 0xfe, 0x07, 0xf8, 0x1f, 0xfb, 0x00, 0x0a, 0xfc, 0x07, 0xf0, 0x1f, 0x00, 0x7e, 0x80, 0x0f, 0x00, 0x3f, 0xc0,
+	0xff, 0xff, 0x05, 0x3f, 0x00, 0xfc, 0x07, 0xf8, 0x1f, 0xfb, 0x00, 0x06, 0xfc, 0x07, 0xf0, 0x1f, 0x00, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x3f, 0xc0,
+	0xff, 0xff, 0x05, 0x3f, 0x00, 0xfc, 0x07, 0xf0, 0x1f, 0xfb, 0x00, 0x06, 0xf8, 0x07, 0xe0, 0x1f, 0x00, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x3f, 0xc0,
+	0xff, 0xff, 0x05, 0x3f, 0x00, 0xfc, 0x07, 0xf0, 0x0f, 0xfb, 0x00, 0x06, 0xf8, 0x07, 0xe0, 0x1f, 0x00, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x3f, 0x80,
+	0xff, 0xff, 0x05, 0x3f, 0x00, 0xf8, 0x03, 0xf0, 0x0f, 0xfb, 0x00, 0x06, 0xf8, 0x03, 0xe0, 0x0f, 0x00, 0x7e, 0x80, 0xff, 0xff, 0x01, 0x0f, 0x00,
+	0xff, 0xff, 0x05, 0x0f, 0x00, 0xf8, 0x03, 0xe0, 0x0f, 0xfb, 0x00, 0x06, 0xf8, 0x03, 0xe0, 0x0f, 0x00, 0x7e, 0x80, 0xff, 0xff, 0x09, 0x07, 0x00,
+	0xfe, 0xff, 0x07, 0x00, 0xf8, 0x03, 0xe0, 0x07, 0x81, 0x00, 0x81, 0x00, 0xa0, 0x00
+};
+
+const Canvas_image Image_LightWidowLogo = { 200, 96, sizeof(Image_LightWidowLogo_Data), Image_LightWidowLogo_Data };
+
+// Image_SpiderLogo, 200 x 96, 2400 bytes unpacked
+static const uint8_t Image_SpiderLogo_Data[] =
+{
+	0x81, 0x00, 0xc9, 0x00, 0x00, 0x10, 0xf7, 0x00, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x60, 0xf7, 0x00, 0x00, 0xfe, 0xf4, 0x00, 0x01, 0xc0, 0x01, 0xf8,
+	0x00, 0x01, 0xfe, 0x0f, 0xf4, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xf8, 0x7f, 0xf4, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x02, 0x80, 0xff, 0x01, 0xf5,
+	0x00, 0x00, 0x04, 0xf7, 0x00, 0x01, 0xf8, 0x01, 0xf5, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x01, 0xfe, 0x01, 0xf5, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x01,
+	0xe0, 0xff, 0xf4, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x01, 0xfc, 0x1f, 0xf4, 0x00, 0x00, 0x18, 0xf8, 0x00, 0x01, 0xfe, 0x03, 0xf4, 0x00, 0x00, 0x10,
+	0xfb, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x7e, 0xf3, 0x00, 0x00, 0x30, 0xfb, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x01, 0xfe, 0x01, 0xf4, 0x00, 0x00,
+	0x30, 0xfb, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x01, 0xfc, 0x1f, 0xf7, 0x00, 0x00, 0x06, 0xff, 0x00, 0x00, 0x60, 0xfb, 0x00, 0x00, 0xe0, 0xff, 0x00,
+	0x02, 0xe0, 0xff, 0x01, 0xf9, 0x00, 0x01, 0x80, 0x1f, 0xff, 0x00, 0x00, 0x60, 0xfb, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x01, 0xf8, 0x01, 0xf9, 0x00,
+	0x01, 0xc0, 0x78, 0xff, 0x00, 0x00, 0xe0, 0xfb, 0x00, 0x05, 0xe0, 0xff, 0x3f, 0x00, 0xf8, 0x01, 0xf8, 0x00, 0x03, 0x80, 0x01, 0x00, 0xc0, 0xfb,
+	0x00, 0x05, 0xe0, 0xff, 0x3f, 0x80, 0xff, 0x01, 0xf7, 0x00, 0x02, 0x07, 0x00, 0xc0, 0xfb, 0x00, 0x04, 0xe0, 0xff, 0x3f, 0xf8, 0x7f, 0xf6, 0x00,
+	0x02, 0x1e, 0x00, 0xc0, 0xfb, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x01, 0xfe, 0x0f, 0xf6, 0x00, 0x02, 0x7c, 0x00, 0x60, 0xfb, 0x00, 0x00, 0xe0, 0xff,
+	0x00, 0x00, 0xfe, 0xf5, 0x00, 0x02, 0x70, 0x00, 0x60, 0xff, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x0e, 0xf5, 0x00, 0x04,
+	0xe0, 0x00, 0x30, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0xf2, 0x00, 0x07, 0xc0, 0x00, 0x30, 0x80, 0xff, 0x7f, 0xe0, 0x07, 0xf0, 0x00,
+	0x04, 0x80, 0x01, 0x18, 0xe0, 0x01, 0xff, 0x00, 0x00, 0x1e, 0xf5, 0x00, 0x02, 0xf8, 0xff, 0x7f, 0xff, 0x00, 0x03, 0x80, 0x01, 0x0c, 0x70, 0xfe,
+	0x00, 0x00, 0x70, 0xfd, 0x00, 0x01, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x01, 0xff, 0x00, 0x02, 0x01, 0x04, 0x38, 0xfc, 0x00,
+	0x05, 0xe0, 0xff, 0x3f, 0xfe, 0xff, 0x01, 0xfd, 0x00, 0x00, 0x60, 0xff, 0x00, 0x01, 0xe0, 0x0f, 0xff, 0x00, 0x02, 0x01, 0x06, 0x1e, 0xfc, 0x00,
+	0x05, 0xe0, 0xff, 0x3f, 0xfe, 0xff, 0x01, 0xfd, 0x00, 0x00, 0x18, 0xfe, 0x00, 0x00, 0x38, 0xff, 0x00, 0x02, 0x03, 0x02, 0x0f, 0xfc, 0x00, 0x05,
+	0xe0, 0xff, 0x3f, 0x9e, 0xcf, 0x03, 0xf9, 0x00, 0x05, 0xe0, 0x01, 0x00, 0x03, 0x83, 0x03, 0xfb, 0x00, 0x04, 0x70, 0x00, 0x1e, 0xc7, 0x03, 0xf9,
+	0x00, 0x05, 0x80, 0x07, 0x00, 0x83, 0xe1, 0x01, 0xfb, 0x00, 0x04, 0x70, 0x00, 0x1e, 0xc0, 0x03, 0xf8, 0x00, 0x03, 0x3e, 0x00, 0x86, 0xf1, 0xfa,
+	0x00, 0x04, 0x70, 0x00, 0x1e, 0xc0, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x01, 0xc6, 0x78, 0xfa, 0x00, 0x04, 0x70, 0x00, 0x1e, 0xc7, 0x03, 0xf8, 0x00,
+	0x03, 0xc0, 0x07, 0xee, 0x3e, 0xfa, 0x00, 0x04, 0x70, 0x00, 0x9e, 0xcf, 0x03, 0xf8, 0x00, 0x03, 0x80, 0x3f, 0x7e, 0x1f, 0xfa, 0x00, 0x04, 0x70,
+	0x00, 0xfe, 0xff, 0x03, 0xf7, 0x00, 0x02, 0xfe, 0xff, 0x0f, 0xfa, 0x00, 0x04, 0x70, 0x00, 0xfe, 0xff, 0x01, 0xf7, 0x00, 0x02, 0xf0, 0xff, 0x07,
+	0xfa, 0x00, 0x03, 0x70, 0x00, 0xfc, 0xff, 0xf6, 0x00, 0x02, 0xf0, 0xff, 0x07, 0xfb, 0x00, 0x02, 0xe0, 0xff, 0x3f, 0xf4, 0x00, 0x02, 0xf8, 0xff,
+	0x1f, 0xfb, 0x00, 0x02, 0xe0, 0xff, 0x3f, 0xf4, 0x00, 0x02, 0xfc, 0xff, 0x7f, 0xfb, 0x00, 0x02, 0xe0, 0xff, 0x3f, 0xf4, 0x00, 0x02, 0xfe, 0x7d,
+	0xff, 0xeb, 0x00, 0x02, 0xfe, 0x39, 0xff, 0xeb, 0x00, 0x02, 0xff, 0x01, 0xff, 0xf8, 0x00, 0x01, 0xfc, 0xff, 0xf6, 0x00, 0x02, 0xff, 0x01, 0xff,
+	0xf8, 0x00, 0x02, 0xfe, 0xff, 0x01, 0xf7, 0x00, 0x02, 0xfe, 0x39, 0xff, 0xfb, 0x00, 0x05, 0x80, 0xc1, 0x1f, 0xfe, 0xff, 0x01, 0xf7, 0x00, 0x02,
+	0xfe, 0x7d, 0xff, 0xfb, 0x00, 0x05, 0xc0, 0xc1, 0x3f, 0x0e, 0xc0, 0x01, 0xf7, 0x00, 0x02, 0xfc, 0xff, 0x7f, 0xfb, 0x00, 0x05, 0xe0, 0xc0, 0x30,
+	0x0e, 0xc0, 0x01, 0xf7, 0x00, 0x02, 0xf8, 0xff, 0x3f, 0xfb, 0x00, 0x05, 0x60, 0xc0, 0x30, 0x0e, 0xc0, 0x01, 0xf7, 0x00, 0x02, 0xf0, 0xff, 0x0f,
+	0xfb, 0x00, 0x05, 0x60, 0xc0, 0x30, 0x0e, 0xc0, 0x01, 0xf7, 0x00, 0x02, 0xf0, 0xff, 0x07, 0xfb, 0x00, 0x05, 0x60, 0x00, 0x30, 0x0e, 0xc0, 0x01,
+	0xf7, 0x00, 0x02, 0xf8, 0xff, 0x0f, 0xfb, 0x00, 0x05, 0x60, 0x00, 0x30, 0x0e, 0xc0, 0x01, 0xf7, 0x00, 0xff, 0xfe, 0x00, 0x1f, 0xfb, 0x00, 0x05,
+	0x60, 0x00, 0x30, 0x0e, 0xc0, 0x01, 0xf8, 0x00, 0x03, 0x80, 0x1f, 0x7e, 0x3f, 0xfb, 0x00, 0x05, 0x60, 0x00, 0x30, 0xfe, 0xff, 0x01, 0xf8, 0x00,
+	0x03, 0xe0, 0x03, 0xee, 0x7c, 0xfb, 0x00, 0x05, 0xe0, 0xff, 0x3f, 0xfe, 0xff, 0x01, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0xc6, 0xf8, 0xfb, 0x00, 0x05,
+	0xc0, 0xff, 0x1f, 0xfe, 0xff, 0x01, 0xf8, 0x00, 0x04, 0x1e, 0x00, 0x86, 0xf1, 0x01, 0xfc, 0x00, 0x02, 0x80, 0xff, 0x0f, 0xf6, 0x00, 0x05, 0x80,
+	0x03, 0x00, 0x83, 0xc1, 0x03, 0xee, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x02, 0x03, 0x83, 0x07, 0xf2, 0x00, 0x00, 0x08, 0xfe, 0x00, 0x00, 0x18, 0xff,
+	0x00, 0x02, 0x03, 0x02, 0x0f, 0xf9, 0x00, 0x02, 0xfe, 0xff, 0x01, 0xfd, 0x00, 0x04, 0xf0, 0x01, 0x00, 0xe0, 0x0f, 0xff, 0x00, 0x02, 0x01, 0x06,
+	0x1c, 0xf9, 0x00, 0x02, 0xfe, 0xff, 0x01, 0xfd, 0x00, 0x00, 0x80, 0xfe, 0xff, 0xfe, 0x00, 0x02, 0x01, 0x04, 0x38, 0xfe, 0x00, 0x07, 0x40, 0x00,
+	0xe0, 0xff, 0x3f, 0xfe, 0xff, 0x01, 0xfc, 0x00, 0x02, 0xf0, 0xff, 0x7f, 0xff, 0x00, 0x03, 0x80, 0x01, 0x0c, 0x70, 0xfe, 0x00, 0x07, 0x38, 0x00,
+	0xe0, 0xff, 0x3f, 0xfe, 0xff, 0x01, 0xf7, 0x00, 0x04, 0x80, 0x00, 0x18, 0xc0, 0x03, 0xff, 0x00, 0x04, 0x0f, 0x00, 0xe0, 0xff, 0x3f, 0xf4, 0x00,
+	0x03, 0xc0, 0x00, 0x30, 0x00, 0xfe, 0xff, 0x00, 0x03, 0xf0, 0x00, 0x06, 0xe0, 0x00, 0x60, 0x00, 0xe0, 0xff, 0x01, 0xfc, 0x00, 0x00, 0x02, 0xf5,
+	0x00, 0x02, 0x78, 0x00, 0x60, 0xff, 0x00, 0x00, 0x03, 0xfb, 0x00, 0x00, 0x3e, 0xf5, 0x00, 0x02, 0x3c, 0x00, 0x40, 0xf9, 0x00, 0x02, 0x30, 0xfe,
+	0x01, 0xf6, 0x00, 0x02, 0x0e, 0x00, 0xc0, 0xf9, 0x00, 0x02, 0x30, 0xfe, 0x1f, 0xf7, 0x00, 0x03, 0x80, 0x03, 0x00, 0xc0, 0xf9, 0x00, 0x03, 0x30,
+	0xe0, 0xff, 0x01, 0xf8, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xc0, 0xf9, 0x00, 0x03, 0x30, 0x00, 0xfe, 0x01, 0xf9, 0x00, 0x01, 0x80, 0x21, 0xff,
+	0x00, 0x00, 0xe0, 0xf9, 0x00, 0x03, 0x30, 0x00, 0xf8, 0x01, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x60, 0xf9, 0x00, 0x03, 0x30, 0x00, 0xff,
+	0x01, 0xf8, 0x00, 0x00, 0x18, 0xff, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x04, 0xe0, 0xff, 0x3f, 0xf0, 0x7f, 0xf4, 0x00, 0x00, 0x30, 0xfb, 0x00, 0x04,
+	0xe0, 0xff, 0x3f, 0xfe, 0x0f, 0xf4, 0x00, 0x00, 0x30, 0xfb, 0x00, 0x03, 0xe0, 0xff, 0x3f, 0xfe, 0xf3, 0x00, 0x00, 0x18, 0xf8, 0x00, 0x00, 0xfe,
+	0xf3, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x01, 0xfe, 0x07, 0xf4, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x01, 0xf8, 0xff, 0xf4, 0x00, 0x00, 0x04, 0xf7, 0x00,
+	0x01, 0xff, 0x01, 0xf5, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x01, 0xf0, 0x01, 0xf5, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x01, 0xfe, 0x01, 0xf5, 0x00, 0x00,
+	0x02, 0xf8, 0x00, 0x02, 0xc0, 0xff, 0x01, 0xf6, 0x00, 0x01, 0x80, 0x03, 0xf8, 0x00, 0x01, 0xfc, 0x3f, 0xf5, 0x00, 0x00, 0xc0, 0xf7, 0x00, 0x01,
+	0xfe, 0x03, 0xf5, 0x00, 0x00, 0x20, 0xf7, 0x00, 0x00, 0x7e, 0xe9, 0x00, 0x00, 0x06, 0x99, 0x00
+};
+
+const Canvas_image Image_SpiderLogo = { 200, 96, sizeof(Image_SpiderLogo_Data), Image_SpiderLogo_Data };
+
+// Image_Background, 200 x 96, 2400 bytes unpacked
+static const uint8_t Image_Background_Data[] =
+{
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff,
+	0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x00, 0x06, 0xfa, 0x00, 0xff, 0xff
+};
+
+const Canvas_image Image_Background = { 200, 96, sizeof(Image_Background_Data), Image_Background_Data };
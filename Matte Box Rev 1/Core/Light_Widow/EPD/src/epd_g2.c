@@ -18,13 +18,13 @@
 #include <unistd.h>
 #include <memory.h>
 #include <stdio.h>
-#include <stdlib.h>
 #include <time.h>
 #include <signal.h>
 
 #include "dwt_delay.h"
 #include "main.h"
 #include "epd_g2.h"
+#include "epd_g2_lut.h"
 #include "stm32f4xx_hal.h"
 #include "lm75b.h"
 
@@ -48,23 +48,60 @@ typedef enum {           // Image pixel -> Display pixel
 	EPD_normal       // B -> B, W -> W (New Image)
 } EPD_stage;
 
+typedef enum {           // frames a stage sends
+	FRAME_NONE,      // stage not driven
+	FRAME_FIXED,     // every pixel fixed_value
+	FRAME_OLD,       // old image
+	FRAME_NEW,       // new image
+	FRAME_PARTIAL    // new image, "nothing" where it matches the old one, line_map lines only
+} frame_source;
+
+typedef struct {
+	frame_source source;
+	uint8_t fixed_value;
+} stage_plan;
+
+// Frames of every stage: compensate, white, inverse, normal
+static const stage_plan update_plans[][4] = {
+	[EPD_UPDATE_NONE]    = {{FRAME_NONE, 0}, {FRAME_NONE, 0}, {FRAME_NONE, 0}, {FRAME_NONE, 0}},
+	[EPD_UPDATE_CLEAR]   = {{FRAME_FIXED, 0xff}, {FRAME_FIXED, 0xff}, {FRAME_FIXED, 0xaa}, {FRAME_FIXED, 0xaa}},
+	[EPD_UPDATE_IMAGE_0] = {{FRAME_FIXED, 0xaa}, {FRAME_FIXED, 0xaa}, {FRAME_NEW, 0}, {FRAME_NEW, 0}},
+	[EPD_UPDATE_IMAGE]   = {{FRAME_OLD, 0}, {FRAME_OLD, 0}, {FRAME_NEW, 0}, {FRAME_NEW, 0}},
+	// Only need last stage for partial update
+	// See discussion on issue #19 in the repaper/gratis repository on github
+	[EPD_UPDATE_PARTIAL] = {{FRAME_NONE, 0}, {FRAME_NONE, 0}, {FRAME_NONE, 0}, {FRAME_PARTIAL, 0}}
+};
+
+// line buffers of the panel, sized for the largest one. One panel per box, so one set
+static uint8_t line_buffers[2 * EPD_LINE_BUFFER_SIZE];
+
+// SPI traffic of the last update of each kind. The SPI functions count into the part
+// of it the running step belongs to
+static EPD_spi_stats spi_stats[EPD_UPDATE_PARTIAL + 1];
+static EPD_spi_counters *spi_bucket = &spi_stats[EPD_UPDATE_NONE].power;
+static EPD_update last_update = EPD_UPDATE_NONE;
+
 // function prototypes
 
 static void power_off(EPD_HandleTypeDef *epd);
-static int temperature_to_factor_10x(int temperature);
+static uint16_t temperature_to_factor_80x(int16_t temperature);
 static void frame_fixed(EPD_HandleTypeDef *epd, uint8_t fixed_value, EPD_stage stage);
-static void frame_data(EPD_HandleTypeDef *epd, const uint8_t *image, const uint8_t *mask, EPD_stage stage);
-static void frame_fixed_repeat(EPD_HandleTypeDef *epd, uint8_t fixed_value, EPD_stage stage);
-static void frame_data_repeat(EPD_HandleTypeDef *epd, const uint8_t *image, const uint8_t *mask, EPD_stage stage);
+static void frame_data(EPD_HandleTypeDef *epd, const uint8_t *image, const uint8_t *mask, const uint8_t *line_map, EPD_stage stage);
 static void one_line(EPD_HandleTypeDef *epd, uint16_t line, const uint8_t *data, uint8_t fixed_value, const uint8_t *mask, EPD_stage stage);
 static void nothing_frame(EPD_HandleTypeDef *epd);
 static void dummy_line(EPD_HandleTypeDef *epd);
 static void border_dummy_line(EPD_HandleTypeDef *epd);
 static void SPI_send(EPD_HandleTypeDef *epd, uint8_t *pData, uint16_t Size);
 static void SPI_read(EPD_HandleTypeDef *epd, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
-
-// Global Variables
-static bool setTemp = false;
+static void SPI_line_start(EPD_HandleTypeDef *epd, uint8_t *pData, uint16_t Size);
+static void SPI_line_finish(EPD_HandleTypeDef *epd);
+static void cs_guard(void);
+static uint16_t line_length(EPD_HandleTypeDef *epd);
+static void update_start(EPD_HandleTypeDef *epd, uint16_t lines);
+static void job_start(EPD_HandleTypeDef *epd, EPD_step step, EPD_update update, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map, bool power_down);
+static void job_run(EPD_HandleTypeDef *epd);
+static void next_step(EPD_HandleTypeDef *epd, EPD_step step, uint16_t ms);
+static bool stage_frame(EPD_HandleTypeDef *epd);
 
 void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 
@@ -91,10 +128,10 @@ void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 	switch (size) {
 		default:
 		case EPD_1_44:  // default so no change
-			epd->lines_per_display = 96;
-			epd->dots_per_line = 128;
-			epd->bytes_per_line = 128 / 8;
-			epd->bytes_per_scan = 96 / 4;
+			epd->lines_per_display = EPD_1_44_LINES;
+			epd->dots_per_line = EPD_1_44_DOTS;
+			epd->bytes_per_line = EPD_1_44_DOTS / 8;
+			epd->bytes_per_scan = EPD_1_44_LINES / 4;
 			static uint8_t cs[] = {0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00};
 			epd->channel_select = cs;
 			epd->channel_select_length = sizeof(cs);
@@ -104,11 +141,11 @@ void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 			break;
 
 		case EPD_1_9: {
-			epd->lines_per_display = 128;
-			epd->dots_per_line = 144;
-			epd->bytes_per_line = 144 / 8;
+			epd->lines_per_display = EPD_1_9_LINES;
+			epd->dots_per_line = EPD_1_9_DOTS;
+			epd->bytes_per_line = EPD_1_9_DOTS / 8;
 			epd->middle_scan = false;
-			epd->bytes_per_scan = 128 / 4 / 2; // scan/2 - data - scan/2
+			epd->bytes_per_scan = EPD_1_9_LINES / 4 / 2; // scan/2 - data - scan/2
 			static uint8_t cs[] = {0x72, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xff};
 			epd->channel_select = cs;
 			epd->channel_select_length = sizeof(cs);
@@ -118,10 +155,10 @@ void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 		}
 
 		case EPD_2_0: {
-			epd->lines_per_display = 96;
-			epd->dots_per_line = 200;
-			epd->bytes_per_line = 200 / 8;
-			epd->bytes_per_scan = 96 / 4;
+			epd->lines_per_display = EPD_2_0_LINES;
+			epd->dots_per_line = EPD_2_0_DOTS;
+			epd->bytes_per_line = EPD_2_0_DOTS / 8;
+			epd->bytes_per_scan = EPD_2_0_LINES / 4;
 			static uint8_t cs[] = {0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00};
 			epd->channel_select = cs;
 			epd->channel_select_length = sizeof(cs);
@@ -133,11 +170,11 @@ void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 
 		case EPD_2_6: {
 			epd->base_stage_time = 630; // milliseconds
-			epd->lines_per_display = 128;
-			epd->dots_per_line = 232;
-			epd->bytes_per_line = 232 / 8;
+			epd->lines_per_display = EPD_2_6_LINES;
+			epd->dots_per_line = EPD_2_6_DOTS;
+			epd->bytes_per_line = EPD_2_6_DOTS / 8;
 			epd->middle_scan = false;
-			epd->bytes_per_scan = 128 / 4 / 2; // scan/2 - data - scan/2
+			epd->bytes_per_scan = EPD_2_6_LINES / 4 / 2; // scan/2 - data - scan/2
 			static uint8_t cs[] = {0x72, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0xff};
 			epd->channel_select = cs;
 			epd->channel_select_length = sizeof(cs);
@@ -148,10 +185,11 @@ void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 
 		case EPD_2_7: {
 			epd->base_stage_time = 630; // milliseconds
-			epd->lines_per_display = 176;
-			epd->dots_per_line = 264;
-			epd->bytes_per_line = 264 / 8;
-			epd->bytes_per_scan = 176 / 4;
+			epd->lines_per_display = EPD_2_7_LINES;
+			epd->dots_per_line = EPD_2_7_DOTS;
+			epd->bytes_per_line = EPD_2_7_DOTS / 8;
+			epd->bytes_per_scan = EPD_2_7_LINES / 4;
+			epd->middle_scan = true; // => data-scan-data ELSE: scan-data-scan
 			static uint8_t cs[] = {0x72, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x00};
 			epd->channel_select = cs;
 			epd->channel_select_length = sizeof(cs);
@@ -167,28 +205,36 @@ void EPD_Init(EPD_size size, SPI_HandleTypeDef *spi, EPD_HandleTypeDef *epd) {
 	// Set a base temperature
 	EPD_set_temperature(epd, 25);
 
-	// buffer for frame line
+	// buffer for frame line, all_pixels puts out two bytes per data byte
 	if (epd->middle_scan) {
 		epd->line_buffer_size = 2 * epd->bytes_per_line
 			+ epd->bytes_per_scan
 			+ 3; // command byte, pre_border_byte, border byte
 	} else {
-		epd->line_buffer_size = epd->bytes_per_line
+		epd->line_buffer_size = 2 * epd->bytes_per_line
 			+ 2 * epd->bytes_per_scan
 			+ 3; // command byte, pre_border_byte, border byte
 	}
 
-	epd->line_buffer = malloc(epd->line_buffer_size + 4096);
+	// two of them, the next line is built while the last one is sent.
+	// The panels above are all within EPD_MAX_DOTS x EPD_MAX_LINES
+	epd->line_buffer = line_buffers;
+	epd->line_buffer_index = 0;
+	epd->line_pending = false;
 
 	// ensure zero
-	memset(epd->line_buffer, 0x00, epd->line_buffer_size);
+	memset(epd->line_buffer, 0x00, 2 * epd->line_buffer_size);
 
 	// ensure I/O is all set to ZERO
 	power_off(epd);
 
 	// COG state for partial update
 	epd->COG_on = false;
+	epd->COG_held = false;
+	epd->step = EPD_STEP_IDLE;
+	epd->wait_ticks = 0;
 
+	update_start(epd, 0);
 }
 
 // read current status
@@ -199,204 +245,322 @@ EPD_error EPD_status(EPD_HandleTypeDef *epd) {
 
 // starts an EPD sequence
 void EPD_begin(EPD_HandleTypeDef *epd) {
-	int8_t currentTemperature;
 
 	// Nothing to do when COG still on
 	if (epd->COG_on) {
 		return;
 	}
 
-	if (setTemp) {
-		// setTemp flag is set from outside to prevent over-sampling
-		if (LM75B_ReadTemp(&currentTemperature) == LM75B_OK) {
-			EPD_set_temperature(epd, currentTemperature);
-		} else {
-			EPD_set_temperature(epd, 25);
-		}
-		setTemp = false;
-	}
+	job_start(epd, EPD_STEP_POWER_ON, EPD_UPDATE_NONE, NULL, NULL, NULL, false);
+	job_run(epd);
+}
 
-	// assume OK
-	epd->status = EPD_OK;
 
-	// power up sequence
-	HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, LOW);
-	HAL_GPIO_WritePin(epd->panel_on_port, epd->panel_on_pin, LOW);
-	HAL_GPIO_WritePin(epd->discharge_port, epd->discharge_pin, LOW);
+void EPD_end(EPD_HandleTypeDef *epd) {
+	job_start(epd, EPD_STEP_NOTHING, EPD_UPDATE_NONE, NULL, NULL, NULL, false);
+	job_run(epd);
+}
 
-	Delay_ms(5);
-	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, HIGH);
-	HAL_GPIO_WritePin(epd->panel_on_port, epd->panel_on_pin, HIGH);
-	Delay_ms(10);
 
-	HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, HIGH);
-	Delay_ms(5);
+bool EPD_start_update(EPD_HandleTypeDef *epd, EPD_update update, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map) {
+	uint8_t changed_map[EPD_LINE_MAP_SIZE];
 
-	HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, LOW);
-	Delay_ms(5);
+	if (EPD_busy(epd)) {
+		return false;
+	}
 
-	HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, HIGH);
-	Delay_ms(5);
+	// Identical images leave no line to drive, don't power the COG up for them
+	if (EPD_UPDATE_PARTIAL == update && 0 == EPD_changed_lines(epd, old_image, new_image, changed_map)) {
+		return true;
+	}
 
-	// wait for COG to become ready
-	while (HIGH == HAL_GPIO_ReadPin(epd->busy_port, epd->busy_pin)) {
-		Delay_us(10);
+	job_start(epd, epd->COG_on ? EPD_STEP_STAGE : EPD_STEP_POWER_ON, update, old_image, new_image, line_map, 0 == EPD_COG_HOLD_MS);
+	epd->COG_held = (0 != EPD_COG_HOLD_MS);
+	return true;
+}
+
+
+void EPD_release(EPD_HandleTypeDef *epd) {
+	job_run(epd);
+
+	if (epd->COG_held && epd->COG_on) {
+		EPD_end(epd);
 	}
+	epd->COG_held = false;
+}
+
+
+bool EPD_busy(EPD_HandleTypeDef *epd) {
+	return EPD_STEP_IDLE != epd->step;
+}
 
-	// read the COG ID
+
+// The power sequences of the COG G2 application note, the delays are waits between steps.
+bool EPD_process(EPD_HandleTypeDef *epd) {
 	uint8_t receive_buffer[2];
-	SPI_read(epd, CU8(0x71, 0x00), receive_buffer, sizeof(receive_buffer));
-	SPI_read(epd, CU8(0x71, 0x00), receive_buffer, sizeof(receive_buffer));
-	int cog_id = receive_buffer[1];
-	if (0x02 != (0x0f & cog_id)) {
-		epd->status = EPD_UNSUPPORTED_COG;
-		power_off(epd);
-		return;
-	}
+	int16_t currentTemperature;
 
-	// Disable OE
-	SPI_send(epd, CU8(0x70, 0x02), 2);
-	SPI_send(epd, CU8(0x72, 0x40), 2);
-
-	// check breakage
-	SPI_send(epd, CU8(0x70, 0x0f), 2);
-	SPI_read(epd, CU8(0x73, 0x00), receive_buffer, sizeof(receive_buffer));
-	int broken_panel = receive_buffer[1];
-	if (0x00 == (0x80 & broken_panel)) {
-		epd->status = EPD_PANEL_BROKEN;
-		power_off(epd);
-		return;
+	if (EPD_STEP_IDLE == epd->step) {
+		if (!epd->COG_held || HAL_GetTick() - epd->COG_idle_start < EPD_COG_HOLD_MS) {
+			return false;
+		}
+
+		// Nothing came in while the COG was held
+		epd->COG_held = false;
+		if (!epd->COG_on) {
+			return false;
+		}
+		job_start(epd, EPD_STEP_NOTHING, EPD_UPDATE_NONE, NULL, NULL, NULL, false);
 	}
+	if (0 != epd->wait_ticks && HAL_GetTick() - epd->wait_start < epd->wait_ticks) {
+		return true;
+	}
+
+	// stage_frame counts its frames into the stage
+	spi_bucket = &spi_stats[epd->update].power;
+
+	switch (epd->step) {
+		case EPD_STEP_IDLE:
+			break;
+
+		case EPD_STEP_POWER_ON:
+			// The sensor is only read once per EPD_TEMPERATURE_MAX_AGE, without it the last stage time stays
+			if (LM75B_GetCachedTemp(&currentTemperature, EPD_TEMPERATURE_MAX_AGE) == LM75B_OK) {
+				EPD_set_temperature_fine(epd, currentTemperature);
+			}
+
+			// assume OK
+			epd->status = EPD_OK;
 
-	// power saving mode
-	SPI_send(epd, CU8(0x70, 0x0b), 2);
-	SPI_send(epd, CU8(0x72, 0x02), 2);
+			// power up sequence
+			HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, LOW);
+			HAL_GPIO_WritePin(epd->panel_on_port, epd->panel_on_pin, LOW);
+			HAL_GPIO_WritePin(epd->discharge_port, epd->discharge_pin, LOW);
+			next_step(epd, EPD_STEP_PANEL_ON, 5);
+			break;
 
-	// channel select
-	SPI_send(epd, CU8(0x70, 0x01), 2);
-	SPI_send(epd, epd->channel_select, epd->channel_select_length);
+		case EPD_STEP_PANEL_ON:
+			HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, HIGH);
+			HAL_GPIO_WritePin(epd->panel_on_port, epd->panel_on_pin, HIGH);
+			next_step(epd, EPD_STEP_RESET_HIGH, 10);
+			break;
 
-	// high power mode osc
-	SPI_send(epd, CU8(0x70, 0x07), 2);
-	SPI_send(epd, CU8(0x72, 0xd1), 2);
+		case EPD_STEP_RESET_HIGH:
+			HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, HIGH);
+			next_step(epd, EPD_STEP_RESET_LOW, 5);
+			break;
 
-	// power setting
-	SPI_send(epd, CU8(0x70, 0x08), 2);
-	SPI_send(epd, CU8(0x72, 0x02), 2);
+		case EPD_STEP_RESET_LOW:
+			HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, LOW);
+			next_step(epd, EPD_STEP_RESET_DONE, 5);
+			break;
 
-	// Vcom level
-	SPI_send(epd, CU8(0x70, 0x09), 2);
-	SPI_send(epd, CU8(0x72, 0xc2), 2);
+		case EPD_STEP_RESET_DONE:
+			HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, HIGH);
+			next_step(epd, EPD_STEP_COG_SETUP, 5);
+			break;
 
-	// power setting
-	SPI_send(epd, CU8(0x70, 0x04), 2);
-	SPI_send(epd, CU8(0x72, 0x03), 2);
+		case EPD_STEP_COG_SETUP: {
+			// wait for COG to become ready
+			if (HIGH == HAL_GPIO_ReadPin(epd->busy_port, epd->busy_pin)) {
+				break;
+			}
 
-	// driver latch on
-	SPI_send(epd, CU8(0x70, 0x03), 2);
-	SPI_send(epd, CU8(0x72, 0x01), 2);
+			// read the COG ID
+			SPI_read(epd, CU8(0x71, 0x00), receive_buffer, sizeof(receive_buffer));
+			SPI_read(epd, CU8(0x71, 0x00), receive_buffer, sizeof(receive_buffer));
+			int cog_id = receive_buffer[1];
+			if (0x02 != (0x0f & cog_id)) {
+				epd->status = EPD_UNSUPPORTED_COG;
+				next_step(epd, EPD_STEP_POWER_OFF, 0);
+				break;
+			}
 
-	// driver latch off
-	SPI_send(epd, CU8(0x70, 0x03), 2);
-	SPI_send(epd, CU8(0x72, 0x00), 2);
+			// Disable OE
+			SPI_send(epd, CU8(0x70, 0x02), 2);
+			SPI_send(epd, CU8(0x72, 0x40), 2);
+
+			// check breakage
+			SPI_send(epd, CU8(0x70, 0x0f), 2);
+			SPI_read(epd, CU8(0x73, 0x00), receive_buffer, sizeof(receive_buffer));
+			int broken_panel = receive_buffer[1];
+			if (0x00 == (0x80 & broken_panel)) {
+				epd->status = EPD_PANEL_BROKEN;
+				next_step(epd, EPD_STEP_POWER_OFF, 0);
+				break;
+			}
 
-	Delay_ms(5);
+			// power saving mode
+			SPI_send(epd, CU8(0x70, 0x0b), 2);
+			SPI_send(epd, CU8(0x72, 0x02), 2);
 
-	bool dc_ok = false;
+			// channel select
+			SPI_send(epd, CU8(0x70, 0x01), 2);
+			SPI_send(epd, epd->channel_select, epd->channel_select_length);
 
-	for (int i = 0; i < 4; ++i) {
-		// charge pump positive voltage on - VGH/VDL on
-		SPI_send(epd, CU8(0x70, 0x05), 2);
-		SPI_send(epd, CU8(0x72, 0x01), 2);
+			// high power mode osc
+			SPI_send(epd, CU8(0x70, 0x07), 2);
+			SPI_send(epd, CU8(0x72, 0xd1), 2);
 
-		Delay_ms(240);
+			// power setting
+			SPI_send(epd, CU8(0x70, 0x08), 2);
+			SPI_send(epd, CU8(0x72, 0x02), 2);
 
-		// charge pump negative voltage on - VGL/VDL on
-		SPI_send(epd, CU8(0x70, 0x05), 2);
-		SPI_send(epd, CU8(0x72, 0x03), 2);
+			// Vcom level
+			SPI_send(epd, CU8(0x70, 0x09), 2);
+			SPI_send(epd, CU8(0x72, 0xc2), 2);
 
-		Delay_ms(40);
+			// power setting
+			SPI_send(epd, CU8(0x70, 0x04), 2);
+			SPI_send(epd, CU8(0x72, 0x03), 2);
 
-		// charge pump Vcom on - Vcom driver on
-		SPI_send(epd, CU8(0x70, 0x05), 2);
-		SPI_send(epd, CU8(0x72, 0x0f), 2);
+			// driver latch on
+			SPI_send(epd, CU8(0x70, 0x03), 2);
+			SPI_send(epd, CU8(0x72, 0x01), 2);
 
-		Delay_ms(40);
+			// driver latch off
+			SPI_send(epd, CU8(0x70, 0x03), 2);
+			SPI_send(epd, CU8(0x72, 0x00), 2);
 
-		// check DC/DC
-		SPI_send(epd, CU8(0x70, 0x0f), 2);
-		SPI_read(epd, CU8(0x73, 0x00), receive_buffer, sizeof(receive_buffer));
-		int dc_state = receive_buffer[1];
-		if (0x40 == (0x40 & dc_state)) {
-			dc_ok = true;
+			epd->dc_tries = 0;
+			next_step(epd, EPD_STEP_PUMP_POS, 5);
 			break;
 		}
-	}
-	if (!dc_ok) {
-		epd->status = EPD_DC_FAILED;
-		power_off(epd);
-		return;
-	}
 
-	// output enable to disable
-	SPI_send(epd, CU8(0x70, 0x02), 2);
-	SPI_send(epd, CU8(0x72, 0x04), 2);
+		case EPD_STEP_PUMP_POS:
+			// charge pump positive voltage on - VGH/VDL on
+			SPI_send(epd, CU8(0x70, 0x05), 2);
+			SPI_send(epd, CU8(0x72, 0x01), 2);
+			next_step(epd, EPD_STEP_PUMP_NEG, 240);
+			break;
 
-	epd->COG_on = true;
-}
+		case EPD_STEP_PUMP_NEG:
+			// charge pump negative voltage on - VGL/VDL on
+			SPI_send(epd, CU8(0x70, 0x05), 2);
+			SPI_send(epd, CU8(0x72, 0x03), 2);
+			next_step(epd, EPD_STEP_PUMP_VCOM, 40);
+			break;
 
+		case EPD_STEP_PUMP_VCOM:
+			// charge pump Vcom on - Vcom driver on
+			SPI_send(epd, CU8(0x70, 0x05), 2);
+			SPI_send(epd, CU8(0x72, 0x0f), 2);
+			next_step(epd, EPD_STEP_DC_CHECK, 40);
+			break;
 
-void EPD_end(EPD_HandleTypeDef *epd) {
+		case EPD_STEP_DC_CHECK: {
+			// check DC/DC
+			SPI_send(epd, CU8(0x70, 0x0f), 2);
+			SPI_read(epd, CU8(0x73, 0x00), receive_buffer, sizeof(receive_buffer));
+			int dc_state = receive_buffer[1];
+			if (0x40 != (0x40 & dc_state)) {
+				if (++epd->dc_tries < 4) {
+					next_step(epd, EPD_STEP_PUMP_POS, 0);
+				} else {
+					epd->status = EPD_DC_FAILED;
+					next_step(epd, EPD_STEP_POWER_OFF, 0);
+				}
+				break;
+			}
 
-	nothing_frame(epd);
+			// output enable to disable
+			SPI_send(epd, CU8(0x70, 0x02), 2);
+			SPI_send(epd, CU8(0x72, 0x04), 2);
 
-	if (EPD_2_7 == epd->size) {
-		dummy_line(epd);
-		// only pulse border pin for 2.70" EPD
-//		Delay_ms(25);
-//		digitalWrite(epd->EPD_Pin_BORDER, LOW);
-//		Delay_ms(200);
-//		digitalWrite(epd->EPD_Pin_BORDER, HIGH);
-	} else {
-		border_dummy_line(epd);
-		Delay_ms(200);
-	}
+			epd->COG_on = true;
+			if (EPD_UPDATE_NONE != epd->update) {
+				next_step(epd, EPD_STEP_STAGE, 0);
+			} else {
+				next_step(epd, epd->power_down ? EPD_STEP_NOTHING : EPD_STEP_IDLE, 0);
+			}
+			break;
+		}
+
+		case EPD_STEP_STAGE:
+			if (stage_frame(epd)) {
+				next_step(epd, epd->power_down ? EPD_STEP_NOTHING : EPD_STEP_HOLD, 0);
+			}
+			break;
 
-	// ??? - not described in datasheet
-	SPI_send(epd, CU8(0x70, 0x0b), 2);
-	SPI_send(epd, CU8(0x72, 0x00), 2);
+		case EPD_STEP_HOLD:
+			// The last frame left its last row driven. Clear the rows like the power down does,
+			// without the border and charge pump steps, so the COG can wait for the next update.
+			nothing_frame(epd);
+			dummy_line(epd);
+			epd->COG_idle_start = HAL_GetTick();
+			next_step(epd, EPD_STEP_IDLE, 0);
+			break;
 
-	// latch reset turn on
-	SPI_send(epd, CU8(0x70, 0x03), 2);
-	SPI_send(epd, CU8(0x72, 0x01), 2);
+		case EPD_STEP_NOTHING:
+			nothing_frame(epd);
+
+			if (EPD_2_7 == epd->size) {
+				dummy_line(epd);
+				// only pulse border pin for 2.70" EPD
+//				Delay_ms(25);
+//				digitalWrite(epd->EPD_Pin_BORDER, LOW);
+//				Delay_ms(200);
+//				digitalWrite(epd->EPD_Pin_BORDER, HIGH);
+				next_step(epd, EPD_STEP_LATCH_RESET, 0);
+			} else {
+				border_dummy_line(epd);
+				next_step(epd, EPD_STEP_LATCH_RESET, 200);
+			}
+			break;
 
-	// power off charge pump Vcom
-	SPI_send(epd, CU8(0x70, 0x05), 2);
-	SPI_send(epd, CU8(0x72, 0x03), 2);
+		case EPD_STEP_LATCH_RESET:
+			// ??? - not described in datasheet
+			SPI_send(epd, CU8(0x70, 0x0b), 2);
+			SPI_send(epd, CU8(0x72, 0x00), 2);
 
-	// power off charge pump neg voltage
-	SPI_send(epd, CU8(0x70, 0x05), 2);
-	SPI_send(epd, CU8(0x72, 0x01), 2);
+			// latch reset turn on
+			SPI_send(epd, CU8(0x70, 0x03), 2);
+			SPI_send(epd, CU8(0x72, 0x01), 2);
 
-	Delay_ms(120);
+			// power off charge pump Vcom
+			SPI_send(epd, CU8(0x70, 0x05), 2);
+			SPI_send(epd, CU8(0x72, 0x03), 2);
 
-	// discharge internal
-	SPI_send(epd, CU8(0x70, 0x04), 2);
-	SPI_send(epd, CU8(0x72, 0x80), 2);
+			// power off charge pump neg voltage
+			SPI_send(epd, CU8(0x70, 0x05), 2);
+			SPI_send(epd, CU8(0x72, 0x01), 2);
 
-	// turn off all charge pumps
-	SPI_send(epd, CU8(0x70, 0x05), 2);
-	SPI_send(epd, CU8(0x72, 0x00), 2);
+			next_step(epd, EPD_STEP_DISCHARGE, 120);
+			break;
 
-	// turn of osc
-	SPI_send(epd, CU8(0x70, 0x07), 2);
-	SPI_send(epd, CU8(0x72, 0x01), 2);
+		case EPD_STEP_DISCHARGE:
+			// discharge internal
+			SPI_send(epd, CU8(0x70, 0x04), 2);
+			SPI_send(epd, CU8(0x72, 0x80), 2);
 
-	Delay_ms(50);
+			// turn off all charge pumps
+			SPI_send(epd, CU8(0x70, 0x05), 2);
+			SPI_send(epd, CU8(0x72, 0x00), 2);
 
-	power_off(epd);
+			// turn of osc
+			SPI_send(epd, CU8(0x70, 0x07), 2);
+			SPI_send(epd, CU8(0x72, 0x01), 2);
 
-	epd->COG_on = false;
+			next_step(epd, EPD_STEP_POWER_OFF, 50);
+			break;
+
+		case EPD_STEP_POWER_OFF:
+			// same as power_off, the discharge is a wait
+			HAL_GPIO_WritePin(epd->reset_port, epd->reset_pin, LOW);
+			HAL_GPIO_WritePin(epd->panel_on_port, epd->panel_on_pin, LOW);
+			HAL_GPIO_WritePin(epd->discharge_port, epd->discharge_pin, HIGH);
+			next_step(epd, EPD_STEP_DISCHARGE_END, 150);
+			break;
+
+		case EPD_STEP_DISCHARGE_END:
+			HAL_GPIO_WritePin(epd->discharge_port, epd->discharge_pin, LOW);
+			epd->COG_on = false;
+			epd->COG_held = false;
+			next_step(epd, EPD_STEP_IDLE, 0);
+			break;
+	}
+
+	return EPD_STEP_IDLE != epd->step;
 }
 
 
@@ -416,11 +580,12 @@ static void power_off(EPD_HandleTypeDef *epd) {
 
 
 void EPD_set_temperature(EPD_HandleTypeDef *epd, int temperature) {
-	epd->factored_stage_time = epd->base_stage_time * temperature_to_factor_10x(temperature) / 10;
+	EPD_set_temperature_fine(epd, temperature * 8);
 }
 
-void EPD_set_enable_temperature(void){
-	setTemp = true;
+void EPD_set_temperature_fine(EPD_HandleTypeDef *epd, int16_t temperature) {
+	epd->temperature = temperature;
+	epd->factored_stage_time = (uint32_t) epd->base_stage_time * temperature_to_factor_80x(temperature) / 80;
 }
 
 //void EPD_set_factored_stage_time(EPD_type *epd, int pu_stagetime) {
@@ -430,58 +595,259 @@ void EPD_set_enable_temperature(void){
 
 // clear display (anything -> white)
 void EPD_clear(EPD_HandleTypeDef *epd) {
-	frame_fixed_repeat(epd, 0xff, EPD_compensate);
-	frame_fixed_repeat(epd, 0xff, EPD_white);
-	frame_fixed_repeat(epd, 0xaa, EPD_inverse);
-	frame_fixed_repeat(epd, 0xaa, EPD_normal);
+	job_start(epd, EPD_STEP_STAGE, EPD_UPDATE_CLEAR, NULL, NULL, NULL, false);
+	job_run(epd);
 }
 
 // assuming a clear (white) screen output an image
 void EPD_image_0(EPD_HandleTypeDef *epd, const uint8_t *image) {
-	frame_fixed_repeat(epd, 0xaa, EPD_compensate);
-	frame_fixed_repeat(epd, 0xaa, EPD_white);
-	frame_data_repeat(epd, image, NULL, EPD_inverse);
-	frame_data_repeat(epd, image, NULL, EPD_normal);
+	job_start(epd, EPD_STEP_STAGE, EPD_UPDATE_IMAGE_0, NULL, image, NULL, false);
+	job_run(epd);
 }
 
 // change from old image to new image
 void EPD_image(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image) {
-	frame_data_repeat(epd, old_image, NULL, EPD_compensate);
-	frame_data_repeat(epd, old_image, NULL, EPD_white);
-	frame_data_repeat(epd, new_image, NULL, EPD_inverse);
-	frame_data_repeat(epd, new_image, NULL, EPD_normal);
+	job_start(epd, EPD_STEP_STAGE, EPD_UPDATE_IMAGE, old_image, new_image, NULL, false);
+	job_run(epd);
 }
 
 // change from old image to new image
 void EPD_partial_image(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image) {
-	// Only need last stage for partial update
-	// See discussion on issue #19 in the repaper/gratis repository on github
-	frame_data_repeat(epd, new_image, old_image, EPD_normal);
+	uint8_t line_map[EPD_LINE_MAP_SIZE];
+
+	EPD_changed_lines(epd, old_image, new_image, line_map);
+	EPD_partial_lines(epd, old_image, new_image, line_map);
+}
+
+// change from old image to new image on the lines marked in line_map
+void EPD_partial_lines(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map) {
+	job_start(epd, EPD_STEP_STAGE, EPD_UPDATE_PARTIAL, old_image, new_image, line_map, false);
+	job_run(epd);
+}
+
+uint16_t EPD_changed_lines(EPD_HandleTypeDef *epd, const uint8_t *old_image, const uint8_t *new_image, uint8_t *line_map) {
+	uint16_t changed = 0;
+
+	memset(line_map, 0x00, EPD_LINE_MAP_SIZE);
+
+	for (uint16_t l = 0; l < epd->lines_per_display; ++l) {
+		size_t n = l * epd->bytes_per_line;
+		if (0 != memcmp(&old_image[n], &new_image[n], epd->bytes_per_line)) {
+			line_map[l / 8] |= 1 << (l % 8);
+			changed++;
+		}
+	}
+	return changed;
+}
+
+
+void EPD_get_spi_stats(EPD_update update, EPD_spi_stats *stats) {
+	if (update > EPD_UPDATE_PARTIAL) {
+		memset(stats, 0x00, sizeof(EPD_spi_stats));
+		return;
+	}
+	*stats = spi_stats[update];
+}
+
+
+EPD_update EPD_last_update(void) {
+	return last_update;
+}
+
+
+// Every line costs 4 transfers with their CS guards: 0x70 0x0a, the line buffer by DMA and
+// 0x70 0x02, 0x72 0x07 to output it. The next line is built while the DMA runs, so
+// building it is assumed to take less than sending it.
+void EPD_estimate(EPD_HandleTypeDef *epd, EPD_update update, uint16_t lines, int16_t temperature, EPD_cost *cost) {
+	// SPI1 runs from APB2, the others from APB1
+	uint32_t pclk = (SPI1 == epd->spi->Instance) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+	uint32_t spi_khz = pclk / 1000 / (2U << ((epd->spi->Init.BaudRatePrescaler & SPI_CR1_BR) >> SPI_CR1_BR_Pos));
+	uint32_t line_bytes = 6 + line_length(epd);
+	uint32_t line_us = 4 * (EPD_CS_GUARD_US + EPD_COST_TRANSFER_US) + (line_bytes * 8 * 1000 + spi_khz - 1) / spi_khz;
+	uint32_t frames;
+
+	memset(cost, 0x00, sizeof(EPD_cost));
+	cost->power_up_ms = epd->COG_on ? 0 : EPD_COST_POWER_UP_MS;
+	cost->total_ms = cost->power_up_ms;
+
+	if (update > EPD_UPDATE_PARTIAL) {
+		return;
+	}
+	if (EPD_UPDATE_PARTIAL != update || lines > epd->lines_per_display) {
+		lines = epd->lines_per_display;
+	}
+	for (uint8_t stage = EPD_compensate; stage <= EPD_normal; stage++) {
+		if (FRAME_NONE != update_plans[update][stage].source) {
+			cost->stages++;
+		}
+	}
+	// an update without lines sends nothing, see stage_frame
+	if (0 == lines || 0 == cost->stages) {
+		return;
+	}
+
+	cost->stage_ms = (uint32_t) epd->base_stage_time * temperature_to_factor_80x(temperature) / 80;
+	cost->frame_us = lines * line_us;
+	// the stage ends after the frame that runs past stage_ms
+	cost->frames = (cost->stage_ms * 1000UL + cost->frame_us - 1) / cost->frame_us;
+	if (0 == cost->frames) {
+		cost->frames = 1;
+	}
+
+	frames = (uint32_t) cost->stages * cost->frames;
+	cost->total_ms += (frames * cost->frame_us + 500) / 1000;
+	cost->bytes = frames * lines * line_bytes;
+	cost->guard_us = frames * lines * 4 * EPD_CS_GUARD_US;
 }
 
 
 // internal functions
 // ==================
 
-// convert a temperature in Celsius to
-// the scale factor for frame_*_repeat methods
-static int temperature_to_factor_10x(int temperature) {
-	if (temperature <= -10) {
-		return 170;
-	} else if (temperature <= -5) {
-		return 120;
-	} else if (temperature <= 5) {
-		return 80;
-	} else if (temperature <= 10) {
-		return 40;
-	} else if (temperature <= 15) {
-		return 30;
-	} else if (temperature <= 20) {
-		return 20;
-	} else if (temperature <= 40) {
-		return 10;
+// reset the statistics reported for an update
+static void update_start(EPD_HandleTypeDef *epd, uint16_t lines) {
+	epd->lines_changed = lines;
+	epd->lines_sent = 0;
+	memset(epd->iterations, 0, sizeof(epd->iterations));
+}
+
+// set up an update, the blocking calls start at the step they stand for
+static void job_start(EPD_HandleTypeDef *epd, EPD_step step, EPD_update update, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map, bool power_down) {
+	epd->step = step;
+	epd->wait_ticks = 0;
+	epd->power_down = power_down;
+	epd->update = update;
+	epd->old_image = old_image;
+	epd->new_image = new_image;
+	epd->stage = EPD_compensate;
+	epd->stage_frames = 0;
+
+	if (EPD_UPDATE_PARTIAL == update) {
+		memcpy(epd->line_map, line_map, EPD_LINE_MAP_SIZE);
+		update_start(epd, 0);
+
+		for (uint16_t l = 0; l < epd->lines_per_display; ++l) {
+			if (line_map[l / 8] & (1 << (l % 8))) {
+				epd->lines_changed++;
+			}
+		}
+	} else if (EPD_UPDATE_NONE != update) {
+		update_start(epd, epd->lines_per_display);
 	}
-	return 7;
+
+	memset(&spi_stats[update], 0x00, sizeof(EPD_spi_stats));
+	spi_stats[update].lines_changed = epd->lines_changed;
+}
+
+// step the update to the end, waits spin on the tick like Delay_ms
+static void job_run(EPD_HandleTypeDef *epd) {
+	while (EPD_process(epd)) {
+	}
+}
+
+// the next step runs once ms have passed, at least as long as Delay_ms(ms) would take
+static void next_step(EPD_HandleTypeDef *epd, EPD_step step, uint16_t ms) {
+	epd->step = step;
+	epd->wait_start = HAL_GetTick();
+	epd->wait_ticks = (0 == ms) ? 0 : ms + 1;
+}
+
+// send one frame of the current stage, the stage ends once its time is up.
+// Every frame ends with its last line output and CS high.
+// Returns true when all stages of the update are done.
+static bool stage_frame(EPD_HandleTypeDef *epd) {
+	EPD_spi_stats *stats = &spi_stats[epd->update];
+	const stage_plan *plan;
+	uint32_t frame_start;
+
+	// stages the update doesn't drive are skipped
+	while (epd->stage <= EPD_normal && FRAME_NONE == update_plans[epd->update][epd->stage].source) {
+		epd->stage++;
+	}
+
+	// An unchanged line only carries "nothing" pixels, leave it out
+	if (epd->stage > EPD_normal || (EPD_UPDATE_PARTIAL == epd->update && 0 == epd->lines_changed)) {
+		return true;
+	}
+
+	plan = &update_plans[epd->update][epd->stage];
+	if (0 == epd->stage_frames) {
+		epd->stage_start = HAL_GetTick();
+		if (0 == epd->lines_sent) {
+			epd->frames_start = epd->stage_start;
+			stats->temperature = epd->temperature;
+			stats->stage_time = epd->factored_stage_time;
+			last_update = epd->update;
+		}
+	}
+	spi_bucket = &stats->stage[epd->stage];
+	frame_start = DWT->CYCCNT;
+
+	switch (plan->source) {
+		case FRAME_FIXED:
+			frame_fixed(epd, plan->fixed_value, epd->stage);
+			break;
+		case FRAME_OLD:
+			frame_data(epd, epd->old_image, NULL, NULL, epd->stage);
+			break;
+		case FRAME_NEW:
+			frame_data(epd, epd->new_image, NULL, NULL, epd->stage);
+			break;
+		default:
+			frame_data(epd, epd->new_image, epd->old_image, epd->line_map, epd->stage);
+			break;
+	}
+	// Output the last line and raise CS before handing back to the main loop. Left pending,
+	// the line stays latched and CS low for as long as the loop takes to call again.
+	SPI_line_finish(epd);
+	stats->frame_cycles[epd->stage][(epd->stage_frames < EPD_STATS_FRAMES) ? epd->stage_frames : EPD_STATS_FRAMES - 1] += DWT->CYCCNT - frame_start;
+	epd->stage_frames++;
+
+	if (HAL_GetTick() - epd->stage_start >= epd->factored_stage_time) {
+		epd->iterations[epd->stage] = epd->stage_frames;
+		stats->frames[epd->stage] = epd->stage_frames;
+		stats->update_ms = HAL_GetTick() - epd->frames_start;
+		epd->stage_frames = 0;
+		epd->stage++;
+	}
+	return false;
+}
+
+// convert a temperature in 1/8 Celsius to
+// the scale factor (x80) for frame_*_repeat methods.
+// The panel table gives one factor per temperature band, valid up to the warm end of the band.
+// The curve keeps that factor at the warm end and rises linearly towards the factor of the next
+// colder band, so it never runs shorter than the table and gets slower inside a band.
+static uint16_t temperature_to_factor_80x(int16_t temperature) {
+	static const struct {
+		int8_t celsius;		// warm end of the band
+		uint8_t factor_10x;
+	} curve[] = {
+		{-10, 170},
+		{ -5, 120},
+		{  5,  80},
+		{ 10,  40},
+		{ 15,  30},
+		{ 20,  20},
+		{ 40,  10}
+	};
+	const uint8_t points = sizeof(curve) / sizeof(curve[0]);
+
+	if (temperature <= curve[0].celsius * 8) {
+		return curve[0].factor_10x * 8;		// colder than the table, fixed factor
+	}
+	for (uint8_t i = 1; i < points; i++) {
+		int16_t t0 = curve[i - 1].celsius * 8;
+		int16_t t1 = curve[i].celsius * 8;
+
+		if (temperature <= t1) {
+			int16_t f0 = curve[i - 1].factor_10x * 8;
+			int16_t f1 = curve[i].factor_10x * 8;
+			// round towards the longer stage time
+			return f0 - ((f0 - f1) * (temperature - t0)) / (t1 - t0);
+		}
+	}
+	return 7 * 8;		// warmer than the table, fixed factor
 }
 
 
@@ -497,62 +863,113 @@ static void frame_fixed(EPD_HandleTypeDef *epd, uint8_t fixed_value, EPD_stage s
 	for (uint8_t l = 0; l < epd->lines_per_display ; ++l) {
 		one_line(epd, l, NULL, fixed_value, NULL, stage);
 	}
+	epd->lines_sent += epd->lines_per_display;
 }
 
 
-static void frame_data(EPD_HandleTypeDef *epd, const uint8_t *image, const uint8_t *mask, EPD_stage stage) {
-	if (NULL == mask) {
-		for (uint8_t l = 0; l < epd->lines_per_display ; ++l) {
-			one_line(epd, l, &image[l * epd->bytes_per_line], 0, NULL, stage);
-		}
-	} else {
-		for (uint8_t l = 0; l < epd->lines_per_display ; ++l) {
-			size_t n = l * epd->bytes_per_line;
-			one_line(epd, l, &image[n], 0, &mask[n], stage);
+// line_map == NULL drives every line
+static void frame_data(EPD_HandleTypeDef *epd, const uint8_t *image, const uint8_t *mask, const uint8_t *line_map, EPD_stage stage) {
+	for (uint8_t l = 0; l < epd->lines_per_display ; ++l) {
+		if ((NULL != line_map) && (0 == (line_map[l / 8] & (1 << (l % 8))))) {
+			continue;
 		}
+		size_t n = l * epd->bytes_per_line;
+		one_line(epd, l, &image[n], 0, (NULL == mask) ? NULL : &mask[n], stage);
+		epd->lines_sent++;
 	}
 }
 
 
-static void frame_fixed_repeat(EPD_HandleTypeDef *epd, uint8_t fixed_value, EPD_stage stage) {
-	int iters = 0;
-	uint32_t startTime = HAL_GetTick();
-
-	do {
-		frame_fixed(epd, fixed_value, stage);
-		iters++;
-	} while (HAL_GetTick() - startTime < epd->factored_stage_time);
-}
-
-
-static void frame_data_repeat(EPD_HandleTypeDef *epd, const uint8_t *image, const uint8_t *mask, EPD_stage stage) {
-	int iters = 0;
-	uint32_t startTime = HAL_GetTick();
-
-	do {
-		frame_data(epd, image, mask, stage);
-		iters++;
-	} while (HAL_GetTick() - startTime < epd->factored_stage_time);
-}
-
-
-
 static void nothing_frame(EPD_HandleTypeDef *epd) {
 	for (int line = 0; line < epd->lines_per_display; ++line) {
 		one_line(epd, 0x7fffu, NULL, 0x00, NULL, EPD_compensate);
 	}
+	SPI_line_finish(epd);
 }
 
 
 static void dummy_line(EPD_HandleTypeDef *epd) {
 	one_line(epd, 0x7fffu, NULL, 0x00, NULL, EPD_compensate);
+	SPI_line_finish(epd);
 }
 
 
 static void border_dummy_line(EPD_HandleTypeDef *epd) {
 	one_line(epd, 0x7fffu, NULL, 0x00, NULL, EPD_normal);
+	SPI_line_finish(epd);
+}
+
+
+#if EPD_PIXEL_LUT
+
+// The stage transforms of the reference code below, precomputed per data byte.
+// A partial update keeps the pixels where mask and data differ, the rest are sent as "nothing" (0x55).
+
+// pixels on display are numbered from 1 so even is actually bits 1,3,5,...
+static void even_pixels(EPD_HandleTypeDef *epd, uint8_t **pp, const uint8_t *data, uint8_t fixed_value, const uint8_t *mask, EPD_stage stage) {
+	const uint8_t *lut = epd_lut_even[stage];
+	uint8_t *p = *pp;
+
+	if (NULL == data) {
+		memset(p, fixed_value, epd->bytes_per_line);
+		p += epd->bytes_per_line;
+	} else if (NULL == mask) {
+		for (uint16_t b = 0; b < epd->bytes_per_line; ++b) {
+			*p++ = lut[data[b]];
+		}
+	} else {
+		for (uint16_t b = 0; b < epd->bytes_per_line; ++b) {
+			uint8_t pixel_mask = epd_lut_even_mask[mask[b] ^ data[b]];
+			*p++ = (lut[data[b]] & pixel_mask) | (~pixel_mask & 0x55);
+		}
+	}
+	*pp = p;
 }
 
+// pixels on display are numbered from 1 so odd is actually bits 0,2,4,...
+static void odd_pixels(EPD_HandleTypeDef *epd, uint8_t **pp, const uint8_t *data, uint8_t fixed_value, const uint8_t *mask, EPD_stage stage) {
+	const uint8_t *lut = epd_lut_odd[stage];
+	uint8_t *p = *pp;
+
+	if (NULL == data) {
+		memset(p, fixed_value, epd->bytes_per_line);
+		p += epd->bytes_per_line;
+	} else if (NULL == mask) {
+		for (uint16_t b = epd->bytes_per_line; b > 0; --b) {
+			*p++ = lut[data[b - 1]];
+		}
+	} else {
+		for (uint16_t b = epd->bytes_per_line; b > 0; --b) {
+			uint8_t pixel_mask = epd_lut_odd_mask[mask[b - 1] ^ data[b - 1]];
+			*p++ = (lut[data[b - 1]] & pixel_mask) | (~pixel_mask & 0x55);
+		}
+	}
+	*pp = p;
+}
+
+// pixels on display are numbered from 1
+static void all_pixels(EPD_HandleTypeDef *epd, uint8_t **pp, const uint8_t *data, uint8_t fixed_value, const uint8_t *mask, EPD_stage stage) {
+	const uint16_t *lut = epd_lut_all[stage];
+	uint8_t *p = *pp;
+
+	if (NULL == data) {
+		memset(p, fixed_value, 2 * epd->bytes_per_line);
+		p += 2 * epd->bytes_per_line;
+	} else {
+		for (uint16_t b = epd->bytes_per_line; b > 0; --b) {
+			uint16_t pixels = lut[data[b - 1]];
+			if (NULL != mask) {
+				uint16_t pixel_mask = epd_lut_all_mask[mask[b - 1] ^ data[b - 1]];
+				pixels = (pixels & pixel_mask) | (~pixel_mask & 0x5555);
+			}
+			*p++ = pixels >> 8;
+			*p++ = pixels;
+		}
+	}
+	*pp = p;
+}
+
+#else
 
 // pixels on display are numbered from 1 so even is actually bits 1,3,5,...
 static void even_pixels(EPD_HandleTypeDef *epd, uint8_t **pp, const uint8_t *data, uint8_t fixed_value, const uint8_t *mask, EPD_stage stage) {
@@ -640,7 +1057,7 @@ static void all_pixels(EPD_HandleTypeDef *epd, uint8_t **pp, const uint8_t *data
 
 			uint16_t pixel_mask = 0xffff;
 			if (NULL != mask) {
-				uint16_t pixel_mask = interleave_bits(mask[b - 1]);
+				pixel_mask = interleave_bits(mask[b - 1]);
 				pixel_mask = (pixel_mask ^ pixels) & 0x5555;
 				pixel_mask |= pixel_mask << 1;
 			}
@@ -668,14 +1085,16 @@ static void all_pixels(EPD_HandleTypeDef *epd, uint8_t **pp, const uint8_t *data
 	}
 }
 
+#endif // EPD_PIXEL_LUT
+
 // output one line of scan and data bytes to the display
+// The line is built while the previous one is still going out by DMA, its output
+// command follows in SPI_line_finish.
 static void one_line(EPD_HandleTypeDef *epd, uint16_t line, const uint8_t *data, uint8_t fixed_value, const uint8_t *mask, EPD_stage stage) {
 
-	// send data
-	SPI_send(epd, CU8(0x70, 0x0a), 2);
-
-	// Start Loading the line buffer
-	uint8_t *p = epd->line_buffer;
+	// Start Loading the free line buffer
+	uint8_t *buffer = epd->line_buffer + epd->line_buffer_index * epd->line_buffer_size;
+	uint8_t *p = buffer;
 
 	*p++ = 0x72;
 
@@ -744,12 +1163,12 @@ static void one_line(EPD_HandleTypeDef *epd, uint16_t line, const uint8_t *data,
 		}
 		break;
 	}
-	// send the accumulated line buffer
-	SPI_send(epd, epd->line_buffer, p - epd->line_buffer);
+	// send data, SPI_send completes the previous line first
+	SPI_send(epd, CU8(0x70, 0x0a), 2);
 
-	// output data to panel
-	SPI_send(epd, CU8(0x70, 0x02), 2);
-	SPI_send(epd, CU8(0x72, 0x07), 2);
+	// send the accumulated line buffer, the next line is built meanwhile
+	SPI_line_start(epd, buffer, p - buffer);
+	epd->line_buffer_index ^= 1;
 
 	//Delay_ms(1);
 }
@@ -758,47 +1177,109 @@ static void one_line(EPD_HandleTypeDef *epd, uint16_t line, const uint8_t *data,
 // Low Level SPI Commands
 // SPI Send Function.
 static void SPI_send(EPD_HandleTypeDef *epd, uint8_t *pData, uint16_t Size) {
+	uint32_t start;
+
+	// Complete a line still in flight
+	SPI_line_finish(epd);
 	// Write CS Low
 	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, LOW);
 	// Send Data
+	start = DWT->CYCCNT;
 	HAL_SPI_Transmit(epd->spi, pData, Size, 1000);
+	spi_bucket->wait_cycles += DWT->CYCCNT - start;
 	// Write CS High
 	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, HIGH);
+	spi_bucket->bytes += Size;
+	spi_bucket->transactions++;
+	spi_bucket->cs_toggles += 2;
 	// Delay for 10us
-	Delay_us(10);
+	cs_guard();
 }
 
 // SPI Read Function
 static void SPI_read(EPD_HandleTypeDef *epd, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size){
+	uint32_t start;
+
+	// Complete a line still in flight
+	SPI_line_finish(epd);
 	// Write CS Low
 	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, LOW);
 	// Send Data
+	start = DWT->CYCCNT;
 	HAL_SPI_TransmitReceive(epd->spi, pTxData, pRxData, Size, 1000);
+	spi_bucket->wait_cycles += DWT->CYCCNT - start;
 	// Write CS High
 	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, HIGH);
+	spi_bucket->bytes += Size;
+	spi_bucket->transactions++;
+	spi_bucket->cs_toggles += 2;
 	// Delay for 10us
-	Delay_us(10);
+	cs_guard();
 }
 
+// Start sending a line buffer by DMA, CS stays low until SPI_line_finish
+static void SPI_line_start(EPD_HandleTypeDef *epd, uint8_t *pData, uint16_t Size) {
+	// Write CS Low
+	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, LOW);
 
+	spi_bucket->bytes += Size;
+	spi_bucket->transactions++;
+	spi_bucket->cs_toggles++;
 
+	if ((NULL == epd->spi->hdmatx) || (HAL_OK != HAL_SPI_Transmit_DMA(epd->spi, pData, Size))) {
+		// No DMA on this SPI, send it blocking
+		uint32_t start = DWT->CYCCNT;
+		HAL_SPI_Transmit(epd->spi, pData, Size, 1000);
+		spi_bucket->wait_cycles += DWT->CYCCNT - start;
+	}
+	epd->line_pending = true;
+}
 
+// Wait for the line in flight and output it to the panel
+static void SPI_line_finish(EPD_HandleTypeDef *epd) {
+	uint32_t startTime;
+	uint32_t start;
 
+	if (!epd->line_pending) {
+		return;
+	}
+	epd->line_pending = false;
+	startTime = HAL_GetTick();
+	start = DWT->CYCCNT;
+
+	// The DMA interrupt returns the SPI to ready once the last byte is out
+	while (HAL_SPI_STATE_READY != HAL_SPI_GetState(epd->spi)) {
+		if (HAL_GetTick() - startTime > 1000) {
+			HAL_SPI_Abort(epd->spi);
+			break;
+		}
+	}
+	spi_bucket->wait_cycles += DWT->CYCCNT - start;
+	// Write CS High
+	HAL_GPIO_WritePin(epd->spi_cs_port, epd->spi_cs_pin, HIGH);
+	spi_bucket->cs_toggles++;
+	// Delay for 10us
+	cs_guard();
 
+	// output data to panel
+	SPI_send(epd, CU8(0x70, 0x02), 2);
+	SPI_send(epd, CU8(0x72, 0x07), 2);
+}
 
+// CS high time between two transfers, counted with the time it really took
+static void cs_guard(void) {
+	uint32_t start = DWT->CYCCNT;
 
+	Delay_us(EPD_CS_GUARD_US);
+	spi_bucket->guards++;
+	spi_bucket->guard_cycles += DWT->CYCCNT - start;
+}
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+// bytes of a line buffer as one_line fills it
+static uint16_t line_length(EPD_HandleTypeDef *epd) {
+	return 1                                                   // command byte
+		+ (epd->pre_border_byte ? 1 : 0)
+		+ 2 * epd->bytes_per_line                              // two bits per pixel
+		+ (epd->middle_scan ? 1 : 2) * epd->bytes_per_scan
+		+ ((EPD_BORDER_BYTE_NONE != epd->border_byte) ? 1 : 0);
+}
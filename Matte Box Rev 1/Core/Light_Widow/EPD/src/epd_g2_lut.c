@@ -0,0 +1,378 @@
+/*
+ * epd_g2_lut.c
+ *
+ *  Pixel transform tables of the G2 line encoder.
+ *  Generated by Tools/epd_lut_gen.py, do not edit.
+ */
+
+#include "epd_g2_lut.h"
+
+#if EPD_PIXEL_LUT
+
+// even_pixels, pixel pairs already swapped
+const uint8_t epd_lut_even[4][256] = {
+	{	// EPD_compensate
+		0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf,
+		0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf,
+		0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab,
+		0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab,
+		0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf,
+		0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf,
+		0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab,
+		0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab,
+		0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xae, 0xae,
+		0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xae, 0xae,
+		0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa,
+		0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa,
+		0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xae, 0xae,
+		0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xae, 0xae,
+		0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa,
+		0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa
+	},
+	{	// EPD_white
+		0xaa, 0xaa, 0x6a, 0x6a, 0xaa, 0xaa, 0x6a, 0x6a, 0x9a, 0x9a, 0x5a, 0x5a, 0x9a, 0x9a, 0x5a, 0x5a,
+		0xaa, 0xaa, 0x6a, 0x6a, 0xaa, 0xaa, 0x6a, 0x6a, 0x9a, 0x9a, 0x5a, 0x5a, 0x9a, 0x9a, 0x5a, 0x5a,
+		0xa6, 0xa6, 0x66, 0x66, 0xa6, 0xa6, 0x66, 0x66, 0x96, 0x96, 0x56, 0x56, 0x96, 0x96, 0x56, 0x56,
+		0xa6, 0xa6, 0x66, 0x66, 0xa6, 0xa6, 0x66, 0x66, 0x96, 0x96, 0x56, 0x56, 0x96, 0x96, 0x56, 0x56,
+		0xaa, 0xaa, 0x6a, 0x6a, 0xaa, 0xaa, 0x6a, 0x6a, 0x9a, 0x9a, 0x5a, 0x5a, 0x9a, 0x9a, 0x5a, 0x5a,
+		0xaa, 0xaa, 0x6a, 0x6a, 0xaa, 0xaa, 0x6a, 0x6a, 0x9a, 0x9a, 0x5a, 0x5a, 0x9a, 0x9a, 0x5a, 0x5a,
+		0xa6, 0xa6, 0x66, 0x66, 0xa6, 0xa6, 0x66, 0x66, 0x96, 0x96, 0x56, 0x56, 0x96, 0x96, 0x56, 0x56,
+		0xa6, 0xa6, 0x66, 0x66, 0xa6, 0xa6, 0x66, 0x66, 0x96, 0x96, 0x56, 0x56, 0x96, 0x96, 0x56, 0x56,
+		0xa9, 0xa9, 0x69, 0x69, 0xa9, 0xa9, 0x69, 0x69, 0x99, 0x99, 0x59, 0x59, 0x99, 0x99, 0x59, 0x59,
+		0xa9, 0xa9, 0x69, 0x69, 0xa9, 0xa9, 0x69, 0x69, 0x99, 0x99, 0x59, 0x59, 0x99, 0x99, 0x59, 0x59,
+		0xa5, 0xa5, 0x65, 0x65, 0xa5, 0xa5, 0x65, 0x65, 0x95, 0x95, 0x55, 0x55, 0x95, 0x95, 0x55, 0x55,
+		0xa5, 0xa5, 0x65, 0x65, 0xa5, 0xa5, 0x65, 0x65, 0x95, 0x95, 0x55, 0x55, 0x95, 0x95, 0x55, 0x55,
+		0xa9, 0xa9, 0x69, 0x69, 0xa9, 0xa9, 0x69, 0x69, 0x99, 0x99, 0x59, 0x59, 0x99, 0x99, 0x59, 0x59,
+		0xa9, 0xa9, 0x69, 0x69, 0xa9, 0xa9, 0x69, 0x69, 0x99, 0x99, 0x59, 0x59, 0x99, 0x99, 0x59, 0x59,
+		0xa5, 0xa5, 0x65, 0x65, 0xa5, 0xa5, 0x65, 0x65, 0x95, 0x95, 0x55, 0x55, 0x95, 0x95, 0x55, 0x55,
+		0xa5, 0xa5, 0x65, 0x65, 0xa5, 0xa5, 0x65, 0x65, 0x95, 0x95, 0x55, 0x55, 0x95, 0x95, 0x55, 0x55
+	},
+	{	// EPD_inverse
+		0xff, 0xff, 0x7f, 0x7f, 0xff, 0xff, 0x7f, 0x7f, 0xdf, 0xdf, 0x5f, 0x5f, 0xdf, 0xdf, 0x5f, 0x5f,
+		0xff, 0xff, 0x7f, 0x7f, 0xff, 0xff, 0x7f, 0x7f, 0xdf, 0xdf, 0x5f, 0x5f, 0xdf, 0xdf, 0x5f, 0x5f,
+		0xf7, 0xf7, 0x77, 0x77, 0xf7, 0xf7, 0x77, 0x77, 0xd7, 0xd7, 0x57, 0x57, 0xd7, 0xd7, 0x57, 0x57,
+		0xf7, 0xf7, 0x77, 0x77, 0xf7, 0xf7, 0x77, 0x77, 0xd7, 0xd7, 0x57, 0x57, 0xd7, 0xd7, 0x57, 0x57,
+		0xff, 0xff, 0x7f, 0x7f, 0xff, 0xff, 0x7f, 0x7f, 0xdf, 0xdf, 0x5f, 0x5f, 0xdf, 0xdf, 0x5f, 0x5f,
+		0xff, 0xff, 0x7f, 0x7f, 0xff, 0xff, 0x7f, 0x7f, 0xdf, 0xdf, 0x5f, 0x5f, 0xdf, 0xdf, 0x5f, 0x5f,
+		0xf7, 0xf7, 0x77, 0x77, 0xf7, 0xf7, 0x77, 0x77, 0xd7, 0xd7, 0x57, 0x57, 0xd7, 0xd7, 0x57, 0x57,
+		0xf7, 0xf7, 0x77, 0x77, 0xf7, 0xf7, 0x77, 0x77, 0xd7, 0xd7, 0x57, 0x57, 0xd7, 0xd7, 0x57, 0x57,
+		0xfd, 0xfd, 0x7d, 0x7d, 0xfd, 0xfd, 0x7d, 0x7d, 0xdd, 0xdd, 0x5d, 0x5d, 0xdd, 0xdd, 0x5d, 0x5d,
+		0xfd, 0xfd, 0x7d, 0x7d, 0xfd, 0xfd, 0x7d, 0x7d, 0xdd, 0xdd, 0x5d, 0x5d, 0xdd, 0xdd, 0x5d, 0x5d,
+		0xf5, 0xf5, 0x75, 0x75, 0xf5, 0xf5, 0x75, 0x75, 0xd5, 0xd5, 0x55, 0x55, 0xd5, 0xd5, 0x55, 0x55,
+		0xf5, 0xf5, 0x75, 0x75, 0xf5, 0xf5, 0x75, 0x75, 0xd5, 0xd5, 0x55, 0x55, 0xd5, 0xd5, 0x55, 0x55,
+		0xfd, 0xfd, 0x7d, 0x7d, 0xfd, 0xfd, 0x7d, 0x7d, 0xdd, 0xdd, 0x5d, 0x5d, 0xdd, 0xdd, 0x5d, 0x5d,
+		0xfd, 0xfd, 0x7d, 0x7d, 0xfd, 0xfd, 0x7d, 0x7d, 0xdd, 0xdd, 0x5d, 0x5d, 0xdd, 0xdd, 0x5d, 0x5d,
+		0xf5, 0xf5, 0x75, 0x75, 0xf5, 0xf5, 0x75, 0x75, 0xd5, 0xd5, 0x55, 0x55, 0xd5, 0xd5, 0x55, 0x55,
+		0xf5, 0xf5, 0x75, 0x75, 0xf5, 0xf5, 0x75, 0x75, 0xd5, 0xd5, 0x55, 0x55, 0xd5, 0xd5, 0x55, 0x55
+	},
+	{	// EPD_normal
+		0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa,
+		0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa,
+		0xae, 0xae, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe,
+		0xae, 0xae, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe,
+		0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa,
+		0xaa, 0xaa, 0xea, 0xea, 0xaa, 0xaa, 0xea, 0xea, 0xba, 0xba, 0xfa, 0xfa, 0xba, 0xba, 0xfa, 0xfa,
+		0xae, 0xae, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe,
+		0xae, 0xae, 0xee, 0xee, 0xae, 0xae, 0xee, 0xee, 0xbe, 0xbe, 0xfe, 0xfe, 0xbe, 0xbe, 0xfe, 0xfe,
+		0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb,
+		0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb,
+		0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff,
+		0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff,
+		0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb,
+		0xab, 0xab, 0xeb, 0xeb, 0xab, 0xab, 0xeb, 0xeb, 0xbb, 0xbb, 0xfb, 0xfb, 0xbb, 0xbb, 0xfb, 0xfb,
+		0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff,
+		0xaf, 0xaf, 0xef, 0xef, 0xaf, 0xaf, 0xef, 0xef, 0xbf, 0xbf, 0xff, 0xff, 0xbf, 0xbf, 0xff, 0xff
+	}
+};
+
+// odd_pixels
+const uint8_t epd_lut_odd[4][256] = {
+	{	// EPD_compensate
+		0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa,
+		0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea, 0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea,
+		0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa,
+		0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea, 0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea,
+		0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba, 0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba,
+		0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa, 0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa,
+		0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba, 0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba,
+		0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa, 0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa,
+		0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa,
+		0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea, 0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea,
+		0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfa, 0xfb, 0xfa,
+		0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea, 0xef, 0xee, 0xef, 0xee, 0xeb, 0xea, 0xeb, 0xea,
+		0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba, 0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba,
+		0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa, 0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa,
+		0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba, 0xbf, 0xbe, 0xbf, 0xbe, 0xbb, 0xba, 0xbb, 0xba,
+		0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa, 0xaf, 0xae, 0xaf, 0xae, 0xab, 0xaa, 0xab, 0xaa
+	},
+	{	// EPD_white
+		0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5, 0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5,
+		0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95, 0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95,
+		0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5, 0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5,
+		0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95, 0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95,
+		0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65, 0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65,
+		0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55, 0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55,
+		0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65, 0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65,
+		0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55, 0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55,
+		0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5, 0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5,
+		0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95, 0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95,
+		0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5, 0xaa, 0xa9, 0xaa, 0xa9, 0xa6, 0xa5, 0xa6, 0xa5,
+		0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95, 0x9a, 0x99, 0x9a, 0x99, 0x96, 0x95, 0x96, 0x95,
+		0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65, 0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65,
+		0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55, 0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55,
+		0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65, 0x6a, 0x69, 0x6a, 0x69, 0x66, 0x65, 0x66, 0x65,
+		0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55, 0x5a, 0x59, 0x5a, 0x59, 0x56, 0x55, 0x56, 0x55
+	},
+	{	// EPD_inverse
+		0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5,
+		0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5, 0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5,
+		0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5,
+		0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5, 0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5,
+		0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75, 0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75,
+		0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55, 0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55,
+		0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75, 0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75,
+		0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55, 0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55,
+		0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5,
+		0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5, 0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5,
+		0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xf5, 0xf7, 0xf5,
+		0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5, 0xdf, 0xdd, 0xdf, 0xdd, 0xd7, 0xd5, 0xd7, 0xd5,
+		0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75, 0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75,
+		0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55, 0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55,
+		0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75, 0x7f, 0x7d, 0x7f, 0x7d, 0x77, 0x75, 0x77, 0x75,
+		0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55, 0x5f, 0x5d, 0x5f, 0x5d, 0x57, 0x55, 0x57, 0x55
+	},
+	{	// EPD_normal
+		0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf, 0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf,
+		0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf, 0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf,
+		0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf, 0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf,
+		0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf, 0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf,
+		0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef, 0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef,
+		0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff,
+		0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef, 0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef,
+		0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff,
+		0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf, 0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf,
+		0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf, 0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf,
+		0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf, 0xaa, 0xab, 0xaa, 0xab, 0xae, 0xaf, 0xae, 0xaf,
+		0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf, 0xba, 0xbb, 0xba, 0xbb, 0xbe, 0xbf, 0xbe, 0xbf,
+		0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef, 0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef,
+		0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff,
+		0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef, 0xea, 0xeb, 0xea, 0xeb, 0xee, 0xef, 0xee, 0xef,
+		0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xfa, 0xfb, 0xfe, 0xff, 0xfe, 0xff
+	}
+};
+
+// all_pixels, interleaved to 16 bits
+const uint16_t epd_lut_all[4][256] = {
+	{	// EPD_compensate
+		0xffff, 0xfffe, 0xfffb, 0xfffa, 0xffef, 0xffee, 0xffeb, 0xffea,
+		0xffbf, 0xffbe, 0xffbb, 0xffba, 0xffaf, 0xffae, 0xffab, 0xffaa,
+		0xfeff, 0xfefe, 0xfefb, 0xfefa, 0xfeef, 0xfeee, 0xfeeb, 0xfeea,
+		0xfebf, 0xfebe, 0xfebb, 0xfeba, 0xfeaf, 0xfeae, 0xfeab, 0xfeaa,
+		0xfbff, 0xfbfe, 0xfbfb, 0xfbfa, 0xfbef, 0xfbee, 0xfbeb, 0xfbea,
+		0xfbbf, 0xfbbe, 0xfbbb, 0xfbba, 0xfbaf, 0xfbae, 0xfbab, 0xfbaa,
+		0xfaff, 0xfafe, 0xfafb, 0xfafa, 0xfaef, 0xfaee, 0xfaeb, 0xfaea,
+		0xfabf, 0xfabe, 0xfabb, 0xfaba, 0xfaaf, 0xfaae, 0xfaab, 0xfaaa,
+		0xefff, 0xeffe, 0xeffb, 0xeffa, 0xefef, 0xefee, 0xefeb, 0xefea,
+		0xefbf, 0xefbe, 0xefbb, 0xefba, 0xefaf, 0xefae, 0xefab, 0xefaa,
+		0xeeff, 0xeefe, 0xeefb, 0xeefa, 0xeeef, 0xeeee, 0xeeeb, 0xeeea,
+		0xeebf, 0xeebe, 0xeebb, 0xeeba, 0xeeaf, 0xeeae, 0xeeab, 0xeeaa,
+		0xebff, 0xebfe, 0xebfb, 0xebfa, 0xebef, 0xebee, 0xebeb, 0xebea,
+		0xebbf, 0xebbe, 0xebbb, 0xebba, 0xebaf, 0xebae, 0xebab, 0xebaa,
+		0xeaff, 0xeafe, 0xeafb, 0xeafa, 0xeaef, 0xeaee, 0xeaeb, 0xeaea,
+		0xeabf, 0xeabe, 0xeabb, 0xeaba, 0xeaaf, 0xeaae, 0xeaab, 0xeaaa,
+		0xbfff, 0xbffe, 0xbffb, 0xbffa, 0xbfef, 0xbfee, 0xbfeb, 0xbfea,
+		0xbfbf, 0xbfbe, 0xbfbb, 0xbfba, 0xbfaf, 0xbfae, 0xbfab, 0xbfaa,
+		0xbeff, 0xbefe, 0xbefb, 0xbefa, 0xbeef, 0xbeee, 0xbeeb, 0xbeea,
+		0xbebf, 0xbebe, 0xbebb, 0xbeba, 0xbeaf, 0xbeae, 0xbeab, 0xbeaa,
+		0xbbff, 0xbbfe, 0xbbfb, 0xbbfa, 0xbbef, 0xbbee, 0xbbeb, 0xbbea,
+		0xbbbf, 0xbbbe, 0xbbbb, 0xbbba, 0xbbaf, 0xbbae, 0xbbab, 0xbbaa,
+		0xbaff, 0xbafe, 0xbafb, 0xbafa, 0xbaef, 0xbaee, 0xbaeb, 0xbaea,
+		0xbabf, 0xbabe, 0xbabb, 0xbaba, 0xbaaf, 0xbaae, 0xbaab, 0xbaaa,
+		0xafff, 0xaffe, 0xaffb, 0xaffa, 0xafef, 0xafee, 0xafeb, 0xafea,
+		0xafbf, 0xafbe, 0xafbb, 0xafba, 0xafaf, 0xafae, 0xafab, 0xafaa,
+		0xaeff, 0xaefe, 0xaefb, 0xaefa, 0xaeef, 0xaeee, 0xaeeb, 0xaeea,
+		0xaebf, 0xaebe, 0xaebb, 0xaeba, 0xaeaf, 0xaeae, 0xaeab, 0xaeaa,
+		0xabff, 0xabfe, 0xabfb, 0xabfa, 0xabef, 0xabee, 0xabeb, 0xabea,
+		0xabbf, 0xabbe, 0xabbb, 0xabba, 0xabaf, 0xabae, 0xabab, 0xabaa,
+		0xaaff, 0xaafe, 0xaafb, 0xaafa, 0xaaef, 0xaaee, 0xaaeb, 0xaaea,
+		0xaabf, 0xaabe, 0xaabb, 0xaaba, 0xaaaf, 0xaaae, 0xaaab, 0xaaaa
+	},
+	{	// EPD_white
+		0xaaaa, 0xaaa9, 0xaaa6, 0xaaa5, 0xaa9a, 0xaa99, 0xaa96, 0xaa95,
+		0xaa6a, 0xaa69, 0xaa66, 0xaa65, 0xaa5a, 0xaa59, 0xaa56, 0xaa55,
+		0xa9aa, 0xa9a9, 0xa9a6, 0xa9a5, 0xa99a, 0xa999, 0xa996, 0xa995,
+		0xa96a, 0xa969, 0xa966, 0xa965, 0xa95a, 0xa959, 0xa956, 0xa955,
+		0xa6aa, 0xa6a9, 0xa6a6, 0xa6a5, 0xa69a, 0xa699, 0xa696, 0xa695,
+		0xa66a, 0xa669, 0xa666, 0xa665, 0xa65a, 0xa659, 0xa656, 0xa655,
+		0xa5aa, 0xa5a9, 0xa5a6, 0xa5a5, 0xa59a, 0xa599, 0xa596, 0xa595,
+		0xa56a, 0xa569, 0xa566, 0xa565, 0xa55a, 0xa559, 0xa556, 0xa555,
+		0x9aaa, 0x9aa9, 0x9aa6, 0x9aa5, 0x9a9a, 0x9a99, 0x9a96, 0x9a95,
+		0x9a6a, 0x9a69, 0x9a66, 0x9a65, 0x9a5a, 0x9a59, 0x9a56, 0x9a55,
+		0x99aa, 0x99a9, 0x99a6, 0x99a5, 0x999a, 0x9999, 0x9996, 0x9995,
+		0x996a, 0x9969, 0x9966, 0x9965, 0x995a, 0x9959, 0x9956, 0x9955,
+		0x96aa, 0x96a9, 0x96a6, 0x96a5, 0x969a, 0x9699, 0x9696, 0x9695,
+		0x966a, 0x9669, 0x9666, 0x9665, 0x965a, 0x9659, 0x9656, 0x9655,
+		0x95aa, 0x95a9, 0x95a6, 0x95a5, 0x959a, 0x9599, 0x9596, 0x9595,
+		0x956a, 0x9569, 0x9566, 0x9565, 0x955a, 0x9559, 0x9556, 0x9555,
+		0x6aaa, 0x6aa9, 0x6aa6, 0x6aa5, 0x6a9a, 0x6a99, 0x6a96, 0x6a95,
+		0x6a6a, 0x6a69, 0x6a66, 0x6a65, 0x6a5a, 0x6a59, 0x6a56, 0x6a55,
+		0x69aa, 0x69a9, 0x69a6, 0x69a5, 0x699a, 0x6999, 0x6996, 0x6995,
+		0x696a, 0x6969, 0x6966, 0x6965, 0x695a, 0x6959, 0x6956, 0x6955,
+		0x66aa, 0x66a9, 0x66a6, 0x66a5, 0x669a, 0x6699, 0x6696, 0x6695,
+		0x666a, 0x6669, 0x6666, 0x6665, 0x665a, 0x6659, 0x6656, 0x6655,
+		0x65aa, 0x65a9, 0x65a6, 0x65a5, 0x659a, 0x6599, 0x6596, 0x6595,
+		0x656a, 0x6569, 0x6566, 0x6565, 0x655a, 0x6559, 0x6556, 0x6555,
+		0x5aaa, 0x5aa9, 0x5aa6, 0x5aa5, 0x5a9a, 0x5a99, 0x5a96, 0x5a95,
+		0x5a6a, 0x5a69, 0x5a66, 0x5a65, 0x5a5a, 0x5a59, 0x5a56, 0x5a55,
+		0x59aa, 0x59a9, 0x59a6, 0x59a5, 0x599a, 0x5999, 0x5996, 0x5995,
+		0x596a, 0x5969, 0x5966, 0x5965, 0x595a, 0x5959, 0x5956, 0x5955,
+		0x56aa, 0x56a9, 0x56a6, 0x56a5, 0x569a, 0x5699, 0x5696, 0x5695,
+		0x566a, 0x5669, 0x5666, 0x5665, 0x565a, 0x5659, 0x5656, 0x5655,
+		0x55aa, 0x55a9, 0x55a6, 0x55a5, 0x559a, 0x5599, 0x5596, 0x5595,
+		0x556a, 0x5569, 0x5566, 0x5565, 0x555a, 0x5559, 0x5556, 0x5555
+	},
+	{	// EPD_inverse
+		0xffff, 0xfffd, 0xfff7, 0xfff5, 0xffdf, 0xffdd, 0xffd7, 0xffd5,
+		0xff7f, 0xff7d, 0xff77, 0xff75, 0xff5f, 0xff5d, 0xff57, 0xff55,
+		0xfdff, 0xfdfd, 0xfdf7, 0xfdf5, 0xfddf, 0xfddd, 0xfdd7, 0xfdd5,
+		0xfd7f, 0xfd7d, 0xfd77, 0xfd75, 0xfd5f, 0xfd5d, 0xfd57, 0xfd55,
+		0xf7ff, 0xf7fd, 0xf7f7, 0xf7f5, 0xf7df, 0xf7dd, 0xf7d7, 0xf7d5,
+		0xf77f, 0xf77d, 0xf777, 0xf775, 0xf75f, 0xf75d, 0xf757, 0xf755,
+		0xf5ff, 0xf5fd, 0xf5f7, 0xf5f5, 0xf5df, 0xf5dd, 0xf5d7, 0xf5d5,
+		0xf57f, 0xf57d, 0xf577, 0xf575, 0xf55f, 0xf55d, 0xf557, 0xf555,
+		0xdfff, 0xdffd, 0xdff7, 0xdff5, 0xdfdf, 0xdfdd, 0xdfd7, 0xdfd5,
+		0xdf7f, 0xdf7d, 0xdf77, 0xdf75, 0xdf5f, 0xdf5d, 0xdf57, 0xdf55,
+		0xddff, 0xddfd, 0xddf7, 0xddf5, 0xdddf, 0xdddd, 0xddd7, 0xddd5,
+		0xdd7f, 0xdd7d, 0xdd77, 0xdd75, 0xdd5f, 0xdd5d, 0xdd57, 0xdd55,
+		0xd7ff, 0xd7fd, 0xd7f7, 0xd7f5, 0xd7df, 0xd7dd, 0xd7d7, 0xd7d5,
+		0xd77f, 0xd77d, 0xd777, 0xd775, 0xd75f, 0xd75d, 0xd757, 0xd755,
+		0xd5ff, 0xd5fd, 0xd5f7, 0xd5f5, 0xd5df, 0xd5dd, 0xd5d7, 0xd5d5,
+		0xd57f, 0xd57d, 0xd577, 0xd575, 0xd55f, 0xd55d, 0xd557, 0xd555,
+		0x7fff, 0x7ffd, 0x7ff7, 0x7ff5, 0x7fdf, 0x7fdd, 0x7fd7, 0x7fd5,
+		0x7f7f, 0x7f7d, 0x7f77, 0x7f75, 0x7f5f, 0x7f5d, 0x7f57, 0x7f55,
+		0x7dff, 0x7dfd, 0x7df7, 0x7df5, 0x7ddf, 0x7ddd, 0x7dd7, 0x7dd5,
+		0x7d7f, 0x7d7d, 0x7d77, 0x7d75, 0x7d5f, 0x7d5d, 0x7d57, 0x7d55,
+		0x77ff, 0x77fd, 0x77f7, 0x77f5, 0x77df, 0x77dd, 0x77d7, 0x77d5,
+		0x777f, 0x777d, 0x7777, 0x7775, 0x775f, 0x775d, 0x7757, 0x7755,
+		0x75ff, 0x75fd, 0x75f7, 0x75f5, 0x75df, 0x75dd, 0x75d7, 0x75d5,
+		0x757f, 0x757d, 0x7577, 0x7575, 0x755f, 0x755d, 0x7557, 0x7555,
+		0x5fff, 0x5ffd, 0x5ff7, 0x5ff5, 0x5fdf, 0x5fdd, 0x5fd7, 0x5fd5,
+		0x5f7f, 0x5f7d, 0x5f77, 0x5f75, 0x5f5f, 0x5f5d, 0x5f57, 0x5f55,
+		0x5dff, 0x5dfd, 0x5df7, 0x5df5, 0x5ddf, 0x5ddd, 0x5dd7, 0x5dd5,
+		0x5d7f, 0x5d7d, 0x5d77, 0x5d75, 0x5d5f, 0x5d5d, 0x5d57, 0x5d55,
+		0x57ff, 0x57fd, 0x57f7, 0x57f5, 0x57df, 0x57dd, 0x57d7, 0x57d5,
+		0x577f, 0x577d, 0x5777, 0x5775, 0x575f, 0x575d, 0x5757, 0x5755,
+		0x55ff, 0x55fd, 0x55f7, 0x55f5, 0x55df, 0x55dd, 0x55d7, 0x55d5,
+		0x557f, 0x557d, 0x5577, 0x5575, 0x555f, 0x555d, 0x5557, 0x5555
+	},
+	{	// EPD_normal
+		0xaaaa, 0xaaab, 0xaaae, 0xaaaf, 0xaaba, 0xaabb, 0xaabe, 0xaabf,
+		0xaaea, 0xaaeb, 0xaaee, 0xaaef, 0xaafa, 0xaafb, 0xaafe, 0xaaff,
+		0xabaa, 0xabab, 0xabae, 0xabaf, 0xabba, 0xabbb, 0xabbe, 0xabbf,
+		0xabea, 0xabeb, 0xabee, 0xabef, 0xabfa, 0xabfb, 0xabfe, 0xabff,
+		0xaeaa, 0xaeab, 0xaeae, 0xaeaf, 0xaeba, 0xaebb, 0xaebe, 0xaebf,
+		0xaeea, 0xaeeb, 0xaeee, 0xaeef, 0xaefa, 0xaefb, 0xaefe, 0xaeff,
+		0xafaa, 0xafab, 0xafae, 0xafaf, 0xafba, 0xafbb, 0xafbe, 0xafbf,
+		0xafea, 0xafeb, 0xafee, 0xafef, 0xaffa, 0xaffb, 0xaffe, 0xafff,
+		0xbaaa, 0xbaab, 0xbaae, 0xbaaf, 0xbaba, 0xbabb, 0xbabe, 0xbabf,
+		0xbaea, 0xbaeb, 0xbaee, 0xbaef, 0xbafa, 0xbafb, 0xbafe, 0xbaff,
+		0xbbaa, 0xbbab, 0xbbae, 0xbbaf, 0xbbba, 0xbbbb, 0xbbbe, 0xbbbf,
+		0xbbea, 0xbbeb, 0xbbee, 0xbbef, 0xbbfa, 0xbbfb, 0xbbfe, 0xbbff,
+		0xbeaa, 0xbeab, 0xbeae, 0xbeaf, 0xbeba, 0xbebb, 0xbebe, 0xbebf,
+		0xbeea, 0xbeeb, 0xbeee, 0xbeef, 0xbefa, 0xbefb, 0xbefe, 0xbeff,
+		0xbfaa, 0xbfab, 0xbfae, 0xbfaf, 0xbfba, 0xbfbb, 0xbfbe, 0xbfbf,
+		0xbfea, 0xbfeb, 0xbfee, 0xbfef, 0xbffa, 0xbffb, 0xbffe, 0xbfff,
+		0xeaaa, 0xeaab, 0xeaae, 0xeaaf, 0xeaba, 0xeabb, 0xeabe, 0xeabf,
+		0xeaea, 0xeaeb, 0xeaee, 0xeaef, 0xeafa, 0xeafb, 0xeafe, 0xeaff,
+		0xebaa, 0xebab, 0xebae, 0xebaf, 0xebba, 0xebbb, 0xebbe, 0xebbf,
+		0xebea, 0xebeb, 0xebee, 0xebef, 0xebfa, 0xebfb, 0xebfe, 0xebff,
+		0xeeaa, 0xeeab, 0xeeae, 0xeeaf, 0xeeba, 0xeebb, 0xeebe, 0xeebf,
+		0xeeea, 0xeeeb, 0xeeee, 0xeeef, 0xeefa, 0xeefb, 0xeefe, 0xeeff,
+		0xefaa, 0xefab, 0xefae, 0xefaf, 0xefba, 0xefbb, 0xefbe, 0xefbf,
+		0xefea, 0xefeb, 0xefee, 0xefef, 0xeffa, 0xeffb, 0xeffe, 0xefff,
+		0xfaaa, 0xfaab, 0xfaae, 0xfaaf, 0xfaba, 0xfabb, 0xfabe, 0xfabf,
+		0xfaea, 0xfaeb, 0xfaee, 0xfaef, 0xfafa, 0xfafb, 0xfafe, 0xfaff,
+		0xfbaa, 0xfbab, 0xfbae, 0xfbaf, 0xfbba, 0xfbbb, 0xfbbe, 0xfbbf,
+		0xfbea, 0xfbeb, 0xfbee, 0xfbef, 0xfbfa, 0xfbfb, 0xfbfe, 0xfbff,
+		0xfeaa, 0xfeab, 0xfeae, 0xfeaf, 0xfeba, 0xfebb, 0xfebe, 0xfebf,
+		0xfeea, 0xfeeb, 0xfeee, 0xfeef, 0xfefa, 0xfefb, 0xfefe, 0xfeff,
+		0xffaa, 0xffab, 0xffae, 0xffaf, 0xffba, 0xffbb, 0xffbe, 0xffbf,
+		0xffea, 0xffeb, 0xffee, 0xffef, 0xfffa, 0xfffb, 0xfffe, 0xffff
+	}
+};
+
+// partial update masks, indexed by mask ^ data
+const uint8_t epd_lut_even_mask[256] = {
+	0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0,
+	0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0,
+	0x0c, 0x0c, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc,
+	0x0c, 0x0c, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc,
+	0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0,
+	0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0,
+	0x0c, 0x0c, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc,
+	0x0c, 0x0c, 0xcc, 0xcc, 0x0c, 0x0c, 0xcc, 0xcc, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0xfc, 0xfc,
+	0x03, 0x03, 0xc3, 0xc3, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0xf3, 0xf3, 0x33, 0x33, 0xf3, 0xf3,
+	0x03, 0x03, 0xc3, 0xc3, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0xf3, 0xf3, 0x33, 0x33, 0xf3, 0xf3,
+	0x0f, 0x0f, 0xcf, 0xcf, 0x0f, 0x0f, 0xcf, 0xcf, 0x3f, 0x3f, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff,
+	0x0f, 0x0f, 0xcf, 0xcf, 0x0f, 0x0f, 0xcf, 0xcf, 0x3f, 0x3f, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff,
+	0x03, 0x03, 0xc3, 0xc3, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0xf3, 0xf3, 0x33, 0x33, 0xf3, 0xf3,
+	0x03, 0x03, 0xc3, 0xc3, 0x03, 0x03, 0xc3, 0xc3, 0x33, 0x33, 0xf3, 0xf3, 0x33, 0x33, 0xf3, 0xf3,
+	0x0f, 0x0f, 0xcf, 0xcf, 0x0f, 0x0f, 0xcf, 0xcf, 0x3f, 0x3f, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff,
+	0x0f, 0x0f, 0xcf, 0xcf, 0x0f, 0x0f, 0xcf, 0xcf, 0x3f, 0x3f, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff
+};
+
+const uint8_t epd_lut_odd_mask[256] = {
+	0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f, 0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f,
+	0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f, 0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f,
+	0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f, 0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f,
+	0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f, 0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f,
+	0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf, 0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf,
+	0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff,
+	0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf, 0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf,
+	0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff,
+	0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f, 0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f,
+	0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f, 0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f,
+	0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f, 0x00, 0x03, 0x00, 0x03, 0x0c, 0x0f, 0x0c, 0x0f,
+	0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f, 0x30, 0x33, 0x30, 0x33, 0x3c, 0x3f, 0x3c, 0x3f,
+	0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf, 0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf,
+	0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff,
+	0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf, 0xc0, 0xc3, 0xc0, 0xc3, 0xcc, 0xcf, 0xcc, 0xcf,
+	0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xf0, 0xf3, 0xf0, 0xf3, 0xfc, 0xff, 0xfc, 0xff
+};
+
+const uint16_t epd_lut_all_mask[256] = {
+	0x0000, 0x0003, 0x000c, 0x000f, 0x0030, 0x0033, 0x003c, 0x003f,
+	0x00c0, 0x00c3, 0x00cc, 0x00cf, 0x00f0, 0x00f3, 0x00fc, 0x00ff,
+	0x0300, 0x0303, 0x030c, 0x030f, 0x0330, 0x0333, 0x033c, 0x033f,
+	0x03c0, 0x03c3, 0x03cc, 0x03cf, 0x03f0, 0x03f3, 0x03fc, 0x03ff,
+	0x0c00, 0x0c03, 0x0c0c, 0x0c0f, 0x0c30, 0x0c33, 0x0c3c, 0x0c3f,
+	0x0cc0, 0x0cc3, 0x0ccc, 0x0ccf, 0x0cf0, 0x0cf3, 0x0cfc, 0x0cff,
+	0x0f00, 0x0f03, 0x0f0c, 0x0f0f, 0x0f30, 0x0f33, 0x0f3c, 0x0f3f,
+	0x0fc0, 0x0fc3, 0x0fcc, 0x0fcf, 0x0ff0, 0x0ff3, 0x0ffc, 0x0fff,
+	0x3000, 0x3003, 0x300c, 0x300f, 0x3030, 0x3033, 0x303c, 0x303f,
+	0x30c0, 0x30c3, 0x30cc, 0x30cf, 0x30f0, 0x30f3, 0x30fc, 0x30ff,
+	0x3300, 0x3303, 0x330c, 0x330f, 0x3330, 0x3333, 0x333c, 0x333f,
+	0x33c0, 0x33c3, 0x33cc, 0x33cf, 0x33f0, 0x33f3, 0x33fc, 0x33ff,
+	0x3c00, 0x3c03, 0x3c0c, 0x3c0f, 0x3c30, 0x3c33, 0x3c3c, 0x3c3f,
+	0x3cc0, 0x3cc3, 0x3ccc, 0x3ccf, 0x3cf0, 0x3cf3, 0x3cfc, 0x3cff,
+	0x3f00, 0x3f03, 0x3f0c, 0x3f0f, 0x3f30, 0x3f33, 0x3f3c, 0x3f3f,
+	0x3fc0, 0x3fc3, 0x3fcc, 0x3fcf, 0x3ff0, 0x3ff3, 0x3ffc, 0x3fff,
+	0xc000, 0xc003, 0xc00c, 0xc00f, 0xc030, 0xc033, 0xc03c, 0xc03f,
+	0xc0c0, 0xc0c3, 0xc0cc, 0xc0cf, 0xc0f0, 0xc0f3, 0xc0fc, 0xc0ff,
+	0xc300, 0xc303, 0xc30c, 0xc30f, 0xc330, 0xc333, 0xc33c, 0xc33f,
+	0xc3c0, 0xc3c3, 0xc3cc, 0xc3cf, 0xc3f0, 0xc3f3, 0xc3fc, 0xc3ff,
+	0xcc00, 0xcc03, 0xcc0c, 0xcc0f, 0xcc30, 0xcc33, 0xcc3c, 0xcc3f,
+	0xccc0, 0xccc3, 0xcccc, 0xcccf, 0xccf0, 0xccf3, 0xccfc, 0xccff,
+	0xcf00, 0xcf03, 0xcf0c, 0xcf0f, 0xcf30, 0xcf33, 0xcf3c, 0xcf3f,
+	0xcfc0, 0xcfc3, 0xcfcc, 0xcfcf, 0xcff0, 0xcff3, 0xcffc, 0xcfff,
+	0xf000, 0xf003, 0xf00c, 0xf00f, 0xf030, 0xf033, 0xf03c, 0xf03f,
+	0xf0c0, 0xf0c3, 0xf0cc, 0xf0cf, 0xf0f0, 0xf0f3, 0xf0fc, 0xf0ff,
+	0xf300, 0xf303, 0xf30c, 0xf30f, 0xf330, 0xf333, 0xf33c, 0xf33f,
+	0xf3c0, 0xf3c3, 0xf3cc, 0xf3cf, 0xf3f0, 0xf3f3, 0xf3fc, 0xf3ff,
+	0xfc00, 0xfc03, 0xfc0c, 0xfc0f, 0xfc30, 0xfc33, 0xfc3c, 0xfc3f,
+	0xfcc0, 0xfcc3, 0xfccc, 0xfccf, 0xfcf0, 0xfcf3, 0xfcfc, 0xfcff,
+	0xff00, 0xff03, 0xff0c, 0xff0f, 0xff30, 0xff33, 0xff3c, 0xff3f,
+	0xffc0, 0xffc3, 0xffcc, 0xffcf, 0xfff0, 0xfff3, 0xfffc, 0xffff
+};
+
+#endif // EPD_PIXEL_LUT
@@ -6,166 +6,216 @@
  */
 
 
-#include <stdlib.h>
 #include <string.h>
 
 #include "epd_gfx.h"
 #include "epd_g2.h"
 
-uint8_t* b_canvas;
+// Front and back frame, the roles swap after every EPD update
+static uint8_t canvasBuffer[2][CANVAS_BUFFER_SIZE];
+
+typedef struct {					// What is drawn in a filter slot
+	uint8_t name[10];
+	uint8_t inverted;
+} slotContent_t;
+
+// Every slot starts out empty, the way setupIOs draws the first frame
+static slotContent_t drawnSlots[FILTER_SECTION_SIZE];
+
+// Partial updates of each slot since the last full refresh, ghosting builds up per slot
+static uint8_t slotUpdates[FILTER_SECTION_SIZE];
+static uint32_t lastDrawTick;
+
+// Latest redraw request, a newer one replaces it until the EPD is free to draw it
+static slotContent_t targetSlots[FILTER_SECTION_SIZE];
+static bool redrawPending = false;
+static uint32_t requestTick;			// First request that isn't on the display yet
+
+// EPD update in flight, stepped by canvas_Process
+static bool refreshRunning = false;
+static bool refreshFull;
+static bool refreshMeasured;			// Started by a redraw request, counts for the latency
+static uint32_t refreshRequestTick;
+static Canvas_refresh_stats refreshStats;
+
+// Fonts a filter name may take, largest first
+static sFONT* const layoutFonts[] = {&Font24, &Font20, &Font16, &Font12, &Font8};
+
+typedef enum {						// How text is drawn, fonts without glyph columns always use pixels
+	TEXT_PIXELS,
+	TEXT_GLYPHS,					// canvas_BlitGlyph per character
+	TEXT_PACKED,					// Same, the glyphs unpacked from the asset pack even when pre-rotated ones exist
+	TEXT_CACHED						// Filter names from the name cache, other text per glyph
+} textPath_t;
+
+// Only the benchmark steps through the other paths
+static textPath_t textPath = TEXT_CACHED;
+
+typedef struct {					// A rendered filter name, in the fonts_rotated.c column layout
+	uint8_t name[FILTER_NAME_LEN];	// Key, zero padded, with the font and line length
+	sFONT* font;					// NULL = entry unused
+	uint8_t lineLen;
+	uint8_t lines;
+	uint8_t cols;
+	uint32_t last_use;
+	uint8_t columns[CANVAS_NAME_MAX_COLS * CANVAS_NAME_COL_BYTES];
+} nameBitmap_t;
+
+// The names are masks, the highlight color is applied when they are copied into a slot
+static nameBitmap_t nameCache[CANVAS_NAME_CACHE_SIZE];
+static uint32_t nameCacheClock = 0;
+static Canvas_cache_stats nameCacheStats;
 
 
 /************************************************************************************************
  * LOCAL PROTOTYPES
  ***********************************************************************************************/
-void canvas_DrawFilledRectangle(Canvas* canvas, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t colored);
-void canvas_DrawVerticalLine(Canvas* canvas, uint8_t x, uint8_t y, uint8_t line_height, uint8_t colored);
+static void canvas_ComputeLayout(Canvas* canvas, uint8_t slots);
+static void canvas_DrawBackground(Canvas* canvas);
+static void canvas_DrawSlot(Canvas* canvas, uint8_t filterStage, const slotContent_t* slot);
+static void canvas_FillAbsoluteRect(Canvas* canvas, Canvas_rect r, int colored);
+static void canvas_SetAbsolutePixel(Canvas* canvas, uint16_t x, uint16_t y, int colored);
+static void canvas_PutPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored);
+static bool canvas_ToAbsoluteRect(Canvas* canvas, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, Canvas_rect* r);
+static void canvas_MergeDamage(Canvas* canvas, Canvas_rect r);
+static void canvas_SwapBuffers(Canvas* canvas, EPD_HandleTypeDef* epd);
+static void canvas_StartRedraw(Canvas* canvas, EPD_HandleTypeDef* epd);
+static void canvas_StartRefresh(Canvas* canvas, EPD_HandleTypeDef* epd, bool full);
+static void canvas_FinishRefresh(Canvas* canvas, EPD_HandleTypeDef* epd);
+static uint8_t canvas_GhostLimit(EPD_HandleTypeDef* epd);
+static bool canvas_HasColumns(const sFONT* font);
+static const uint8_t* canvas_GlyphColumns(const sFONT* font, char ascii_char, uint8_t* buf);
+static void canvas_UnpackGlyph(const sFONT* font, uint8_t c, uint8_t* buf);
+static void canvas_BlitGlyph(Canvas* canvas, uint16_t x, uint16_t y, char ascii_char, sFONT* font, int colored);
+static void canvas_BlitColumns(Canvas* canvas, uint16_t x, uint16_t y, const uint8_t* col, uint16_t width, uint16_t height, int colored);
+static nameBitmap_t* canvas_GetNameBitmap(const uint8_t* name, uint8_t nameLen, const Canvas_text_fit* fit);
+static void canvas_DrawName(Canvas* canvas, uint16_t x, uint16_t y, const uint8_t* name, uint8_t nameLen, const Canvas_text_fit* fit, int colored);
 
 /************************************************************************************************
  * GLOBAL FUNCTIONS
  ***********************************************************************************************/
 
 Canvas_error Canvas_Init(Canvas* canvas, uint16_t width, uint16_t height) {
-	// Allocate memory for the buffer canvas depending on display size
-	b_canvas = (uint8_t *)malloc(width * height);
-	memset(b_canvas, 0x00, width * height);
+	/* 1 byte = 8 pixels, so the width should be the multiple of 8 */
+	width = width % 8 ? width + 8 - (width % 8) : width;
 
-	if (b_canvas == NULL){
+	// The display has to fit the static frame buffers
+	if ((uint32_t) width * height / 8 > CANVAS_BUFFER_SIZE){
 		return CANVAS_MEM_ERROR;
 	}
+	memset(canvasBuffer, 0x00, sizeof(canvasBuffer));
+
 	canvas->rotate = ROTATE_0;
-	canvas->image = b_canvas;
-	/* 1 byte = 8 pixels, so the width should be the multiple of 8 */
-	canvas->width = width % 8 ? width + 8 - (width % 8) : width;
+	canvas->image = canvasBuffer[0];
+	canvas->front = canvasBuffer[1];
+	canvas->width = width;
 	canvas->height = height;
+	canvas->damage_count = 0;
+
+	canvas_ComputeLayout(canvas, FILTER_SECTION_SIZE);
 
 	return CANVAS_OK;
 }
 
 // Responsible for taking the software filter set model and updating the EPD
 void canvas_DrawFilters(Canvas* canvas, EPD_HandleTypeDef* epd, filterSection_t *currentFilters, uint8_t invPosition) {
-// This draws the filter names based on the position stored in the filter model
-// It also recognizes longer names and splits them up into 2 lines
-// It also keeps track of how many times the screen has been refreshed
-	// If it has been refreshed 5+ times, perform a full refresh
+// The request only stores what the slots should show. canvas_Process draws it once the EPD is free,
+// a request that arrives while an update is running replaces the one still waiting,
+// so only the latest filter line up gets drawn.
 // invPosition inverts the color/filter name on a specific position. 0 = no invert, >0 = position is inverted
+// Only the slots of the layout are drawn, see canvas_SetSlots.
 
-// TODO - Find out how many filter slots are installed and draw the canvas correctly
-
-	uint8_t tmpName[10] = {0};
-	uint8_t nameLen;
-	uint8_t startPixelY;
-	uint8_t startPixelX;
-
-	uint8_t prevImage[2400];
-	static uint8_t refreshCount = 0;	// Keep track of how many times the screen has been updated
-
-	// Store the current image so that a partial update can be compared
-	memcpy(prevImage, canvas->image, 2400);
-
-	//Start with a clear BG
-	canvas_setBGImage(canvas, image_background);
-	canvas_DrawStringAt(canvas, 10, 3, "FILTERS", &Font16, 1);
+	// Loop through all filter stages
+	for (uint8_t filterStage = 1; filterStage <= canvas->layout.slots; filterStage++){
+		slotContent_t* slot = &targetSlots[filterStage - 1];
 
-	// If a position is inverted, draw a filled rectangle in that position
-	if (invPosition > 0) {
-		switch (invPosition) {
-			case 1:
-				canvas_DrawFilledRectangle(canvas, 2, 19, 93, 75, false);
-				break;
-			case 2:
-				canvas_DrawFilledRectangle(canvas, 2, 82, 93, 137, false);
-				break;
-			case 3:
-				canvas_DrawFilledRectangle(canvas, 2, 144, 93, 198, false);
-				break;
-		}
-	}
+		memset(slot, 0, sizeof(slotContent_t));
+		slot->inverted = (filterStage == invPosition);
 
-	// Loop through all filter stages
-	for (uint8_t filterStage = 1; filterStage <= FILTER_SECTION_SIZE; filterStage++){
 		// Try to find a filter in the current position
 		for (uint8_t filter = 0; filter < FILTER_SECTION_SIZE; filter++){
 			if (currentFilters->filter[filter].position == filterStage){
-				// Found a filter loaded in the current position
-				// Store the name into tmpName
-				memcpy(tmpName, currentFilters->filter[filter].filterName, 10);
-
-				// "0x00" is a signal that there isn't any more data
-				for (nameLen = 0; nameLen < 10; nameLen++){
-					if (tmpName[nameLen] == 0x00){
-						break;
-					}
-				}
-
-				// At this point, nameIndex has the length of the Name
-				if (nameLen <= 5){
-					// Only 1 row needed
-					// Find the starting Y pixel
-					uint8_t sectionHeight;
-					sectionHeight = epd->dots_per_line - 15;			// Account for the header
-					sectionHeight /= FILTER_SECTION_SIZE;					// Account for the number of filters
-					startPixelY = sectionHeight * (filterStage - 1);  	// Get the correct section
-					startPixelY += sectionHeight / 2;					// Get to the center of the section
-					startPixelY -= 12;									// Account for the text height (assuming font24)
-					startPixelY += 15;									// Re-incorporate the header length
-
-					// Find the staring X pixel
-					startPixelX = epd->lines_per_display / 2;	// Find the center of the line
-					startPixelX -= (nameLen * 17) / 2;			// difference of the center of text and center of line
-
-					// Draw Text
-					canvas_DrawStringAt(canvas, startPixelX, startPixelY, tmpName, &Font24, filterStage == invPosition ? 1 : 0);
-
-				} else {
-					// Need to split into 2 rows
-					uint8_t topLine[6] = {0};							// Top Line Holder
-					uint8_t botLine[6] = {0};							// Bottom Line Holder
-					memcpy(topLine, tmpName, 5);
-
-					for (uint8_t i = 5; i < 10; i++){
-						botLine[i - 5] = tmpName[i];
-					}
-
-					// Find the starting Y pixel
-					uint8_t sectionHeight;
-					sectionHeight = epd->dots_per_line - 15;			// Account for the header
-					sectionHeight /= FILTER_SECTION_SIZE;					// Account for the number of filters
-					startPixelY = sectionHeight * (filterStage - 1);  	// Get the correct section
-					startPixelY += sectionHeight / 2;					// Get to the center of the section
-					startPixelY -= 24;									// Account for the text height (assuming font24)
-					startPixelY += 15;									// Re-incorporate the header length
-
-//					// Find the staring X pixel
-//					startPixelX = epd->lines_per_display / 2;	// Find the center of the line
-//					startPixelX -= (nameLen * 17) / 2;			// difference of the center of text and center of line
-
-					// Draw text
-					canvas_DrawStringAt(canvas, 6, startPixelY, topLine, &Font24, filterStage == invPosition ? 1 : 0);
-
-//					// Find the staring X pixel
-//					startPixelX = epd->lines_per_display / 2;	// Find the center of the line
-//					startPixelX -= (nameLen * 17) / 2;			// difference of the center of text and center of line
-
-					canvas_DrawStringAt(canvas, 6, startPixelY + 24, botLine, &Font24, filterStage == invPosition ? 1 : 0);
-				}
+				memcpy(slot->name, currentFilters->filter[filter].filterName, 10);
+				break;
 			}
 		}
 	}
 
-	// Print the rendered image
-	if (refreshCount < CYCLES_UNTIL_REFRESH){
-		canvas_UpdateEPD(canvas, epd, prevImage);
-		refreshCount++;
+	refreshStats.requests++;
+	if (redrawPending){
+		refreshStats.coalesced++;
 	} else {
-		EPD_set_enable_temperature();
-		canvas_PrintEPD(canvas, epd);
-		refreshCount = 0;
+		redrawPending = true;
+		requestTick = HAL_GetTick();
 	}
+
+	// Starts right away when the EPD is idle
+	canvas_Process(canvas, epd);
+}
+
+/**
+*  @brief: steps the EPD update and starts the next redraw once it is done. Call it from the main loop,
+*          a stage sends one frame per call. It also powers a held COG down after EPD_COG_HOLD_MS.
+*/
+void canvas_Process(Canvas* canvas, EPD_HandleTypeDef* epd){
+	if (EPD_process(epd)){
+		return;
+	}
+
+	if (refreshRunning){
+		canvas_FinishRefresh(canvas, epd);
+	}
+
+	if (redrawPending){
+		canvas_StartRedraw(canvas, epd);
+	}
+}
+
+/**
+*  @brief: blocks until the update in flight and a waiting redraw are on the display
+*/
+void canvas_Flush(Canvas* canvas, EPD_HandleTypeDef* epd){
+	while (refreshRunning || redrawPending || EPD_busy(epd)){
+		canvas_Process(canvas, epd);
+	}
+}
+
+/**
+*  @brief: redraw counters and the time from a request to the first frame of its update
+*/
+void canvas_GetRefreshStats(Canvas_refresh_stats* stats){
+	*stats = refreshStats;
 }
 
 void canvas_SetRotate(Canvas* canvas, uint8_t rotate) {
 	canvas->rotate = rotate;
+	canvas_ComputeLayout(canvas, canvas->layout.slots);
+}
+
+/**
+*  @brief: number of filter slots shown, 1 to FILTER_SECTION_SIZE. Redraw the frame with
+*          canvas_DrawLayout afterwards.
+*/
+void canvas_SetSlots(Canvas* canvas, uint8_t slots) {
+	canvas_ComputeLayout(canvas, slots);
+}
+
+/**
+*  @brief: draws the empty filter display: header, slot backgrounds and the header text.
+*          Every slot is drawn again by the next canvas_DrawFilters.
+*/
+void canvas_DrawLayout(Canvas* canvas) {
+	const Canvas_layout* l = &canvas->layout;
+
+	canvas_DrawBackground(canvas);
+	if (l->labelFont != NULL) {
+		canvas_DrawStringAt(canvas, l->labelX, CANVAS_LAYOUT_LABEL_Y, CANVAS_LAYOUT_LABEL, l->labelFont, 1);
+	}
+
+	canvas_ClearDamage(canvas);
+	canvas_MergeDamage(canvas, (Canvas_rect){0, 0, canvas->width - 1, canvas->height - 1});
+
+	memset(drawnSlots, 0, sizeof(drawnSlots));
 }
 
 /**
@@ -173,6 +223,453 @@ void canvas_SetRotate(Canvas* canvas, uint8_t rotate) {
  *          this function won't be affected by the rotate parameter.
  */
 void canvas_DrawAbsolutePixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
+	if (x >= canvas->width || y >= canvas->height) {
+		return;
+	}
+	canvas_SetAbsolutePixel(canvas, x, y, colored);
+	canvas_MergeDamage(canvas, (Canvas_rect){x, y, x, y});
+}
+
+/**
+ *  @brief: this draws a pixel by the coordinates
+ */
+void canvas_DrawPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
+	canvas_PutPixel(canvas, x, y, colored);
+	canvas_AddDamage(canvas, x, y, x, y);
+}
+
+/**
+ *  @brief: this draws a character on the frame buffer but not refresh
+ */
+void canvas_DrawCharAt(Canvas* canvas, uint16_t x, uint16_t y, char ascii_char, sFONT* font, int colored) {
+    int i, j;
+    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
+    const unsigned char* ptr;
+
+    // Tag names are raw bytes, nothing is drawn for the ones outside the font
+    if ((uint8_t) (ascii_char - ' ') >= FONT_CHAR_COUNT) {
+        return;
+    }
+
+    if (textPath != TEXT_PIXELS && canvas_HasColumns(font) && canvas->rotate == CANVAS_FONT_ROTATE) {
+        canvas_BlitGlyph(canvas, x, y, ascii_char, font, colored);
+        canvas_AddDamage(canvas, x, y, x + font->Width - 1, y + font->Height - 1);
+        return;
+    }
+
+    if (font->table == NULL) {
+        // Asset pack only, the pixels come from the glyph columns. Bit k of a column is glyph row k,
+        // counted from the bottom for ROTATE_90 (see Tools/font_rotate.py)
+        uint8_t buf[MAX_WIDTH_FONT * ((MAX_HEIGHT_FONT + 7) / 8)];
+        uint8_t col_bytes = (font->Height + 7) / 8;
+
+        ptr = canvas_GlyphColumns(font, ascii_char, buf);
+        for (i = 0; i < font->Width; i++, ptr += col_bytes) {
+            for (j = 0; j < font->Height; j++) {
+#if CANVAS_FONT_ROTATE == ROTATE_90
+                uint8_t k = font->Height - 1 - j;
+#else
+                uint8_t k = j;
+#endif
+                if (ptr[k / 8] & (1 << (k % 8))) {
+                    canvas_PutPixel(canvas, x + i, y + j, colored);
+                }
+            }
+        }
+        canvas_AddDamage(canvas, x, y, x + font->Width - 1, y + font->Height - 1);
+        return;
+    }
+
+    ptr = &font->table[char_offset];
+    for (j = 0; j < font->Height; j++) {
+        for (i = 0; i < font->Width; i++) {
+            if (*ptr & (0x80 >> (i % 8))) {
+                canvas_PutPixel(canvas, x + i, y + j, colored);
+            }
+            if (i % 8 == 7) {
+                ptr++;
+            }
+        }
+        if (font->Width % 8 != 0) {
+            ptr++;
+        }
+    }
+    canvas_AddDamage(canvas, x, y, x + font->Width - 1, y + font->Height - 1);
+}
+
+/**
+*  @brief: this displays a string on the frame buffer but not refresh
+*/
+void canvas_DrawStringAt(Canvas* canvas, uint16_t x, uint16_t y, const char* text, sFONT* font, int colored) {
+    const char* p_text = text;
+    unsigned int counter = 0;
+    int refcolumn = x;
+
+    /* Send the string character by character on EPD */
+    while (*p_text != 0) {
+        /* Display one character on EPD */
+        canvas_DrawCharAt(canvas, refcolumn, y, *p_text, font, colored);
+        /* Decrement the column position by 16 */
+        refcolumn += font->Width;
+        /* Point on the next character */
+        p_text++;
+        counter++;
+    }
+}
+
+/**
+*  @brief: this draws a filled rectangle
+*/
+void canvas_DrawFilledRectangle(Canvas* canvas, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t colored) {
+	Canvas_rect r;
+
+	// Filled a byte at a time in the frame buffer
+	if (canvas_ToAbsoluteRect(canvas, x0, y0, x1, y1, &r)) {
+		canvas_FillAbsoluteRect(canvas, r, colored);
+		canvas_MergeDamage(canvas, r);
+	}
+}
+
+/**
+*  @brief: marks an area as changed since the last EPD update. Takes rotated
+*          coordinates like the draw calls, the list holds absolute ones.
+*/
+void canvas_AddDamage(Canvas* canvas, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+	Canvas_rect r;
+
+	if (canvas_ToAbsoluteRect(canvas, x0, y0, x1, y1, &r)) {
+		canvas_MergeDamage(canvas, r);
+	}
+}
+
+void canvas_ClearDamage(Canvas* canvas) {
+	canvas->damage_count = 0;
+}
+
+/**
+*  @brief: sets bit n of line_map for every damaged display line n (EPD_LINE_MAP_SIZE bytes).
+*          Returns the number of damaged lines. epd_gfx.h makes sure the canvas height
+*          fits EPD_MAX_LINES, lines past the canvas are not marked.
+*/
+uint16_t canvas_DamageLineMap(Canvas* canvas, uint8_t* line_map) {
+	uint16_t lines = 0;
+
+	memset(line_map, 0x00, EPD_LINE_MAP_SIZE);
+
+	for (uint8_t i = 0; i < canvas->damage_count; i++) {
+		for (uint16_t y = canvas->damage[i].y0; y <= canvas->damage[i].y1 && y < canvas->height; y++) {
+			line_map[y / 8] |= 1 << (y % 8);
+		}
+	}
+
+	for (uint16_t y = 0; y < canvas->height; y++) {
+		if (line_map[y / 8] & (1 << (y % 8))) {
+			lines++;
+		}
+	}
+	return lines;
+}
+
+/**
+*  @brief:
+*/
+void canvas_PrintEPD(Canvas* canvas, EPD_HandleTypeDef* epd){
+
+	// The update in flight still reads the frame buffers
+	canvas_Flush(canvas, epd);
+
+	canvas_StartRefresh(canvas, epd, true);
+	canvas_Flush(canvas, epd);
+}
+
+/**
+*  @brief: This updates the canvas background image
+*/
+void canvas_setBGImage(Canvas* canvas, const uint8_t* bg_image){
+	uint16_t size = canvas->width * canvas->height / 8;
+	memcpy(canvas->image, bg_image, size);
+
+	canvas_ClearDamage(canvas);
+	canvas_MergeDamage(canvas, (Canvas_rect){0, 0, canvas->width - 1, canvas->height - 1});
+}
+
+/**
+*  @brief: unpacks an asset pack image straight into the canvas, it has to be the size of the canvas
+*/
+Canvas_error canvas_setPackedBGImage(Canvas* canvas, const Canvas_image* bg_image){
+	uint8_t* out = canvas->image;
+	uint8_t* end = canvas->image + canvas->width * canvas->height / 8;
+	const uint8_t* in = bg_image->data;
+	const uint8_t* in_end = bg_image->data + bg_image->size;
+
+	if (bg_image->width != canvas->width || bg_image->height != canvas->height){
+		return CANVAS_ERR;
+	}
+
+	// PackBits: n = 0..127 copies the next n + 1 bytes, n = -1..-127 repeats the next byte 1 - n times
+	while (in < in_end && out < end){
+		int8_t n = (int8_t) *in++;
+		uint16_t len = (n >= 0) ? n + 1 : 1 - n;
+
+		if (n == -128){
+			continue;
+		}
+		if (len > end - out || ((n >= 0) ? len : 1) > in_end - in){
+			break;				// Corrupt, the image is drawn up to here
+		}
+		if (n >= 0){
+			memcpy(out, in, len);
+			in += len;
+		} else {
+			memset(out, *in++, len);
+		}
+		out += len;
+	}
+
+	canvas_ClearDamage(canvas);
+	canvas_MergeDamage(canvas, (Canvas_rect){0, 0, canvas->width - 1, canvas->height - 1});
+	return (out == end) ? CANVAS_OK : CANVAS_ERR;
+}
+
+/**
+*  @brief: copies a rectangle (rotated coordinates) of the background image back into the canvas
+*/
+void canvas_RestoreBGRect(Canvas* canvas, const uint8_t* bg_image, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+	Canvas_rect r;
+
+	if (!canvas_ToAbsoluteRect(canvas, x0, y0, x1, y1, &r)) {
+		return;
+	}
+
+	for (uint16_t y = r.y0; y <= r.y1; y++) {
+		uint16_t x = r.x0;
+
+		while (x <= r.x1) {
+			// Pixel x % 8 lives in bit x % 8 (see canvas_SetAbsolutePixel)
+			uint16_t last = (x | 7) < r.x1 ? (x | 7) : r.x1;
+			uint8_t mask = (0xFF << (x % 8)) & (0xFF >> (7 - (last % 8)));
+			uint16_t n = (x + y * canvas->width) / 8;
+
+			canvas->image[n] = (canvas->image[n] & ~mask) | (bg_image[n] & mask);
+			x = last + 1;
+		}
+	}
+	canvas_MergeDamage(canvas, r);
+}
+
+void canvas_UpdateEPD(Canvas* canvas, EPD_HandleTypeDef* epd){
+
+	// The update in flight still reads the frame buffers
+	canvas_Flush(canvas, epd);
+
+	canvas_StartRefresh(canvas, epd, false);
+	canvas_Flush(canvas, epd);
+}
+
+/**
+*  @brief: full refresh once the box has been left alone for CANVAS_IDLE_REFRESH_MS,
+*          so ghosting of the last partial updates doesn't stay on the display.
+*          Call it from the idle loop, canvas_Process steps the refresh.
+*/
+void canvas_Maintenance(Canvas* canvas, EPD_HandleTypeDef* epd){
+	bool ghosting = false;
+
+	if (CANVAS_IDLE_REFRESH_MS == 0 || HAL_GetTick() - lastDrawTick < CANVAS_IDLE_REFRESH_MS){
+		return;
+	}
+	if (refreshRunning || redrawPending || EPD_busy(epd)){
+		return;
+	}
+
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++){
+		if (slotUpdates[i] > 0){
+			ghosting = true;
+		}
+	}
+
+	if (ghosting){
+		canvas_StartRefresh(canvas, epd, true);
+		lastDrawTick = HAL_GetTick();
+	}
+}
+
+#if CANVAS_BENCHMARK
+/**
+*  @brief: renders 3 filled slots into a scratch frame with each text path: pixel by pixel,
+*          canvas_BlitGlyph, canvas_BlitGlyph from the asset pack and the name cache
+*          (emptied and warmed up first). The display, the cached names and the cache
+*          counters are left alone.
+*/
+Canvas_error canvas_Benchmark(Canvas* canvas, EPD_HandleTypeDef* epd, Canvas_bench* bench){
+	static uint8_t benchBuffer[2][CANVAS_BUFFER_SIZE];
+	static nameBitmap_t liveCache[CANVAS_NAME_CACHE_SIZE];
+	// A one row name, a two row highlighted name and a short one
+	static const slotContent_t benchSlots[FILTER_SECTION_SIZE] = {
+		{"ND0.6", 0},
+		{"BLKPROMIST", 1},
+		{"POL", 0}
+	};
+	uint16_t size = canvas->width * canvas->height / 8;
+	Canvas scratch = *canvas;
+	uint32_t cycles[4];
+	uint32_t start;
+	uint32_t liveClock = nameCacheClock;
+	Canvas_cache_stats liveStats = nameCacheStats;
+
+	if (canvas->rotate != CANVAS_FONT_ROTATE){
+		return CANVAS_ERR;
+	}
+
+	// The runs start from an empty cache, the names of the display are put back afterwards
+	memcpy(liveCache, nameCache, sizeof(nameCache));
+	memset(nameCache, 0, sizeof(nameCache));
+
+	bench->match = true;
+	for (textPath = TEXT_PIXELS; textPath <= TEXT_CACHED; textPath++){
+		// Every path is compared with the pixel by pixel frame
+		scratch.image = benchBuffer[(textPath == TEXT_PIXELS) ? 0 : 1];
+
+		for (uint8_t run = 0; run < ((textPath == TEXT_CACHED) ? 2 : 1); run++){
+			canvas_DrawBackground(&scratch);
+			scratch.damage_count = 0;
+
+			start = DWT->CYCCNT;
+			for (uint8_t filterStage = 1; filterStage <= scratch.layout.slots; filterStage++){
+				canvas_DrawSlot(&scratch, filterStage, &benchSlots[filterStage - 1]);
+			}
+			cycles[textPath] = DWT->CYCCNT - start;
+		}
+
+		if (textPath != TEXT_PIXELS && memcmp(benchBuffer[0], benchBuffer[1], size) != 0){
+			bench->match = false;
+		}
+	}
+	textPath = TEXT_CACHED;
+
+	memcpy(nameCache, liveCache, sizeof(nameCache));
+	nameCacheClock = liveClock;
+	nameCacheStats = liveStats;
+
+	bench->pixelCycles = cycles[TEXT_PIXELS];
+	bench->blitCycles = cycles[TEXT_GLYPHS];
+	bench->packedCycles = cycles[TEXT_PACKED];
+	bench->cachedCycles = cycles[TEXT_CACHED];
+	return CANVAS_OK;
+}
+#endif
+
+/**
+*  @brief: hit and miss counters of the filter name cache
+*/
+void canvas_GetNameCacheStats(Canvas_cache_stats* stats){
+	*stats = nameCacheStats;
+}
+
+/************************************************************************************************
+ * LOCAL FUNCTIONS
+ ***********************************************************************************************/
+
+/**
+ *  @brief: draws the slots that differ from the requested ones and starts the EPD update.
+ *          The draw calls leave a damage list behind, so the partial update knows which lines
+ *          to drive without comparing the frames.
+ *          Each slot counts its partial updates. Once one of them passes the limit for the current
+ *          temperature, the whole screen gets a full refresh instead.
+ */
+static void canvas_StartRedraw(Canvas* canvas, EPD_HandleTypeDef* epd) {
+	bool fullRefresh = false;
+	uint32_t start = DWT->CYCCNT;
+
+	redrawPending = false;
+
+	for (uint8_t filterStage = 1; filterStage <= canvas->layout.slots; filterStage++){
+		const slotContent_t* slot = &targetSlots[filterStage - 1];
+
+		// The slot already shows this
+		if (memcmp(slot, &drawnSlots[filterStage - 1], sizeof(slotContent_t)) == 0){
+			continue;
+		}
+
+		canvas_DrawSlot(canvas, filterStage, slot);
+		drawnSlots[filterStage - 1] = *slot;
+
+		if (++slotUpdates[filterStage - 1] > canvas_GhostLimit(epd)){
+			fullRefresh = true;
+		}
+	}
+
+	// Nothing changed, leave the display alone
+	if (canvas->damage_count == 0){
+		return;
+	}
+
+	refreshStats.renderCycles = DWT->CYCCNT - start;
+	if (refreshStats.renderCycles > refreshStats.maxRenderCycles){
+		refreshStats.maxRenderCycles = refreshStats.renderCycles;
+	}
+	lastDrawTick = HAL_GetTick();
+
+	canvas_StartRefresh(canvas, epd, fullRefresh);
+	refreshMeasured = true;
+	refreshRequestTick = requestTick;
+}
+
+/**
+ *  @brief: starts sending the back buffer, the frame buffers must not be drawn on until it is done
+ */
+static void canvas_StartRefresh(Canvas* canvas, EPD_HandleTypeDef* epd, bool full) {
+	uint8_t line_map[EPD_LINE_MAP_SIZE];
+
+	if (full) {
+		EPD_start_update(epd, EPD_UPDATE_IMAGE_0, NULL, canvas->image, NULL);
+	} else {
+		// Only the lines touched since the last update can differ
+		canvas_DamageLineMap(canvas, line_map);
+		EPD_start_update(epd, EPD_UPDATE_PARTIAL, canvas->front, canvas->image, line_map);
+	}
+
+	refreshRunning = true;
+	refreshFull = full;
+	refreshMeasured = false;
+	refreshStats.refreshes++;
+}
+
+static void canvas_FinishRefresh(Canvas* canvas, EPD_HandleTypeDef* epd) {
+	refreshRunning = false;
+
+	// A full refresh clears the ghosting of every slot
+	if (refreshFull && EPD_status(epd) == EPD_OK) {
+		memset(slotUpdates, 0, sizeof(slotUpdates));
+	}
+
+	// Nothing was driven when the power up failed
+	if (refreshMeasured && epd->lines_sent > 0) {
+		refreshStats.lastLatency = epd->frames_start - refreshRequestTick;
+		if (refreshStats.lastLatency > refreshStats.maxLatency) {
+			refreshStats.maxLatency = refreshStats.lastLatency;
+		}
+	}
+
+	canvas_SwapBuffers(canvas, epd);
+}
+
+/**
+ *  @brief: partial updates a slot takes before it needs a full refresh. Ghosting gets
+ *          worse in the cold, the temperature is the one of the last EPD_begin.
+ */
+static uint8_t canvas_GhostLimit(EPD_HandleTypeDef* epd) {
+	if (epd->temperature >= 15 * 8) {
+		return CANVAS_GHOST_LIMIT_WARM;
+	} else if (epd->temperature >= 5 * 8) {
+		return CANVAS_GHOST_LIMIT_MILD;
+	}
+	return CANVAS_GHOST_LIMIT_COLD;
+}
+
+/**
+ *  @brief: this draws a pixel by absolute coordinates, without marking it damaged
+ */
+static void canvas_SetAbsolutePixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
 
 	// swap x order. 7 to 0, 6 to 1, 5 to 2, etc.
 	// 1. Get bit position
@@ -224,15 +721,15 @@ void canvas_DrawAbsolutePixel(Canvas* canvas, uint16_t x, uint16_t y, int colore
 }
 
 /**
- *  @brief: this draws a pixel by the coordinates
+ *  @brief: this draws a pixel by the coordinates, without marking it damaged
  */
-void canvas_DrawPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
+static void canvas_PutPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
     int point_temp;
     if (canvas->rotate == ROTATE_0) {
         if(x < 0 || x >= canvas->width || y < 0 || y >= canvas->height) {
             return;
         }
-        canvas_DrawAbsolutePixel(canvas, x, y, colored);
+        canvas_SetAbsolutePixel(canvas, x, y, colored);
     } else if (canvas->rotate == ROTATE_90) {
         if(x < 0 || x >= canvas->height || y < 0 || y >= canvas->width) {
           return;
@@ -240,14 +737,14 @@ void canvas_DrawPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
         point_temp = x;
         x = canvas->width - y;
         y = point_temp;
-        canvas_DrawAbsolutePixel(canvas, x, y, colored);
+        canvas_SetAbsolutePixel(canvas, x, y, colored);
     } else if (canvas->rotate == ROTATE_180) {
         if(x < 0 || x >= canvas->width || y < 0 || y >= canvas->height) {
           return;
         }
         x = canvas->width - x;
         y = canvas->height - y;
-        canvas_DrawAbsolutePixel(canvas, x, y, colored);
+        canvas_SetAbsolutePixel(canvas, x, y, colored);
     } else if (canvas->rotate == ROTATE_270) {
         if(x < 0 || x >= canvas->height || y < 0 || y >= canvas->width) {
           return;
@@ -255,107 +752,510 @@ void canvas_DrawPixel(Canvas* canvas, uint16_t x, uint16_t y, int colored) {
         point_temp = x;
         x = y;
         y = canvas->height - point_temp;
-        canvas_DrawAbsolutePixel(canvas, x, y, colored);
+        canvas_SetAbsolutePixel(canvas, x, y, colored);
     }
 }
 
 /**
- *  @brief: this draws a character on the frame buffer but not refresh
+ *  @brief: copies the columns of a glyph into the frame buffer
  */
-void canvas_DrawCharAt(Canvas* canvas, uint16_t x, uint16_t y, char ascii_char, sFONT* font, int colored) {
-    int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[char_offset];
+static void canvas_BlitGlyph(Canvas* canvas, uint16_t x, uint16_t y, char ascii_char, sFONT* font, int colored) {
+	uint8_t buf[MAX_WIDTH_FONT * ((MAX_HEIGHT_FONT + 7) / 8)];
 
-    for (j = 0; j < font->Height; j++) {
-        for (i = 0; i < font->Width; i++) {
-            if (*ptr & (0x80 >> (i % 8))) {
-                canvas_DrawPixel(canvas, x + i, y + j, colored);
-            }
-            if (i % 8 == 7) {
-                ptr++;
-            }
-        }
-        if (font->Width % 8 != 0) {
-            ptr++;
-        }
-    }
+	canvas_BlitColumns(canvas, x, y, canvas_GlyphColumns(font, ascii_char, buf), font->Width, font->Height, colored);
 }
 
 /**
-*  @brief: this displays a string on the frame buffer but not refresh
-*/
-void canvas_DrawStringAt(Canvas* canvas, uint16_t x, uint16_t y, const char* text, sFONT* font, int colored) {
-    const char* p_text = text;
-    unsigned int counter = 0;
-    int refcolumn = x;
+ *  @brief: true when the glyphs of a font are available as columns for canvas_BlitGlyph
+ */
+static bool canvas_HasColumns(const sFONT* font) {
+	return font->rotated != NULL || font->packed != NULL;
+}
 
-    /* Send the string character by character on EPD */
-    while (*p_text != 0) {
-        /* Display one character on EPD */
-        canvas_DrawCharAt(canvas, refcolumn, y, *p_text, font, colored);
-        /* Decrement the column position by 16 */
-        refcolumn += font->Width;
-        /* Point on the next character */
-        p_text++;
-        counter++;
-    }
+/**
+ *  @brief: the columns of a glyph in the fonts_rotated.c layout. Points into fonts_rotated.c
+ *          when the font has it, otherwise the glyph is unpacked from the asset pack into buf
+ *          (MAX_WIDTH_FONT columns of up to 3 bytes). Characters outside the font come out blank.
+ */
+static const uint8_t* canvas_GlyphColumns(const sFONT* font, char ascii_char, uint8_t* buf) {
+	uint8_t c = ascii_char - ' ';
+	uint8_t col_bytes = (font->Height + 7) / 8;
+
+	if (c < FONT_CHAR_COUNT && font->rotated != NULL && (textPath != TEXT_PACKED || font->packed == NULL)) {
+		return &font->rotated[c * font->Width * col_bytes];
+	}
+
+	memset(buf, 0x00, font->Width * col_bytes);
+	if (c < FONT_CHAR_COUNT && font->packed != NULL) {
+		canvas_UnpackGlyph(font, c, buf);
+	}
+	return buf;
 }
 
 /**
-*  @brief:
+ *  @brief: expands glyph c of the asset pack into the zeroed columns in buf. A glyph is a
+ *          3 byte box (first column, columns, first column bit, bits per column) followed
+ *          by the bits of the box, column by column, LSB first (Tools/asset_pack.py)
+ */
+static void canvas_UnpackGlyph(const sFONT* font, uint8_t c, uint8_t* buf) {
+	const uint8_t* p = &font->packed->data[font->packed->index[c]];
+	uint8_t col_bytes = (font->Height + 7) / 8;
+	uint32_t box, mask;
+	uint32_t acc = 0;			// Bits read ahead, up to 31
+	uint8_t have = 0;
+	uint8_t first, cols, shift, rows;
+
+	// No pixels, or left out of the subset
+	if (font->packed->index[c + 1] == font->packed->index[c]) {
+		return;
+	}
+
+	box = p[0] | (p[1] << 8) | ((uint32_t) p[2] << 16);
+	p += 3;
+	first = box & 0x1F;
+	cols = (box >> 5) & 0x1F;
+	shift = (box >> 10) & 0x1F;
+	rows = (box >> 15) & 0x1F;
+	mask = (1UL << rows) - 1;
+
+	buf += first * col_bytes;
+	for (uint8_t i = 0; i < cols; i++, buf += col_bytes) {
+		uint32_t bits;
+
+		while (have < rows) {
+			acc |= (uint32_t) *p++ << have;
+			have += 8;
+		}
+		bits = (acc & mask) << shift;
+		acc >>= rows;
+		have -= rows;
+
+		for (uint8_t b = 0; b < col_bytes; b++, bits >>= 8) {
+			buf[b] = (uint8_t) bits;
+		}
+	}
+}
+
+/**
+ *  @brief: copies columns in the fonts_rotated.c layout (up to 56 rows) into the frame buffer,
+ *          a whole column per display line. Clips the same way canvas_PutPixel does,
+ *          without marking anything damaged.
+ */
+static void canvas_BlitColumns(Canvas* canvas, uint16_t x, uint16_t y, const uint8_t* col, uint16_t width, uint16_t height, int colored) {
+	uint8_t col_bytes = (height + 7) / 8;
+	uint16_t bytes_per_line = canvas->width / 8;
+	uint16_t first_col = 0;
+	uint16_t last_col;			// exclusive
+	uint16_t rows;				// rows in front of the canvas edge
+	uint64_t keep;				// column bits that land on the canvas
+	int32_t abs_x;				// absolute x of bit 0 of a column
+	bool set = IF_INVERT_COLOR ? colored : !colored;
+
+	if (x >= canvas->height || y >= canvas->width) {
+		return;
+	}
+	last_col = (x + width > canvas->height) ? canvas->height - x : width;
+	rows = (y + height > canvas->width) ? canvas->width - y : height;
+
+#if CANVAS_FONT_ROTATE == ROTATE_90
+	// Row j lands on absolute x = width - y - j, row 0 at y = 0 is off the canvas
+	abs_x = canvas->width - y - (height - 1);
+	keep = ((1ULL << (height - (y == 0 ? 1 : 0))) - 1) & ~((1ULL << (height - rows)) - 1);
+#else
+	// Row j lands on absolute x = y + j, column i on line height - x - i
+	abs_x = y;
+	keep = (1ULL << rows) - 1;
+	first_col = (x == 0) ? 1 : 0;
+#endif
+
+	col += first_col * col_bytes;
+	for (uint16_t i = first_col; i < last_col; i++, col += col_bytes) {
+		uint64_t bits = 0;
+		int32_t start = abs_x;
+		uint8_t* p;
+
+		for (uint8_t b = 0; b < col_bytes; b++) {
+			bits |= (uint64_t) col[b] << (8 * b);
+		}
+		bits &= keep;
+		if (bits == 0) {
+			continue;
+		}
+
+		// Bits left of the canvas are outside keep, dropping them only loses zeros
+		if (start < 0) {
+			bits >>= -start;
+			start = 0;
+		}
+		bits <<= start % 8;
+
+#if CANVAS_FONT_ROTATE == ROTATE_90
+		p = &canvas->image[(x + i) * bytes_per_line + start / 8];
+#else
+		p = &canvas->image[(canvas->height - x - i) * bytes_per_line + start / 8];
+#endif
+		for (; bits != 0; bits >>= 8, p++) {
+			if (set) {
+				*p |= (uint8_t) bits;
+			} else {
+				*p &= ~(uint8_t) bits;
+			}
+		}
+	}
+}
+
+/**
+ *  @brief: finds the cached bitmap of a filter name, rendering it into the least recently
+ *          used entry on a miss. Returns NULL when the name does not fit an entry.
+ */
+static nameBitmap_t* canvas_GetNameBitmap(const uint8_t* name, uint8_t nameLen, const Canvas_text_fit* fit) {
+	nameBitmap_t* entry = &nameCache[0];
+	sFONT* font = fit->font;
+	uint8_t key[FILTER_NAME_LEN] = {0};
+	uint8_t lineLen = fit->lineLen;
+	uint8_t lines = fit->lines;
+	uint8_t col_bytes = (lines * font->Height + 7) / 8;
+	uint8_t glyph_bytes = (font->Height + 7) / 8;
+
+	memcpy(key, name, nameLen);
+
+	for (uint8_t i = 0; i < CANVAS_NAME_CACHE_SIZE; i++) {
+		if (nameCache[i].font == font && nameCache[i].lineLen == lineLen && memcmp(nameCache[i].name, key, FILTER_NAME_LEN) == 0) {
+			nameCache[i].last_use = ++nameCacheClock;
+			nameCacheStats.hits++;
+			return &nameCache[i];
+		}
+		// Empty entries have no font and go first
+		if (nameCache[i].font == NULL || (entry->font != NULL && nameCache[i].last_use < entry->last_use)) {
+			entry = &nameCache[i];
+		}
+	}
+	nameCacheStats.misses++;
+
+	if (font->Width * lineLen > CANVAS_NAME_MAX_COLS || col_bytes > CANVAS_NAME_COL_BYTES) {
+		return NULL;
+	}
+	if (entry->font != NULL) {
+		nameCacheStats.evictions++;
+	}
+
+	memcpy(entry->name, key, FILTER_NAME_LEN);
+	entry->font = font;
+	entry->lineLen = lineLen;
+	entry->lines = lines;
+	entry->cols = font->Width * ((nameLen < lineLen) ? nameLen : lineLen);
+	entry->last_use = ++nameCacheClock;
+	memset(entry->columns, 0x00, sizeof(entry->columns));
+
+	// Line l takes glyph rows l * Height and up, the same columns as canvas_BlitGlyph would write
+	for (uint8_t n = 0; n < nameLen; n++) {
+		uint8_t line = n / lineLen;
+		uint8_t buf[MAX_WIDTH_FONT * ((MAX_HEIGHT_FONT + 7) / 8)];
+		const uint8_t* glyph = canvas_GlyphColumns(font, name[n], buf);
+#if CANVAS_FONT_ROTATE == ROTATE_90
+		uint8_t shift = (lines - 1 - line) * font->Height;
+#else
+		uint8_t shift = line * font->Height;
+#endif
+
+		for (uint16_t i = 0; i < font->Width; i++, glyph += glyph_bytes) {
+			uint8_t* col = &entry->columns[((n % lineLen) * font->Width + i) * col_bytes];
+			uint64_t bits = 0;
+
+			for (uint8_t b = 0; b < glyph_bytes; b++) {
+				bits |= (uint64_t) glyph[b] << (8 * b);
+			}
+			bits <<= shift;
+			for (uint8_t b = 0; b < col_bytes; b++) {
+				col[b] |= (uint8_t) (bits >> (8 * b));
+			}
+		}
+	}
+	return entry;
+}
+
+/**
+ *  @brief: draws a filter name in the font of its layout fit, split into lines of fit->lineLen
+ *          characters. Goes through the name cache when the font has glyph columns.
+ */
+static void canvas_DrawName(Canvas* canvas, uint16_t x, uint16_t y, const uint8_t* name, uint8_t nameLen, const Canvas_text_fit* fit, int colored) {
+	uint8_t line[FILTER_NAME_LEN + 1] = {0};
+	sFONT* font = fit->font;
+	nameBitmap_t* entry = NULL;
+
+	if (textPath == TEXT_CACHED && canvas_HasColumns(font) && canvas->rotate == CANVAS_FONT_ROTATE) {
+		entry = canvas_GetNameBitmap(name, nameLen, fit);
+	}
+
+	if (entry != NULL) {
+		canvas_BlitColumns(canvas, x, y, entry->columns, entry->cols, entry->lines * font->Height, colored);
+		canvas_AddDamage(canvas, x, y, x + entry->cols - 1, y + entry->lines * font->Height - 1);
+		return;
+	}
+
+	for (uint8_t n = 0; n < nameLen; n += fit->lineLen, y += font->Height) {
+		memset(line, 0x00, sizeof(line));
+		memcpy(line, &name[n], (nameLen - n < fit->lineLen) ? nameLen - n : fit->lineLen);
+		canvas_DrawStringAt(canvas, x, y, (char *) line, font, colored);
+	}
+}
+
+/**
+*  @brief: places the header and the slots on the rotated canvas and picks the font of every
+*          name length. Runs once per canvas size, rotation and slot count, the draw calls
+*          only look the results up.
+*          The slots share the rows below the header, the last one also takes the rows left over.
+*          A name gets the largest font it fits in with up to CANVAS_NAME_MAX_LINES lines,
+*          wrapped after the characters that fit a line and centred in the slot area.
 */
-void canvas_PrintEPD(Canvas* canvas, EPD_HandleTypeDef* epd){
+static void canvas_ComputeLayout(Canvas* canvas, uint8_t slots) {
+	Canvas_layout* l = &canvas->layout;
+	bool turned = (canvas->rotate == ROTATE_90) || (canvas->rotate == ROTATE_270);
+	uint16_t w = turned ? canvas->height : canvas->width;
+	uint16_t h = turned ? canvas->width : canvas->height;
+	uint16_t bandHeight;
+	uint16_t areaWidth;
+	uint16_t areaHeight;
+
+	if (slots < 1 || slots > FILTER_SECTION_SIZE) {
+		slots = FILTER_SECTION_SIZE;
+	}
+
+	memset(l, 0, sizeof(Canvas_layout));
+	l->slots = slots;
+	l->header = (Canvas_rect){0, 0, w - 1, CANVAS_LAYOUT_HEADER - 1};
+
+	bandHeight = (h - CANVAS_LAYOUT_HEADER - (slots - 1) * CANVAS_LAYOUT_GAP) / slots;
+	areaWidth = w - 2 * CANVAS_LAYOUT_MARGIN;
+	areaHeight = bandHeight - 2 * CANVAS_LAYOUT_MARGIN;
+
+	for (uint8_t i = 0; i < slots; i++) {
+		uint16_t y0 = CANVAS_LAYOUT_HEADER + i * (bandHeight + CANVAS_LAYOUT_GAP);
+
+		l->band[i] = (Canvas_rect){0, y0, w - 1, (i == slots - 1) ? h - 1 : y0 + bandHeight - 1};
+		l->area[i] = (Canvas_rect){CANVAS_LAYOUT_MARGIN, y0 + CANVAS_LAYOUT_MARGIN,
+				CANVAS_LAYOUT_MARGIN + areaWidth - 1, y0 + CANVAS_LAYOUT_MARGIN + areaHeight - 1};
+	}
 
-	EPD_begin(epd);
-	EPD_image_0(epd, canvas->image);
-	EPD_end(epd);
+	for (uint8_t len = 1; len <= FILTER_NAME_LEN; len++) {
+		Canvas_text_fit* fit = &l->fit[len];
+
+		for (uint8_t f = 0; f < sizeof(layoutFonts) / sizeof(layoutFonts[0]); f++) {
+			sFONT* font = layoutFonts[f];
+			uint16_t lineLen = areaWidth / font->Width;
+			uint16_t lines;
+
+			if (lineLen == 0) {
+				continue;
+			}
+			if (lineLen > len) {
+				lineLen = len;
+			}
+			lines = (len + lineLen - 1) / lineLen;
+			if (lines > CANVAS_NAME_MAX_LINES || lines * font->Height > areaHeight) {
+				continue;
+			}
+
+			fit->font = font;
+			fit->lineLen = lineLen;
+			fit->lines = lines;
+			fit->dx = areaWidth / 2 - (lineLen * font->Width) / 2;
+			fit->dy = areaHeight / 2 - (lines * font->Height) / 2;
+			break;
+		}
+	}
+
+	// Header text, the largest font that fits the header
+	for (uint8_t f = 0; f < sizeof(layoutFonts) / sizeof(layoutFonts[0]); f++) {
+		sFONT* font = layoutFonts[f];
+		uint16_t textWidth = (sizeof(CANVAS_LAYOUT_LABEL) - 1) * font->Width;
+
+		if (font->Height < CANVAS_LAYOUT_HEADER && textWidth <= w) {
+			l->labelFont = font;
+			l->labelX = w / 2 - textWidth / 2;
+			break;
+		}
+	}
 }
 
 /**
-*  @brief: This updates the canvas background image
+*  @brief: fills the frame with the slot color and clears the header and the gaps between the slots
 */
-void canvas_setBGImage(Canvas* canvas, const uint8_t* bg_image){
-	uint16_t size = canvas->width * canvas->height;
-	memcpy(canvas->image, bg_image, size);
+static void canvas_DrawBackground(Canvas* canvas) {
+	const Canvas_layout* l = &canvas->layout;
+
+	memset(canvas->image, IF_INVERT_COLOR ? 0xFF : 0x00, canvas->width * canvas->height / 8);
+
+	canvas_DrawFilledRectangle(canvas, l->header.x0, l->header.y0, l->header.x1, l->header.y1, 0);
+	for (uint8_t i = 1; i < l->slots; i++) {
+		canvas_DrawFilledRectangle(canvas, 0, l->band[i - 1].y1 + 1, l->header.x1, l->band[i].y0 - 1, 0);
+	}
 }
 
-void canvas_UpdateEPD(Canvas* canvas, EPD_HandleTypeDef* epd, uint8_t* old_img){
+/**
+*  @brief: clears a filter slot and draws its name in the font the layout picked for its length
+*/
+static void canvas_DrawSlot(Canvas* canvas, uint8_t filterStage, const slotContent_t* slot) {
+	const Canvas_rect* area = &canvas->layout.area[filterStage - 1];
+	const Canvas_text_fit* fit;
+	uint8_t nameLen;
+
+	// A highlighted slot is cleared and gets its name in the slot color
+	canvas_DrawFilledRectangle(canvas, area->x0, area->y0, area->x1, area->y1, slot->inverted ? 0 : 1);
+
+	// "0x00" is a signal that there isn't any more data
+	for (nameLen = 0; nameLen < FILTER_NAME_LEN; nameLen++){
+		if (slot->name[nameLen] == 0x00){
+			break;
+		}
+	}
 
-	EPD_begin(epd);
-	EPD_partial_image(epd, old_img, canvas->image);
-	EPD_end(epd);
+	fit = &canvas->layout.fit[nameLen];
+	if (nameLen == 0 || fit->font == NULL){
+		// Empty slot, or a name too long for the smallest font
+		return;
+	}
+
+	canvas_DrawName(canvas, area->x0 + fit->dx, area->y0 + fit->dy, slot->name, nameLen, fit, slot->inverted ? 1 : 0);
 }
 
-/************************************************************************************************
- * LOCAL FUNCTIONS
- ***********************************************************************************************/
+/**
+*  @brief: fills an absolute, clipped rectangle a byte at a time, without marking it damaged
+*/
+static void canvas_FillAbsoluteRect(Canvas* canvas, Canvas_rect r, int colored) {
+	bool set = IF_INVERT_COLOR ? colored : !colored;
+
+	for (uint16_t y = r.y0; y <= r.y1; y++) {
+		uint16_t x = r.x0;
+
+		while (x <= r.x1) {
+			// Pixel x % 8 lives in bit x % 8 (see canvas_RestoreBGRect)
+			uint16_t last = (x | 7) < r.x1 ? (x | 7) : r.x1;
+			uint8_t mask = (0xFF << (x % 8)) & (0xFF >> (7 - (last % 8)));
+			uint16_t n = (x + y * canvas->width) / 8;
+
+			if (set) {
+				canvas->image[n] |= mask;
+			} else {
+				canvas->image[n] &= ~mask;
+			}
+			x = last + 1;
+		}
+	}
+}
 
 /**
-*  @brief: this draws a filled rectangle
+*  @brief: maps a rectangle in rotated coordinates onto the frame buffer, clipped to it.
+*          Returns false when nothing of it is on the canvas.
 */
-void canvas_DrawFilledRectangle(Canvas* canvas, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t colored) {
-    int min_x, min_y, max_x, max_y;
-    int i;
-    min_x = x1 > x0 ? x0 : x1;
-    max_x = x1 > x0 ? x1 : x0;
-    min_y = y1 > y0 ? y0 : y1;
-    max_y = y1 > y0 ? y1 : y0;
-
-    for (i = min_x; i <= max_x; i++) {
-      canvas_DrawVerticalLine(canvas, i, min_y, max_y - min_y + 1, colored);
-    }
+static bool canvas_ToAbsoluteRect(Canvas* canvas, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, Canvas_rect* r) {
+	int32_t ax0, ay0, ax1, ay1;
+
+	// Same mapping as canvas_PutPixel, applied to both corners
+	switch (canvas->rotate) {
+		case ROTATE_90:
+			ax0 = canvas->width - y0;	ay0 = x0;
+			ax1 = canvas->width - y1;	ay1 = x1;
+			break;
+		case ROTATE_180:
+			ax0 = canvas->width - x0;	ay0 = canvas->height - y0;
+			ax1 = canvas->width - x1;	ay1 = canvas->height - y1;
+			break;
+		case ROTATE_270:
+			ax0 = y0;	ay0 = canvas->height - x0;
+			ax1 = y1;	ay1 = canvas->height - x1;
+			break;
+		default:
+			ax0 = x0;	ay0 = y0;
+			ax1 = x1;	ay1 = y1;
+			break;
+	}
+
+	r->x0 = (ax0 < ax1) ? ax0 : ax1;
+	r->x1 = (ax0 < ax1) ? ax1 : ax0;
+	r->y0 = (ay0 < ay1) ? ay0 : ay1;
+	r->y1 = (ay0 < ay1) ? ay1 : ay0;
+
+	if (r->x0 >= canvas->width || r->y0 >= canvas->height) {
+		return false;
+	}
+	if (r->x1 >= canvas->width) r->x1 = canvas->width - 1;
+	if (r->y1 >= canvas->height) r->y1 = canvas->height - 1;
+	return true;
 }
 
+/**
+*  @brief: makes the frame just sent the front buffer. The new back buffer is one frame behind,
+*          the damaged areas are copied over so drawing continues on the current frame.
+*          If the EPD failed the buffers stay as they are and the damage is kept for the next update.
+*/
+static void canvas_SwapBuffers(Canvas* canvas, EPD_HandleTypeDef* epd) {
+	uint8_t* shown = canvas->image;
+
+	if (canvas->damage_count == 0 || EPD_status(epd) != EPD_OK) {
+		return;
+	}
+
+	canvas->image = canvas->front;
+	canvas->front = shown;
+
+	for (uint8_t i = 0; i < canvas->damage_count; i++) {
+		Canvas_rect* d = &canvas->damage[i];
+		uint16_t first = d->x0 / 8;
+		uint16_t len = d->x1 / 8 - first + 1;
+
+		for (uint16_t y = d->y0; y <= d->y1; y++) {
+			uint16_t n = y * (canvas->width / 8) + first;
+			memcpy(&canvas->image[n], &canvas->front[n], len);
+		}
+	}
+	canvas_ClearDamage(canvas);
+}
 
 /**
-*  @brief: this draws a vertical line on the frame buffer
+*  @brief: adds a rectangle to the damage list. Rectangles that touch are joined,
+*          a full list folds the new one into the entry that grows the least.
 */
-void canvas_DrawVerticalLine(Canvas* canvas, uint8_t x, uint8_t y, uint8_t line_height, uint8_t colored) {
-    int i;
-    for (i = y; i < y + line_height; i++) {
-        canvas_DrawPixel(canvas, x, i, colored);
-    }
+static void canvas_MergeDamage(Canvas* canvas, Canvas_rect r) {
+	uint8_t i;
+
+	for (;;) {
+		for (i = 0; i < canvas->damage_count; i++) {
+			Canvas_rect* d = &canvas->damage[i];
+			if (r.x0 <= d->x1 + 1 && d->x0 <= r.x1 + 1 && r.y0 <= d->y1 + 1 && d->y0 <= r.y1 + 1) {
+				break;
+			}
+		}
+
+		if (i == canvas->damage_count) {
+			if (canvas->damage_count < CANVAS_MAX_DAMAGE) {
+				break;
+			}
+
+			// List full, pick the cheapest rectangle to grow
+			uint32_t bestGrowth = UINT32_MAX;
+			for (uint8_t j = 0; j < canvas->damage_count; j++) {
+				Canvas_rect* d = &canvas->damage[j];
+				uint32_t w = ((r.x1 > d->x1) ? r.x1 : d->x1) - ((r.x0 < d->x0) ? r.x0 : d->x0) + 1;
+				uint32_t h = ((r.y1 > d->y1) ? r.y1 : d->y1) - ((r.y0 < d->y0) ? r.y0 : d->y0) + 1;
+				uint32_t growth = w * h - (uint32_t) (d->x1 - d->x0 + 1) * (d->y1 - d->y0 + 1);
+				if (growth < bestGrowth) {
+					bestGrowth = growth;
+					i = j;
+				}
+			}
+		}
+
+		// Join r with entry i and take it out of the list, the result may touch others
+		Canvas_rect* d = &canvas->damage[i];
+		if (d->x0 < r.x0) r.x0 = d->x0;
+		if (d->y0 < r.y0) r.y0 = d->y0;
+		if (d->x1 > r.x1) r.x1 = d->x1;
+		if (d->y1 > r.y1) r.y1 = d->y1;
+		canvas->damage[i] = canvas->damage[--canvas->damage_count];
+	}
+
+	canvas->damage[canvas->damage_count++] = r;
 }
 
 
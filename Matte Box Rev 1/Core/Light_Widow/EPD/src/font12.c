@@ -1376,7 +1376,9 @@ const uint8_t Font12_Table[] =
 };
 
 sFONT Font12 = {
-  Font12_Table,
+  FONT_TABLE(Font12_Table),
   7, /* Width */
   12, /* Height */
+  FONT_TABLE(Font12_Rotated),
+  &Font12_Packed,
 };
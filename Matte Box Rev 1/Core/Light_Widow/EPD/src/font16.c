@@ -1756,7 +1756,9 @@ const uint8_t Font16_Table[] =
 };
 
 sFONT Font16 = {
-  Font16_Table,
+  FONT_TABLE(Font16_Table),
   11, /* Width */
   16, /* Height */
+  FONT_TABLE(Font16_Rotated),
+  &Font16_Packed,
 };
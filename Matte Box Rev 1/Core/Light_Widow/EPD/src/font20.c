@@ -2134,7 +2134,9 @@ const uint8_t Font20_Table[] =
 
 
 sFONT Font20 = {
-  Font20_Table,
+  FONT_TABLE(Font20_Table),
   14, /* Width */
   20, /* Height */
+  FONT_TABLE(Font20_Rotated),
+  &Font20_Packed,
 };
@@ -2512,7 +2512,9 @@ const uint8_t Font24_Table [] =
 };
 
 sFONT Font24 = {
-  Font24_Table,
+  FONT_TABLE(Font24_Table),
   17, /* Width */
   24, /* Height */
+  FONT_TABLE(Font24_Rotated),
+  &Font24_Packed,
 };
@@ -996,7 +996,9 @@ const uint8_t Font8_Table[] =
 };
 
 sFONT Font8 = {
-  Font8_Table,
+  FONT_TABLE(Font8_Table),
   5, /* Width */
   8, /* Height */
+  FONT_TABLE(Font8_Rotated),
+  &Font8_Packed,
 };
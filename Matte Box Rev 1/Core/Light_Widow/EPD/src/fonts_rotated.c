@@ -0,0 +1,1273 @@
+/*
+ * fonts_rotated.c
+ *
+ *  Glyphs of the ST fonts, pre-rotated for canvas_BlitGlyph.
+ *  Generated by Tools/font_rotate.py, do not edit.
+ */
+
+#include "fonts.h"
+#include "epd_gfx.h"
+
+#if CANVAS_FONT_ROTATE != ROTATE_90
+#error "fonts_rotated.c was generated for ROTATE_90, run Tools/font_rotate.py --rotate"
+#endif
+
+// Font8, 5 columns of 8 rows per glyph
+const uint8_t Font8_Rotated[] =
+{
+	// ' '
+	0x00, 0x00, 0x00, 0x00, 0x00,
+	// '!'
+	0x00, 0x00, 0xf4, 0x00, 0x00,
+	// '"'
+	0x00, 0xc0, 0x00, 0xc0, 0x00,
+	// '#'
+	0x2a, 0x7c, 0xaa, 0x7c, 0xa8,
+	// '$'
+	0x00, 0x24, 0xf6, 0x58, 0x00,
+	// '%'
+	0x00, 0x10, 0xd0, 0x2c, 0x20,
+	// '&'
+	0x00, 0x1c, 0x74, 0x4c, 0x44,
+	// '''
+	0x00, 0x00, 0xe0, 0x00, 0x00,
+	// '('
+	0x00, 0x00, 0x7c, 0x82, 0x00,
+	// ')'
+	0x00, 0x82, 0x7c, 0x00, 0x00,
+	// '*'
+	0x00, 0x50, 0xe0, 0x50, 0x00,
+	// '+'
+	0x10, 0x10, 0x7c, 0x10, 0x10,
+	// ','
+	0x00, 0x00, 0x06, 0x08, 0x00,
+	// '-'
+	0x00, 0x10, 0x10, 0x10, 0x00,
+	// '.'
+	0x00, 0x00, 0x04, 0x00, 0x00,
+	// '/'
+	0x02, 0x0c, 0x70, 0x80, 0x00,
+	// '0'
+	0x00, 0x78, 0x84, 0x78, 0x00,
+	// '1'
+	0x04, 0x84, 0xfc, 0x04, 0x04,
+	// '2'
+	0x00, 0x4c, 0xb4, 0x44, 0x00,
+	// '3'
+	0x00, 0x44, 0x94, 0x68, 0x00,
+	// '4'
+	0x00, 0x30, 0x54, 0xfc, 0x14,
+	// '5'
+	0x00, 0xe8, 0xa4, 0x98, 0x00,
+	// '6'
+	0x00, 0x7c, 0xa4, 0x98, 0x00,
+	// '7'
+	0x00, 0xc0, 0x9c, 0xe0, 0x00,
+	// '8'
+	0x00, 0x58, 0xa4, 0x58, 0x00,
+	// '9'
+	0x00, 0x64, 0x94, 0xf8, 0x00,
+	// ':'
+	0x00, 0x00, 0x24, 0x00, 0x00,
+	// ';'
+	0x00, 0x00, 0x04, 0x28, 0x00,
+	// '<'
+	0x10, 0x10, 0x28, 0x44, 0x00,
+	// '='
+	0x00, 0x50, 0x50, 0x50, 0x00,
+	// '>'
+	0x00, 0x44, 0x28, 0x10, 0x10,
+	// '?'
+	0x00, 0x40, 0x94, 0x60, 0x00,
+	// '@'
+	0x00, 0x7c, 0x82, 0x92, 0x7a,
+	// 'A'
+	0x0c, 0xb4, 0xd0, 0x34, 0x0c,
+	// 'B'
+	0x84, 0xfc, 0xa4, 0xa4, 0x58,
+	// 'C'
+	0x00, 0xf8, 0x84, 0xc4, 0x00,
+	// 'D'
+	0x84, 0xfc, 0x84, 0x84, 0x78,
+	// 'E'
+	0x84, 0xfc, 0xa4, 0x84, 0xcc,
+	// 'F'
+	0x84, 0xfc, 0xa4, 0x80, 0xc0,
+	// 'G'
+	0x00, 0xf8, 0x84, 0x9c, 0x10,
+	// 'H'
+	0x84, 0xfc, 0xa4, 0x20, 0xfc,
+	// 'I'
+	0x00, 0x84, 0xfc, 0x84, 0x00,
+	// 'J'
+	0x00, 0x18, 0x84, 0xf8, 0x80,
+	// 'K'
+	0x84, 0xfc, 0x30, 0xdc, 0x84,
+	// 'L'
+	0x84, 0xfc, 0x84, 0x04, 0x0c,
+	// 'M'
+	0xfc, 0xe4, 0x10, 0xe4, 0xfc,
+	// 'N'
+	0x84, 0xfc, 0x64, 0x98, 0xfc,
+	// 'O'
+	0x00, 0x78, 0x84, 0x84, 0x78,
+	// 'P'
+	0x84, 0xfc, 0x94, 0x90, 0x60,
+	// 'Q'
+	0x00, 0x78, 0x84, 0x86, 0x7a,
+	// 'R'
+	0x84, 0xfc, 0x94, 0x90, 0x6c,
+	// 'S'
+	0x00, 0xcc, 0xa4, 0xdc, 0x00,
+	// 'T'
+	0xc0, 0x84, 0xfc, 0x84, 0xc0,
+	// 'U'
+	0x80, 0xf8, 0x04, 0x84, 0xf8,
+	// 'V'
+	0xc0, 0xb8, 0x04, 0x9c, 0xe0,
+	// 'W'
+	0xf8, 0x84, 0x38, 0x84, 0xf8,
+	// 'X'
+	0x84, 0xcc, 0x30, 0xcc, 0x84,
+	// 'Y'
+	0xc0, 0xa4, 0x1c, 0xa4, 0xc0,
+	// 'Z'
+	0x00, 0xcc, 0x94, 0xa4, 0xcc,
+	// '['
+	0x00, 0x00, 0xfe, 0x82, 0x00,
+	// '\'
+	0x80, 0x60, 0x1c, 0x02, 0x00,
+	// ']'
+	0x00, 0x82, 0xfe, 0x00, 0x00,
+	// '^'
+	0x00, 0x20, 0xc0, 0x20, 0x00,
+	// '_'
+	0x01, 0x01, 0x01, 0x01, 0x01,
+	// '`'
+	0x00, 0x00, 0x80, 0x40, 0x00,
+	// 'a'
+	0x00, 0x0c, 0x2c, 0x3c, 0x04,
+	// 'b'
+	0x84, 0xfc, 0x24, 0x24, 0x18,
+	// 'c'
+	0x00, 0x3c, 0x24, 0x24, 0x00,
+	// 'd'
+	0x00, 0x18, 0x24, 0xa4, 0xfc,
+	// 'e'
+	0x00, 0x38, 0x34, 0x34, 0x00,
+	// 'f'
+	0x00, 0x24, 0x7c, 0xa4, 0x00,
+	// 'g'
+	0x00, 0x18, 0x25, 0x25, 0x3e,
+	// 'h'
+	0x84, 0xfc, 0x24, 0x20, 0x1c,
+	// 'i'
+	0x00, 0x24, 0xbc, 0x04, 0x00,
+	// 'j'
+	0x00, 0x21, 0xa1, 0x3f, 0x00,
+	// 'k'
+	0x84, 0xfc, 0x10, 0x3c, 0x24,
+	// 'l'
+	0x00, 0x84, 0xfc, 0x04, 0x00,
+	// 'm'
+	0x3c, 0x20, 0x1c, 0x20, 0x1c,
+	// 'n'
+	0x24, 0x3c, 0x20, 0x20, 0x1c,
+	// 'o'
+	0x00, 0x18, 0x24, 0x24, 0x18,
+	// 'p'
+	0x21, 0x3f, 0x25, 0x24, 0x18,
+	// 'q'
+	0x00, 0x18, 0x24, 0x25, 0x3f,
+	// 'r'
+	0x00, 0x24, 0x3c, 0x24, 0x20,
+	// 's'
+	0x00, 0x04, 0x34, 0x28, 0x00,
+	// 't'
+	0x20, 0x78, 0x24, 0x24, 0x08,
+	// 'u'
+	0x20, 0x38, 0x04, 0x24, 0x3c,
+	// 'v'
+	0x20, 0x30, 0x0c, 0x0c, 0x30,
+	// 'w'
+	0x38, 0x24, 0x18, 0x24, 0x38,
+	// 'x'
+	0x00, 0x24, 0x18, 0x18, 0x24,
+	// 'y'
+	0x20, 0x39, 0x07, 0x38, 0x20,
+	// 'z'
+	0x00, 0x34, 0x2c, 0x34, 0x2c,
+	// '{'
+	0x00, 0x10, 0x7c, 0x82, 0x00,
+	// '|'
+	0x00, 0x00, 0xfe, 0x00, 0x00,
+	// '}'
+	0x00, 0x82, 0x7c, 0x10, 0x00,
+	// '~'
+	0x00, 0x08, 0x10, 0x08, 0x10
+};
+
+// Font12, 7 columns of 12 rows per glyph
+const uint8_t Font12_Rotated[] =
+{
+	// ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '!'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '"'
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00,
+	// '#'
+	0x00, 0x00, 0xac, 0x00, 0xf0, 0x01, 0xac, 0x06, 0xf0, 0x01, 0xa0, 0x06, 0x00, 0x00,
+	// '$'
+	0x00, 0x00, 0xb0, 0x01, 0x50, 0x02, 0x5c, 0x06, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00,
+	// '%'
+	0x00, 0x00, 0x40, 0x02, 0x40, 0x05, 0x50, 0x02, 0xa8, 0x00, 0x90, 0x00, 0x00, 0x00,
+	// '&'
+	0x00, 0x00, 0x30, 0x00, 0xc8, 0x00, 0x28, 0x01, 0x10, 0x01, 0x28, 0x00, 0x00, 0x00,
+	// '''
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '('
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00,
+	// ')'
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '*'
+	0x00, 0x00, 0x00, 0x02, 0xc0, 0x02, 0x00, 0x07, 0xc0, 0x02, 0x00, 0x02, 0x00, 0x00,
+	// '+'
+	0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0xf8, 0x03, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+	// ','
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '-'
+	0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// '.'
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '/'
+	0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00, 0x00,
+	// '0'
+	0x00, 0x00, 0xf0, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0xf0, 0x03, 0x00, 0x00,
+	// '1'
+	0x00, 0x00, 0x08, 0x00, 0x08, 0x04, 0xf8, 0x07, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+	// '2'
+	0x00, 0x00, 0x18, 0x02, 0x28, 0x04, 0x48, 0x04, 0x88, 0x04, 0x18, 0x03, 0x00, 0x00,
+	// '3'
+	0x00, 0x00, 0x10, 0x02, 0x08, 0x04, 0x88, 0x04, 0x88, 0x04, 0x70, 0x03, 0x00, 0x00,
+	// '4'
+	0x00, 0x00, 0x60, 0x00, 0xa0, 0x00, 0x20, 0x03, 0x28, 0x04, 0xf8, 0x07, 0x28, 0x00,
+	// '5'
+	0x00, 0x00, 0x10, 0x00, 0x88, 0x07, 0x88, 0x04, 0x88, 0x04, 0x70, 0x04, 0x00, 0x00,
+	// '6'
+	0x00, 0x00, 0xf0, 0x01, 0x88, 0x02, 0x88, 0x04, 0x88, 0x04, 0x70, 0x04, 0x00, 0x00,
+	// '7'
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x18, 0x04, 0xe0, 0x04, 0x00, 0x07, 0x00, 0x00,
+	// '8'
+	0x00, 0x00, 0x70, 0x03, 0x88, 0x04, 0x88, 0x04, 0x88, 0x04, 0x70, 0x03, 0x00, 0x00,
+	// '9'
+	0x00, 0x00, 0x88, 0x03, 0x48, 0x04, 0x48, 0x04, 0x50, 0x04, 0xe0, 0x03, 0x00, 0x00,
+	// ':'
+	0x00, 0x00, 0x00, 0x00, 0x98, 0x01, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ';'
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x98, 0x01, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00,
+	// '<'
+	0x40, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x10, 0x01, 0x08, 0x02, 0x08, 0x02, 0x00, 0x00,
+	// '='
+	0x00, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x00, 0x00,
+	// '>'
+	0x08, 0x02, 0x08, 0x02, 0x10, 0x01, 0xa0, 0x00, 0xa0, 0x00, 0x40, 0x00, 0x00, 0x00,
+	// '?'
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x28, 0x02, 0x40, 0x02, 0x80, 0x01, 0x00, 0x00,
+	// '@'
+	0x00, 0x00, 0xf8, 0x07, 0x04, 0x08, 0xc4, 0x08, 0x24, 0x09, 0xe8, 0x07, 0x00, 0x00,
+	// 'A'
+	0x08, 0x00, 0x38, 0x00, 0xe8, 0x05, 0x20, 0x06, 0xe8, 0x01, 0x38, 0x00, 0x08, 0x00,
+	// 'B'
+	0x08, 0x04, 0xf8, 0x07, 0x88, 0x04, 0x88, 0x04, 0x88, 0x04, 0x70, 0x03, 0x00, 0x00,
+	// 'C'
+	0x00, 0x00, 0xf0, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x10, 0x06, 0x00, 0x00,
+	// 'D'
+	0x08, 0x04, 0xf8, 0x07, 0x08, 0x04, 0x08, 0x04, 0x10, 0x02, 0xe0, 0x01, 0x00, 0x00,
+	// 'E'
+	0x08, 0x04, 0xf8, 0x07, 0x88, 0x04, 0xc8, 0x05, 0x08, 0x04, 0x18, 0x06, 0x00, 0x00,
+	// 'F'
+	0x00, 0x00, 0x08, 0x04, 0xf8, 0x07, 0x88, 0x04, 0xc0, 0x05, 0x00, 0x04, 0x00, 0x06,
+	// 'G'
+	0x00, 0x00, 0xf0, 0x03, 0x08, 0x04, 0x08, 0x04, 0x48, 0x04, 0x70, 0x06, 0x40, 0x00,
+	// 'H'
+	0x08, 0x04, 0xf8, 0x07, 0x88, 0x04, 0x80, 0x00, 0x88, 0x04, 0xf8, 0x07, 0x08, 0x04,
+	// 'I'
+	0x00, 0x00, 0x08, 0x04, 0x08, 0x04, 0xf8, 0x07, 0x08, 0x04, 0x08, 0x04, 0x00, 0x00,
+	// 'J'
+	0x00, 0x00, 0x70, 0x00, 0x08, 0x04, 0x08, 0x04, 0xf0, 0x07, 0x00, 0x04, 0x00, 0x00,
+	// 'K'
+	0x08, 0x04, 0xf8, 0x07, 0x48, 0x04, 0xc0, 0x00, 0x20, 0x05, 0x18, 0x06, 0x08, 0x04,
+	// 'L'
+	0x00, 0x00, 0x08, 0x04, 0xf8, 0x07, 0x08, 0x04, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00,
+	// 'M'
+	0x08, 0x04, 0xf8, 0x07, 0x08, 0x07, 0xc0, 0x00, 0x08, 0x07, 0xf8, 0x07, 0x08, 0x04,
+	// 'N'
+	0x08, 0x04, 0xf8, 0x07, 0x08, 0x07, 0xe0, 0x00, 0x18, 0x04, 0xf8, 0x07, 0x00, 0x04,
+	// 'O'
+	0x00, 0x00, 0xf0, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0xf0, 0x03, 0x00, 0x00,
+	// 'P'
+	0x00, 0x00, 0x08, 0x04, 0xf8, 0x07, 0x48, 0x04, 0x40, 0x04, 0x80, 0x03, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x00, 0xf0, 0x03, 0x08, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0xf4, 0x03, 0x00, 0x00,
+	// 'R'
+	0x08, 0x04, 0xf8, 0x07, 0x48, 0x04, 0x40, 0x04, 0x60, 0x04, 0x90, 0x03, 0x08, 0x00,
+	// 'S'
+	0x00, 0x00, 0x18, 0x03, 0x90, 0x04, 0x88, 0x04, 0x88, 0x02, 0x70, 0x06, 0x00, 0x00,
+	// 'T'
+	0x00, 0x06, 0x00, 0x04, 0x08, 0x04, 0xf8, 0x07, 0x08, 0x04, 0x00, 0x04, 0x00, 0x06,
+	// 'U'
+	0x00, 0x04, 0xf0, 0x07, 0x08, 0x04, 0x08, 0x00, 0x08, 0x04, 0xf0, 0x07, 0x00, 0x04,
+	// 'V'
+	0x00, 0x04, 0x00, 0x07, 0xe0, 0x04, 0x18, 0x00, 0xe0, 0x04, 0x00, 0x07, 0x00, 0x04,
+	// 'W'
+	0x00, 0x04, 0xf0, 0x07, 0x08, 0x04, 0xf0, 0x00, 0x08, 0x04, 0xf0, 0x07, 0x00, 0x04,
+	// 'X'
+	0x08, 0x04, 0x18, 0x06, 0x20, 0x01, 0xc0, 0x00, 0x20, 0x01, 0x18, 0x06, 0x08, 0x04,
+	// 'Y'
+	0x00, 0x04, 0x00, 0x06, 0x88, 0x05, 0x78, 0x00, 0x88, 0x05, 0x00, 0x06, 0x00, 0x04,
+	// 'Z'
+	0x00, 0x00, 0x18, 0x06, 0x28, 0x04, 0xc8, 0x04, 0x08, 0x05, 0x18, 0x06, 0x00, 0x00,
+	// '['
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x07, 0x02, 0x04, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00,
+	// '\'
+	0x00, 0x00, 0x00, 0x04, 0x80, 0x03, 0x60, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ']'
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x02, 0x04, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00,
+	// '^'
+	0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
+	// '_'
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+	// '`'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	// 'a'
+	0x00, 0x00, 0xb0, 0x00, 0x48, 0x01, 0x48, 0x01, 0x48, 0x01, 0xf8, 0x00, 0x08, 0x00,
+	// 'b'
+	0x08, 0x04, 0xf8, 0x07, 0x88, 0x00, 0x08, 0x01, 0x08, 0x01, 0xf0, 0x00, 0x00, 0x00,
+	// 'c'
+	0x00, 0x00, 0xf0, 0x00, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x90, 0x01, 0x00, 0x00,
+	// 'd'
+	0x00, 0x00, 0xf0, 0x00, 0x08, 0x01, 0x08, 0x01, 0x88, 0x04, 0xf8, 0x07, 0x08, 0x00,
+	// 'e'
+	0x00, 0x00, 0xf0, 0x00, 0x48, 0x01, 0x48, 0x01, 0x48, 0x01, 0xc8, 0x00, 0x00, 0x00,
+	// 'f'
+	0x00, 0x00, 0x08, 0x01, 0xf8, 0x03, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x00, 0x00,
+	// 'g'
+	0x00, 0x00, 0xf0, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x8a, 0x00, 0xfc, 0x01, 0x00, 0x01,
+	// 'h'
+	0x08, 0x04, 0xf8, 0x07, 0x88, 0x00, 0x00, 0x01, 0x08, 0x01, 0xf8, 0x00, 0x08, 0x00,
+	// 'i'
+	0x00, 0x00, 0x08, 0x01, 0x08, 0x01, 0xf8, 0x05, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+	// 'j'
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x01, 0x02, 0x05, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x00,
+	// 'k'
+	0x08, 0x04, 0xf8, 0x07, 0x40, 0x00, 0x68, 0x01, 0x98, 0x01, 0x08, 0x01, 0x00, 0x00,
+	// 'l'
+	0x00, 0x00, 0x08, 0x00, 0x08, 0x04, 0xf8, 0x07, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+	// 'm'
+	0x08, 0x01, 0xf8, 0x01, 0x08, 0x01, 0xf8, 0x00, 0x08, 0x01, 0xf8, 0x00, 0x08, 0x00,
+	// 'n'
+	0x08, 0x01, 0xf8, 0x01, 0x88, 0x00, 0x00, 0x01, 0x08, 0x01, 0xf8, 0x00, 0x08, 0x00,
+	// 'o'
+	0x00, 0x00, 0xf0, 0x00, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0xf0, 0x00, 0x00, 0x00,
+	// 'p'
+	0x02, 0x01, 0xfe, 0x01, 0x8a, 0x00, 0x08, 0x01, 0x08, 0x01, 0xf0, 0x00, 0x00, 0x00,
+	// 'q'
+	0x00, 0x00, 0xf0, 0x00, 0x08, 0x01, 0x08, 0x01, 0x8a, 0x00, 0xfe, 0x01, 0x02, 0x01,
+	// 'r'
+	0x00, 0x00, 0x08, 0x01, 0xf8, 0x01, 0x88, 0x00, 0x08, 0x01, 0x08, 0x01, 0x00, 0x00,
+	// 's'
+	0x00, 0x00, 0x98, 0x00, 0x48, 0x01, 0x48, 0x01, 0x48, 0x01, 0xb0, 0x01, 0x00, 0x00,
+	// 't'
+	0x00, 0x00, 0x00, 0x01, 0xf0, 0x03, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x10, 0x00,
+	// 'u'
+	0x00, 0x01, 0xf0, 0x01, 0x08, 0x00, 0x08, 0x00, 0x10, 0x01, 0xf8, 0x01, 0x08, 0x00,
+	// 'v'
+	0x00, 0x01, 0xc0, 0x01, 0x30, 0x01, 0x08, 0x00, 0x30, 0x01, 0xc0, 0x01, 0x00, 0x01,
+	// 'w'
+	0x00, 0x01, 0xf0, 0x01, 0x08, 0x01, 0x70, 0x00, 0x08, 0x01, 0xf0, 0x01, 0x00, 0x01,
+	// 'x'
+	0x08, 0x01, 0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x98, 0x01, 0x08, 0x01, 0x00, 0x00,
+	// 'y'
+	0x00, 0x01, 0x82, 0x01, 0x62, 0x01, 0x1e, 0x00, 0x32, 0x01, 0xc0, 0x01, 0x00, 0x01,
+	// 'z'
+	0x00, 0x00, 0x98, 0x01, 0x28, 0x01, 0x48, 0x01, 0x88, 0x01, 0x18, 0x01, 0x00, 0x00,
+	// '{'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xdc, 0x03, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00,
+	// '|'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '}'
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0xdc, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '~'
+	0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00
+};
+
+// Font16, 11 columns of 16 rows per glyph
+const uint8_t Font16_Rotated[] =
+{
+	// ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '!'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x7f, 0xa0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '"'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x30, 0x00, 0x00,
+	// '#'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x07, 0xf0, 0x7f, 0x00, 0x7d, 0xf0, 0x07, 0xf0, 0x7f, 0x00, 0x7d, 0x00, 0x05, 0x00, 0x00,
+	// '$'
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x38, 0xe0, 0x7c, 0x20, 0x4e, 0x38, 0xc6, 0x20, 0x47, 0xe0, 0x73, 0xc0, 0x71, 0x00, 0x00, 0x00, 0x00,
+	// '%'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x36, 0xc0, 0x06, 0x20, 0x05, 0x20, 0x0d, 0xc0, 0x08, 0x00, 0x00,
+	// '&'
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xe0, 0x1d, 0x20, 0x3f, 0xa0, 0x23, 0xc0, 0x20, 0xe0, 0x21, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00,
+	// '''
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3e, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '('
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xe0, 0x1f, 0x78, 0x78, 0x18, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ')'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x60, 0x38, 0x70, 0xf0, 0x1f, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '*'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x18, 0x00, 0x00,
+	// '+'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xc0, 0x1f, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	// ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	// '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '/'
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x78, 0x00, 0xe0, 0x01, 0x80, 0x03, 0x00, 0x0e, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xc0, 0x00, 0x00,
+	// '0'
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0xc0, 0x3f, 0x60, 0x60, 0x20, 0x40, 0x60, 0x60, 0xc0, 0x3f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	// '1'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x7f, 0xe0, 0x7f, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+	// '2'
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0xe0, 0x38, 0xa0, 0x61, 0x20, 0x43, 0x20, 0x46, 0x20, 0x7c, 0x20, 0x38, 0x00, 0x00, 0x00, 0x00,
+	// '3'
+	0x00, 0x00, 0x40, 0x20, 0x60, 0x60, 0x20, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x4e, 0xe0, 0x7f, 0xc0, 0x33, 0x00, 0x00, 0x00, 0x00,
+	// '4'
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x07, 0xa0, 0x1c, 0xa0, 0x70, 0xe0, 0x7f, 0xe0, 0x7f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '5'
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x7e, 0x20, 0x7c, 0x20, 0x44, 0x20, 0x44, 0xe0, 0x47, 0xc0, 0x43, 0x00, 0x00, 0x00, 0x00,
+	// '6'
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xc0, 0x3f, 0x60, 0x32, 0x20, 0x64, 0x20, 0x44, 0xe0, 0x47, 0xc0, 0x43, 0x00, 0x00, 0x00, 0x00,
+	// '7'
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0xe0, 0x40, 0xe0, 0x4f, 0x00, 0x7f, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '8'
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x3b, 0xe0, 0x7f, 0x20, 0x44, 0x20, 0x44, 0x20, 0x44, 0xe0, 0x7f, 0xc0, 0x3b, 0x00, 0x00, 0x00, 0x00,
+	// '9'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x3c, 0x20, 0x7e, 0x20, 0x42, 0x60, 0x42, 0xc0, 0x64, 0xc0, 0x3f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	// ':'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ';'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x00, 0x40, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '<'
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x05, 0x80, 0x08, 0x40, 0x10, 0x40, 0x10, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+	// '='
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00,
+	// '>'
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x40, 0x10, 0x40, 0x10, 0x80, 0x08, 0x00, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
+	// '?'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0xa0, 0x21, 0xa0, 0x23, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
+	// '@'
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x1f, 0x20, 0x20, 0x10, 0x43, 0x90, 0x44, 0x90, 0x44, 0xa0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'A'
+	0x00, 0x00, 0x20, 0x00, 0xe0, 0x20, 0xe0, 0x27, 0x20, 0x3f, 0x00, 0x31, 0x00, 0x31, 0x20, 0x3f, 0xe0, 0x07, 0xe0, 0x00, 0x20, 0x00,
+	// 'B'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x22, 0x20, 0x22, 0x20, 0x22, 0xe0, 0x3f, 0xc0, 0x1d, 0x00, 0x00, 0x00, 0x00,
+	// 'C'
+	0x00, 0x00, 0x80, 0x0f, 0xc0, 0x1f, 0x60, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x10, 0x80, 0x38, 0x00, 0x00,
+	// 'D'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x30, 0xc0, 0x1f, 0x80, 0x0f, 0x00, 0x00,
+	// 'E'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x22, 0x20, 0x22, 0x20, 0x27, 0x20, 0x20, 0xe0, 0x38, 0x00, 0x00, 0x00, 0x00,
+	// 'F'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x22, 0x20, 0x22, 0x00, 0x27, 0x00, 0x20, 0x00, 0x20, 0x00, 0x38, 0x00, 0x00,
+	// 'G'
+	0x00, 0x00, 0x80, 0x0f, 0xc0, 0x1f, 0x60, 0x30, 0x20, 0x20, 0x20, 0x21, 0x20, 0x21, 0xe0, 0x11, 0xc0, 0x39, 0x00, 0x01, 0x00, 0x00,
+	// 'H'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x22, 0x00, 0x02, 0x20, 0x22, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x20, 0x00, 0x00,
+	// 'I'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+	// 'J'
+	0x00, 0x00, 0xc0, 0x01, 0xe0, 0x01, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x3f, 0xc0, 0x3f, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00,
+	// 'K'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x23, 0x00, 0x07, 0x80, 0x2d, 0xe0, 0x38, 0x60, 0x30, 0x20, 0x20, 0x00, 0x00,
+	// 'L'
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0xe0, 0x01, 0x00, 0x00,
+	// 'M'
+	0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x0c, 0x20, 0x07, 0x80, 0x01, 0x20, 0x07, 0x20, 0x0c, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x20,
+	// 'N'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x0c, 0x00, 0x07, 0x80, 0x21, 0xe0, 0x3f, 0xe0, 0x3f, 0x00, 0x20, 0x00, 0x00,
+	// 'O'
+	0x00, 0x00, 0x80, 0x0f, 0xc0, 0x1f, 0x60, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x30, 0xc0, 0x1f, 0x80, 0x0f, 0x00, 0x00,
+	// 'P'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x21, 0x20, 0x21, 0x20, 0x21, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x00, 0x80, 0x0f, 0xc0, 0x1f, 0x68, 0x30, 0x38, 0x20, 0x38, 0x20, 0x28, 0x20, 0x68, 0x30, 0xd8, 0x1f, 0x90, 0x0f, 0x00, 0x00,
+	// 'R'
+	0x00, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x22, 0x20, 0x22, 0x00, 0x23, 0xc0, 0x3d, 0xe0, 0x1c, 0x20, 0x00, 0x20, 0x00,
+	// 'S'
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x1c, 0xe0, 0x3e, 0x20, 0x26, 0x20, 0x22, 0x20, 0x23, 0xe0, 0x3b, 0xc0, 0x39, 0x00, 0x00, 0x00, 0x00,
+	// 'T'
+	0x00, 0x00, 0x00, 0x3c, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x3f, 0xe0, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
+	// 'U'
+	0x00, 0x00, 0x00, 0x20, 0xc0, 0x3f, 0xe0, 0x3f, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0xe0, 0x3f, 0xc0, 0x3f, 0x00, 0x20, 0x00, 0x00,
+	// 'V'
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x3f, 0xe0, 0x27, 0x60, 0x00, 0xe0, 0x27, 0x00, 0x3f, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00,
+	// 'W'
+	0x00, 0x20, 0x00, 0x3e, 0xe0, 0x3f, 0xe0, 0x20, 0xc0, 0x27, 0x00, 0x0e, 0xc0, 0x27, 0xe0, 0x20, 0xe0, 0x3f, 0x00, 0x3e, 0x00, 0x20,
+	// 'X'
+	0x00, 0x00, 0x20, 0x20, 0x60, 0x30, 0xe0, 0x38, 0xa0, 0x2f, 0x00, 0x07, 0xa0, 0x2f, 0xe0, 0x38, 0x60, 0x30, 0x20, 0x20, 0x00, 0x00,
+	// 'Y'
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x20, 0x38, 0x20, 0x2c, 0xe0, 0x07, 0xe0, 0x07, 0x20, 0x2c, 0x20, 0x38, 0x00, 0x30, 0x00, 0x20,
+	// 'Z'
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x38, 0xe0, 0x20, 0xa0, 0x21, 0x20, 0x27, 0x20, 0x2c, 0x20, 0x38, 0xe0, 0x30, 0x00, 0x00, 0x00, 0x00,
+	// '['
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0xf8, 0x7f, 0x08, 0x40, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00,
+	// '\'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x0e, 0x80, 0x03, 0xe0, 0x01, 0x78, 0x00, 0x18, 0x00, 0x00, 0x00,
+	// ']'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x08, 0x40, 0xf8, 0x7f, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '^'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x00, 0x60, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	// '_'
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+	// '`'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'a'
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xe0, 0x09, 0x20, 0x09, 0x20, 0x09, 0x40, 0x09, 0xe0, 0x0f, 0xe0, 0x07, 0x20, 0x00, 0x00, 0x00,
+	// 'b'
+	0x00, 0x00, 0x20, 0x40, 0xe0, 0x7f, 0xe0, 0x7f, 0x40, 0x04, 0x20, 0x08, 0x20, 0x08, 0x60, 0x0c, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x00,
+	// 'c'
+	0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x60, 0x0c, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x60, 0x04, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00,
+	// 'd'
+	0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x60, 0x0c, 0x20, 0x08, 0x20, 0x08, 0x40, 0x44, 0xe0, 0x7f, 0xe0, 0x7f, 0x20, 0x00, 0x00, 0x00,
+	// 'e'
+	0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x60, 0x0d, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x0d, 0x60, 0x07, 0x40, 0x03, 0x00, 0x00,
+	// 'f'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xe0, 0x3f, 0xe0, 0x7f, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x00, 0x40, 0x00, 0x40,
+	// 'g'
+	0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x64, 0x0c, 0x24, 0x08, 0x24, 0x08, 0x44, 0x04, 0xfc, 0x0f, 0xf8, 0x0f, 0x00, 0x08, 0x00, 0x00,
+	// 'h'
+	0x00, 0x00, 0x20, 0x40, 0xe0, 0x7f, 0xe0, 0x7f, 0x20, 0x04, 0x00, 0x08, 0x20, 0x08, 0xe0, 0x0f, 0xe0, 0x07, 0x20, 0x00, 0x00, 0x00,
+	// 'i'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0xe0, 0x6f, 0xe0, 0x6f, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+	// 'j'
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x68, 0xfc, 0x6f, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'k'
+	0x00, 0x00, 0x20, 0x40, 0xe0, 0x7f, 0xe0, 0x7f, 0x00, 0x03, 0xa0, 0x0f, 0xe0, 0x0c, 0x60, 0x08, 0x20, 0x08, 0x20, 0x00, 0x00, 0x00,
+	// 'l'
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x40, 0x20, 0x40, 0xe0, 0x7f, 0xe0, 0x7f, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+	// 'm'
+	0x00, 0x00, 0x20, 0x08, 0xe0, 0x0f, 0xe0, 0x0f, 0x00, 0x08, 0xe0, 0x0f, 0xe0, 0x0f, 0x00, 0x08, 0xe0, 0x0f, 0xe0, 0x07, 0x20, 0x00,
+	// 'n'
+	0x00, 0x00, 0x20, 0x08, 0xe0, 0x0f, 0xe0, 0x0f, 0x20, 0x04, 0x00, 0x08, 0x20, 0x08, 0xe0, 0x0f, 0xe0, 0x07, 0x20, 0x00, 0x00, 0x00,
+	// 'o'
+	0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x60, 0x0c, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x60, 0x0c, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x00,
+	// 'p'
+	0x00, 0x00, 0x04, 0x08, 0xfc, 0x0f, 0xfc, 0x0f, 0x44, 0x04, 0x24, 0x08, 0x20, 0x08, 0x60, 0x0c, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x00,
+	// 'q'
+	0x00, 0x00, 0x80, 0x03, 0xc0, 0x07, 0x60, 0x0c, 0x20, 0x08, 0x24, 0x08, 0x44, 0x04, 0xfc, 0x0f, 0xfc, 0x0f, 0x04, 0x08, 0x00, 0x00,
+	// 'r'
+	0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xe0, 0x0f, 0xe0, 0x0f, 0x20, 0x04, 0x20, 0x08, 0x20, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00,
+	// 's'
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x0f, 0x20, 0x0b, 0x20, 0x0b, 0xa0, 0x09, 0xe0, 0x0d, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	// 't'
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0xc0, 0x7f, 0xe0, 0x7f, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'u'
+	0x00, 0x00, 0x00, 0x08, 0xc0, 0x0f, 0xe0, 0x0f, 0x20, 0x00, 0x20, 0x00, 0x40, 0x08, 0xe0, 0x0f, 0xe0, 0x0f, 0x20, 0x00, 0x00, 0x00,
+	// 'v'
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x80, 0x0f, 0xe0, 0x09, 0x60, 0x00, 0xe0, 0x09, 0x80, 0x0f, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x00,
+	// 'w'
+	0x00, 0x08, 0x00, 0x0f, 0xe0, 0x0f, 0xe0, 0x08, 0xc0, 0x01, 0x00, 0x03, 0xc0, 0x01, 0xe0, 0x08, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0x08,
+	// 'x'
+	0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x60, 0x0c, 0xe0, 0x0f, 0x80, 0x03, 0xe0, 0x0f, 0x60, 0x0c, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00,
+	// 'y'
+	0x00, 0x00, 0x00, 0x08, 0x04, 0x0c, 0x04, 0x0f, 0xcc, 0x0b, 0x7c, 0x00, 0xf4, 0x00, 0xc0, 0x0b, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x08,
+	// 'z'
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x0c, 0xe0, 0x08, 0xa0, 0x09, 0x20, 0x09, 0x20, 0x0b, 0x20, 0x0e, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	// '{'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x3f, 0xf8, 0x7e, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '|'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '}'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0xf8, 0x7e, 0xf0, 0x3f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '~'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00
+};
+
+// Font20, 14 columns of 20 rows per glyph
+const uint8_t Font20_Rotated[] =
+{
+	// ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '!'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x07, 0xc0, 0xfc, 0x07, 0xc0, 0xf0, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '"'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '#'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0xf0, 0xff, 0x0f, 0xf0, 0xff, 0x0f, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00,
+	0xf0, 0xff, 0x0f, 0xf0, 0xff, 0x0f, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '$'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe7, 0x00, 0x80, 0xf7, 0x01, 0x80, 0x31, 0x03, 0xf0, 0x31, 0x0f, 0xf0, 0x31, 0x0f,
+	0x80, 0x19, 0x03, 0x00, 0x9f, 0x03, 0x00, 0x8e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '%'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x4c, 0x04, 0x00, 0x58, 0x04, 0x00, 0x58, 0x04, 0x80, 0x93, 0x03, 0x40, 0x34, 0x00,
+	0x40, 0x34, 0x00, 0x40, 0x64, 0x00, 0x80, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '&'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x80, 0xef, 0x00, 0xc0, 0xfc, 0x00, 0xc0, 0x9c, 0x01, 0xc0, 0x8e, 0x01,
+	0xc0, 0x87, 0x01, 0x80, 0x87, 0x01, 0xc0, 0x8e, 0x01, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '''
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xf0, 0x03,
+	0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '('
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0xe0, 0xff, 0x01,
+	0xf8, 0xc0, 0x07, 0x18, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ')'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0xf8, 0xc0, 0x07, 0xe0, 0xff, 0x01, 0x00, 0x3f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '*'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xf8, 0x07, 0x00, 0xf8, 0x07,
+	0x00, 0x7c, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '+'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x80, 0xff, 0x01, 0x80, 0xff, 0x01,
+	0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xf0, 0x01, 0x00, 0xc0, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0xc0, 0x01, 0x00,
+	0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '/'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xf0, 0x01, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x78, 0x00,
+	0x00, 0xe0, 0x03, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '0'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x80, 0xff, 0x03, 0xc0, 0x01, 0x07, 0xc0, 0x00, 0x06, 0xc0, 0x00, 0x06, 0xc0, 0x00, 0x06,
+	0xc0, 0x01, 0x07, 0x80, 0xff, 0x03, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '1'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07,
+	0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '2'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x01, 0xc0, 0x81, 0x03, 0xc0, 0x03, 0x07, 0xc0, 0x06, 0x06, 0xc0, 0x0c, 0x06, 0xc0, 0x18, 0x06,
+	0xc0, 0x30, 0x07, 0xc0, 0xe0, 0x03, 0xc0, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '3'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0x01, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x06, 0xc0, 0x30, 0x06, 0xc0, 0x30, 0x06, 0xc0, 0x30, 0x06,
+	0xc0, 0x79, 0x07, 0x80, 0xff, 0x03, 0x00, 0xcf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '4'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x76, 0x00, 0x00, 0xe6, 0x00, 0xc0, 0x86, 0x03, 0xc0, 0x06, 0x07,
+	0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '5'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xf1, 0x07, 0xc0, 0xf0, 0x07, 0xc0, 0x60, 0x06, 0xc0, 0x60, 0x06, 0xc0, 0x60, 0x06,
+	0xc0, 0x71, 0x06, 0x80, 0x3f, 0x06, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '6'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x80, 0xff, 0x01, 0x80, 0xd9, 0x03, 0xc0, 0x30, 0x03, 0xc0, 0x30, 0x07, 0xc0, 0x30, 0x06,
+	0xc0, 0x39, 0x06, 0x80, 0x1f, 0x06, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '7'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0xc0, 0x01, 0x06, 0xc0, 0x0f, 0x06,
+	0x00, 0x7e, 0x06, 0x00, 0xf0, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '8'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x01, 0x80, 0xff, 0x03, 0xc0, 0x79, 0x07, 0xc0, 0x30, 0x06, 0xc0, 0x30, 0x06, 0xc0, 0x30, 0x06,
+	0xc0, 0x79, 0x07, 0x80, 0xff, 0x03, 0x00, 0xcf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '9'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x01, 0xc0, 0xf0, 0x03, 0xc0, 0x38, 0x07, 0xc0, 0x18, 0x06, 0xc0, 0x19, 0x06, 0x80, 0x19, 0x06,
+	0x80, 0x37, 0x03, 0x00, 0xff, 0x03, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ':'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x71, 0x00,
+	0xc0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ';'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x80, 0x71, 0x00,
+	0x00, 0x71, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '<'
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x36, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00,
+	0x80, 0xc1, 0x00, 0x80, 0xc1, 0x00, 0xc0, 0x80, 0x01, 0xc0, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '='
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00,
+	0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '>'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x01, 0xc0, 0x80, 0x01, 0x80, 0xc1, 0x00, 0x80, 0xc1, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00,
+	0x00, 0x36, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	// '?'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0xc0, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x0c, 0x03, 0xc0, 0x1c, 0x03,
+	0x00, 0x18, 0x03, 0x00, 0xf0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '@'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xc0, 0x00, 0x03, 0x20, 0x00, 0x02, 0x20, 0x1c, 0x04, 0x20, 0x22, 0x04,
+	0x20, 0x22, 0x06, 0x40, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'A'
+	0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x01, 0x00, 0xc0, 0x07, 0x03, 0xc0, 0x1e, 0x03, 0x00, 0x7e, 0x03, 0x00, 0xe6, 0x03, 0x00, 0x86, 0x03,
+	0x00, 0xf6, 0x03, 0xc0, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xc0, 0x01, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'B'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03,
+	0xc0, 0x38, 0x03, 0xc0, 0xfc, 0x01, 0xc0, 0xef, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'C'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xff, 0x00, 0x80, 0xc3, 0x01, 0xc0, 0x81, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03,
+	0xc0, 0x00, 0x03, 0xc0, 0x81, 0x01, 0x80, 0xc3, 0x03, 0x00, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'D'
+	0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03,
+	0xc0, 0x81, 0x03, 0x80, 0xc3, 0x01, 0x00, 0xff, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'E'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x3c, 0x03,
+	0xc0, 0x3c, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0xc3, 0x03, 0xc0, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'F'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x3c, 0x03,
+	0x00, 0x3c, 0x03, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'G'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x80, 0xff, 0x01, 0x80, 0x81, 0x01, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x0c, 0x03,
+	0xc0, 0x0c, 0x03, 0xc0, 0x8c, 0x01, 0x80, 0xcf, 0x03, 0x80, 0xcf, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+	// 'H'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x18, 0x03, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0xc0, 0x18, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'I'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03,
+	0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'J'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x80, 0x0f, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03,
+	0xc0, 0x01, 0x03, 0x80, 0xff, 0x03, 0x00, 0xff, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	// 'K'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x30, 0x03, 0x00, 0x78, 0x00,
+	0x00, 0xce, 0x03, 0x80, 0x87, 0x03, 0xc0, 0x81, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x00,
+	// 'L'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03,
+	0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x07, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'M'
+	0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xc0, 0x03, 0xc0, 0x78, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x1e, 0x00,
+	0xc0, 0x78, 0x00, 0xc0, 0xc0, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x00,
+	// 'N'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xe0, 0x01, 0xc0, 0x78, 0x00, 0x00, 0x1e, 0x03,
+	0x80, 0x07, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'O'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xff, 0x00, 0x80, 0xc3, 0x01, 0xc0, 0x81, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03,
+	0xc0, 0x81, 0x03, 0x80, 0xc3, 0x01, 0x00, 0xff, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'P'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x0c, 0x03, 0xc0, 0x0c, 0x03, 0xc0, 0x0c, 0x03,
+	0x00, 0x0c, 0x03, 0x00, 0x9c, 0x03, 0x00, 0xf8, 0x01, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xff, 0x00, 0x98, 0xc3, 0x01, 0xf8, 0x81, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x03,
+	0xf8, 0x81, 0x03, 0x98, 0xc3, 0x01, 0x38, 0xff, 0x00, 0x30, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'R'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0x00, 0x18, 0x03,
+	0x00, 0x1c, 0x03, 0x00, 0xbf, 0x03, 0x80, 0xf7, 0x01, 0xc0, 0xe1, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'S'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe3, 0x00, 0xc0, 0xf3, 0x01, 0x80, 0xb1, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x18, 0x03,
+	0xc0, 0x18, 0x03, 0xc0, 0x8d, 0x01, 0x80, 0xcf, 0x03, 0x00, 0xc7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'T'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0xe0, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03,
+	0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0x00, 0xe0, 0x03, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'U'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xff, 0x03, 0x80, 0xff, 0x03, 0xc0, 0x01, 0x03, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00,
+	0xc0, 0x01, 0x03, 0x80, 0xff, 0x03, 0x00, 0xff, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'V'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x3e, 0x03, 0xc0, 0x0f, 0x00, 0xc0, 0x01, 0x00, 0xc0, 0x0f, 0x00,
+	0x00, 0x3e, 0x03, 0x00, 0xf0, 0x03, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'W'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf8, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x03, 0x03, 0x80, 0x0f, 0x03, 0x00, 0x7c, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0x7c, 0x00, 0x80, 0x0f, 0x03, 0xc0, 0x03, 0x03, 0xc0, 0xff, 0x03, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x03,
+	// 'X'
+	0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0xc0, 0x81, 0x03, 0xc0, 0xc3, 0x03, 0xc0, 0x66, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3c, 0x00,
+	0xc0, 0x66, 0x03, 0xc0, 0xc3, 0x03, 0xc0, 0x81, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'Y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0xc0, 0xc0, 0x03, 0xc0, 0x70, 0x03, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00,
+	0xc0, 0x70, 0x03, 0xc0, 0xc0, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'Z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc1, 0x03, 0xc0, 0xc3, 0x03, 0xc0, 0x06, 0x03, 0xc0, 0x1c, 0x03, 0xc0, 0x38, 0x03,
+	0xc0, 0x60, 0x03, 0xc0, 0xc3, 0x03, 0xc0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '['
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x07, 0xf8, 0xff, 0x07,
+	0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '\'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x80, 0x0f, 0x00, 0xe0, 0x03, 0x00, 0x78, 0x00, 0x00, 0x1e, 0x00,
+	0xc0, 0x07, 0x00, 0xf0, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// ']'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0xf8, 0xff, 0x07, 0xf8, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '^'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03,
+	0x00, 0x80, 0x01, 0x00, 0xc0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '_'
+	0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+	// '`'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'a'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xc0, 0x27, 0x00, 0xc0, 0x6e, 0x00, 0xc0, 0x6c, 0x00, 0xc0, 0x6c, 0x00, 0xc0, 0x6c, 0x00,
+	0x80, 0x6d, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'b'
+	0x00, 0x00, 0x00, 0xc0, 0x00, 0x06, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07, 0x80, 0x31, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0x80, 0x31, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'c'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x80, 0x3f, 0x00, 0xc0, 0x31, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0xc0, 0x20, 0x00, 0x80, 0x79, 0x00, 0x80, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'd'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x80, 0x3f, 0x00, 0x80, 0x31, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0x80, 0x31, 0x06, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'e'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x3f, 0x00, 0x80, 0x3d, 0x00, 0xc0, 0x6c, 0x00, 0xc0, 0x6c, 0x00, 0xc0, 0x6c, 0x00,
+	0xc0, 0x6c, 0x00, 0xc0, 0x3c, 0x00, 0x80, 0x3d, 0x00, 0x80, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'f'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x07, 0xc0, 0x60, 0x06,
+	0xc0, 0x60, 0x06, 0xc0, 0x60, 0x06, 0xc0, 0x60, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'g'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x3f, 0x00, 0x8c, 0x31, 0x00, 0xcc, 0x60, 0x00, 0xcc, 0x60, 0x00, 0xcc, 0x60, 0x00,
+	0xcc, 0x60, 0x00, 0x9c, 0x31, 0x00, 0xf8, 0x7f, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+	// 'h'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x06, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07, 0xc0, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'i'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x7f, 0x06, 0xc0, 0x7f, 0x06,
+	0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'j'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x0c, 0x60, 0x00, 0x0c, 0x60, 0x00, 0x0c, 0x60, 0x06, 0x1c, 0x60, 0x06,
+	0xf8, 0x7f, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'k'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x06, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x7e, 0x00, 0xc0, 0x73, 0x00,
+	0xc0, 0x61, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'l'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x06, 0xc0, 0x00, 0x06, 0xc0, 0x00, 0x06, 0xc0, 0xff, 0x07, 0xc0, 0xff, 0x07,
+	0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'm'
+	0x00, 0x00, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x60, 0x00, 0x00, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x3f, 0x00,
+	0xc0, 0x60, 0x00, 0x00, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'n'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'o'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x3f, 0x00, 0x80, 0x31, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0x80, 0x31, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'p'
+	0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0xfc, 0x7f, 0x00, 0xfc, 0x7f, 0x00, 0x8c, 0x31, 0x00, 0xcc, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0x80, 0x31, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x3f, 0x00, 0x80, 0x31, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xcc, 0x60, 0x00, 0x8c, 0x31, 0x00, 0xfc, 0x7f, 0x00, 0xfc, 0x7f, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x00, 0x00,
+	// 'r'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x18, 0x00, 0xc0, 0x30, 0x00,
+	0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 's'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x39, 0x00, 0xc0, 0x3d, 0x00, 0xc0, 0x6c, 0x00, 0xc0, 0x6c, 0x00, 0xc0, 0x66, 0x00,
+	0xc0, 0x66, 0x00, 0x80, 0x77, 0x00, 0x80, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 't'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x80, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00,
+	0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0x80, 0x61, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'u'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x80, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00,
+	0x80, 0x61, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'v'
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x6f, 0x00, 0xc0, 0x03, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x00, 0x6f, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'w'
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x7c, 0x00, 0xc0, 0x7f, 0x00, 0xc0, 0x63, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x07, 0x00,
+	0xc0, 0x67, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'x'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x7b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00,
+	0xc0, 0x7b, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x60, 0x00, 0xc0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'y'
+	0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x0c, 0x70, 0x00, 0x0c, 0x7c, 0x00, 0x1c, 0x6f, 0x00, 0xfc, 0x03, 0x00, 0xec, 0x01, 0x00, 0x8c, 0x03, 0x00,
+	0x00, 0x6f, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// 'z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x63, 0x00, 0xc0, 0x66, 0x00, 0xc0, 0x6c, 0x00,
+	0xc0, 0x78, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '{'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0xf0, 0xff, 0x03, 0xf8, 0xfb, 0x07,
+	0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '|'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x07, 0xf8, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '}'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0xf8, 0xfb, 0x07, 0xf0, 0xff, 0x03, 0x00, 0x0e, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// '~'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00,
+	0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Font24, 17 columns of 24 rows per glyph
+const uint8_t Font24_Rotated[] =
+{
+	// ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '!'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe1, 0x3f, 0x80, 0xf9, 0x3f,
+	0x80, 0xe1, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '"'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '#'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0xc0, 0xbf, 0x01, 0xc0, 0xff, 0x3f, 0x00, 0xd8, 0x3f, 0x00, 0x98, 0x01,
+	0xc0, 0xbf, 0x01, 0xc0, 0xff, 0x3f, 0x00, 0xd8, 0x3f, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '$'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x00, 0x9f, 0x0f, 0x00, 0xce, 0x19, 0x00, 0xc3, 0x18, 0xf0, 0xc3, 0x78,
+	0xf0, 0xe3, 0x78, 0x00, 0x67, 0x0e, 0x00, 0x7e, 0x1e, 0x00, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '%'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0xa0, 0x1f, 0x00, 0xfe, 0x39, 0x00, 0xff, 0x30, 0x80, 0xf3, 0x30,
+	0x80, 0xe1, 0x39, 0x80, 0xe1, 0x1f, 0x80, 0xf3, 0x0f, 0x00, 0xbf, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '&'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x9f, 0x03, 0x80, 0xf9, 0x07, 0x80, 0x71, 0x0c, 0x80, 0x39, 0x0c,
+	0x80, 0x1d, 0x0c, 0x80, 0x0f, 0x0e, 0x00, 0x0f, 0x0e, 0x80, 0x1f, 0x0c, 0x80, 0x19, 0x00, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '''
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xc0, 0x1f,
+	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '('
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+	0x00, 0xff, 0x07, 0xc0, 0xff, 0x0f, 0xe0, 0x03, 0x1f, 0xf0, 0x00, 0x3c, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// ')'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0xf0, 0x00, 0x3c, 0xe0, 0x03, 0x1f, 0xc0, 0xff, 0x0f, 0x80, 0xff, 0x03,
+	0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '*'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x30, 0x07, 0x00, 0xf0, 0x03, 0x00, 0xc0, 0x3f,
+	0x00, 0xc0, 0x3f, 0x00, 0xf0, 0x03, 0x00, 0x30, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '+'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0xff, 0x0f,
+	0x00, 0xff, 0x0f, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xf8, 0x00, 0x00,
+	0xe0, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00,
+	0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '/'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xf0, 0x01, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x78, 0x00,
+	0x00, 0xe0, 0x01, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '0'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x00, 0xfe, 0x0f, 0x00, 0x07, 0x1c, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30,
+	0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x00, 0x07, 0x1c, 0x00, 0xfe, 0x0f, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '1'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0c, 0x80, 0x01, 0x0c, 0x80, 0x01, 0x1c, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f,
+	0x80, 0xff, 0x3f, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '2'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0e, 0x80, 0x03, 0x1e, 0x80, 0x07, 0x18, 0x80, 0x0d, 0x30, 0x80, 0x19, 0x30, 0x80, 0x31, 0x30,
+	0x80, 0x31, 0x30, 0x80, 0x61, 0x30, 0x80, 0xc1, 0x18, 0x80, 0x81, 0x1f, 0x80, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '3'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x18, 0x80, 0x01, 0x18, 0x80, 0xc1, 0x30, 0x80, 0xc1, 0x30,
+	0x80, 0xc1, 0x30, 0x80, 0xe1, 0x39, 0x00, 0x63, 0x1f, 0x00, 0x3f, 0x0e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '4'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xec, 0x00, 0x00, 0xcc, 0x03, 0x80, 0x0d, 0x07, 0x80, 0x0d, 0x1c,
+	0x80, 0x0d, 0x38, 0x80, 0xff, 0x3f, 0x80, 0xff, 0x3f, 0x80, 0x0d, 0x00, 0x80, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '5'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xc3, 0x3f, 0x80, 0xc1, 0x3f, 0x80, 0xc1, 0x30, 0x80, 0x81, 0x31, 0x80, 0x81, 0x31,
+	0x80, 0x81, 0x31, 0x80, 0x81, 0x31, 0x00, 0xc3, 0x30, 0x00, 0xff, 0x30, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '6'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0xff, 0x07, 0x00, 0x63, 0x0e, 0x80, 0xc1, 0x1c, 0x80, 0xc1, 0x18,
+	0x80, 0xc1, 0x30, 0x80, 0xc1, 0x30, 0x80, 0x63, 0x30, 0x00, 0x7f, 0x30, 0x00, 0x1e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '7'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x80, 0x03, 0x30,
+	0x80, 0x1f, 0x30, 0x00, 0xfe, 0x30, 0x00, 0xf0, 0x37, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '8'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0e, 0x00, 0x3f, 0x1f, 0x80, 0xe3, 0x39, 0x80, 0xc1, 0x30, 0x80, 0xc1, 0x30,
+	0x80, 0xc1, 0x30, 0x80, 0xc1, 0x30, 0x80, 0xe3, 0x39, 0x00, 0x3f, 0x1f, 0x00, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '9'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x0f, 0x80, 0xc1, 0x1f, 0x80, 0xc1, 0x38, 0x80, 0x61, 0x30, 0x80, 0x61, 0x30,
+	0x00, 0x63, 0x30, 0x00, 0x67, 0x30, 0x00, 0xce, 0x18, 0x00, 0xfc, 0x1f, 0x00, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// ':'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83, 0x03, 0x80, 0x83, 0x03,
+	0x80, 0x83, 0x03, 0x80, 0x83, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// ';'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x80, 0x87, 0x03, 0x00, 0x86, 0x03, 0x00, 0x84, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '<'
+	0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x8c, 0x01,
+	0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x03, 0x06, 0x80, 0x03, 0x0e, 0x80, 0x01, 0x0c, 0x80, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '='
+	0x00, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01,
+	0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '>'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x0c, 0x80, 0x01, 0x0c, 0x80, 0x03, 0x0e, 0x00, 0x03, 0x06, 0x00, 0x06, 0x03, 0x00, 0x06, 0x03, 0x00, 0x8c, 0x01,
+	0x00, 0x8c, 0x01, 0x00, 0xd8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '?'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x18, 0x80, 0x39, 0x18, 0x80, 0x39, 0x18,
+	0x00, 0x70, 0x18, 0x00, 0xe0, 0x1c, 0x00, 0xc0, 0x0f, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '@'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x80, 0xff, 0x0f, 0xc0, 0x01, 0x1c, 0xe0, 0x00, 0x38, 0x60, 0xf0, 0x30,
+	0x60, 0xf8, 0x31, 0x60, 0x8c, 0x33, 0x60, 0x0c, 0x3b, 0xc0, 0xfc, 0x1f, 0xc0, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'A'
+	0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x0f, 0x18, 0x80, 0x3d, 0x18, 0x80, 0xf9, 0x18, 0x00, 0xd8, 0x1b, 0x00, 0x18, 0x1f,
+	0x00, 0x18, 0x1c, 0x80, 0x19, 0x0f, 0x80, 0xf9, 0x03, 0x80, 0xf9, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x07, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x00,
+	// 'B'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18,
+	0x80, 0x61, 0x18, 0x80, 0x61, 0x18, 0x80, 0xe1, 0x1c, 0x80, 0xf1, 0x0f, 0x00, 0xbf, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'C'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xfe, 0x07, 0x00, 0x07, 0x0e, 0x00, 0x03, 0x0c, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x03, 0x0c, 0x00, 0x07, 0x1f, 0x00, 0x06, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'D'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x03, 0x0c, 0x00, 0x07, 0x0e, 0x00, 0xfe, 0x07, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'E'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18, 0x80, 0xf9, 0x19,
+	0x80, 0xf9, 0x19, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x0f, 0x1f, 0x80, 0x0f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'F'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18,
+	0x80, 0xf9, 0x19, 0x80, 0xf9, 0x19, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'G'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0xfe, 0x07, 0x00, 0x07, 0x0e, 0x00, 0x03, 0x0c, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x80, 0x31, 0x18, 0x80, 0x31, 0x18, 0x80, 0x31, 0x18, 0x80, 0x33, 0x0c, 0x00, 0x3f, 0x1f, 0x00, 0x3f, 0x1f, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'H'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18, 0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'I'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f,
+	0x80, 0xff, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'J'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x80, 0x01, 0x18, 0x00, 0x03, 0x18, 0x00, 0xff, 0x1f, 0x00, 0xfc, 0x1f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'K'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x31, 0x18, 0x80, 0x61, 0x18, 0x80, 0xe1, 0x18,
+	0x00, 0xf0, 0x01, 0x00, 0x38, 0x03, 0x00, 0x1e, 0x1e, 0x80, 0x0f, 0x1c, 0x80, 0x03, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x00,
+	// 'L'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x80, 0x01, 0x18, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'M'
+	0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x0f, 0x80, 0xc1, 0x03, 0x80, 0xf1, 0x00, 0x00, 0x38, 0x00,
+	0x00, 0x38, 0x00, 0x80, 0xf1, 0x00, 0x80, 0xc1, 0x03, 0x80, 0x01, 0x0f, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x00, 0x00, 0x00,
+	// 'N'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x07, 0x80, 0xc1, 0x03, 0x80, 0xe1, 0x01,
+	0x00, 0x78, 0x18, 0x00, 0x3c, 0x18, 0x00, 0x0e, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'O'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xfe, 0x07, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x0c, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18,
+	0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x00, 0x03, 0x0c, 0x00, 0x0f, 0x0f, 0x00, 0xfe, 0x07, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'P'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x31, 0x18, 0x80, 0x31, 0x18,
+	0x80, 0x31, 0x18, 0x80, 0x31, 0x18, 0x00, 0x30, 0x18, 0x00, 0x60, 0x1c, 0x00, 0xe0, 0x0f, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'Q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xfe, 0x07, 0x30, 0x0f, 0x0f, 0xf0, 0x03, 0x0c, 0xe0, 0x01, 0x18, 0xe0, 0x01, 0x18,
+	0xe0, 0x01, 0x18, 0xe0, 0x01, 0x18, 0x30, 0x03, 0x0c, 0x30, 0x0f, 0x0f, 0x70, 0xfe, 0x07, 0x60, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'R'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f, 0x80, 0xff, 0x1f, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18, 0x80, 0x61, 0x18,
+	0x00, 0x70, 0x18, 0x00, 0x78, 0x18, 0x00, 0xde, 0x1c, 0x00, 0xcf, 0x0f, 0x80, 0x83, 0x07, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'S'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8f, 0x07, 0x80, 0xcf, 0x0f, 0x00, 0xc3, 0x1c, 0x80, 0xe1, 0x18, 0x80, 0x61, 0x18,
+	0x80, 0x61, 0x18, 0x80, 0x71, 0x18, 0x80, 0x33, 0x0c, 0x00, 0x3f, 0x1f, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'T'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xff, 0x1f,
+	0x80, 0xff, 0x1f, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'U'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0xfc, 0x1f, 0x00, 0xff, 0x1f, 0x00, 0x03, 0x18, 0x80, 0x01, 0x18, 0x80, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0x80, 0x01, 0x18, 0x00, 0x03, 0x18, 0x00, 0xff, 0x1f, 0x00, 0xfc, 0x1f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'V'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x1f, 0x00, 0xe0, 0x1b, 0x00, 0x7c, 0x18, 0x00, 0x1f, 0x18,
+	0x80, 0x03, 0x00, 0x00, 0x1f, 0x18, 0x00, 0x7c, 0x18, 0x00, 0xe0, 0x1b, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00,
+	// 'W'
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1f, 0x00, 0xf8, 0x1f, 0x80, 0xff, 0x18, 0x80, 0x0f, 0x18, 0x00, 0x3e, 0x18, 0x00, 0xf0, 0x00,
+	0x00, 0xc0, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x3e, 0x18, 0x80, 0x0f, 0x18, 0x80, 0xff, 0x18, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x18,
+	// 'X'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0x03, 0x1c, 0x80, 0x07, 0x1e, 0x80, 0x0d, 0x1b, 0x80, 0x99, 0x19, 0x00, 0xf0, 0x00,
+	0x00, 0xf0, 0x00, 0x80, 0x99, 0x19, 0x80, 0x0d, 0x1b, 0x80, 0x07, 0x1e, 0x80, 0x03, 0x1c, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'Y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0x80, 0x01, 0x1e, 0x80, 0x81, 0x1b, 0x80, 0xc1, 0x01, 0x80, 0x7f, 0x00,
+	0x80, 0x7f, 0x00, 0x80, 0xc1, 0x19, 0x80, 0x81, 0x1b, 0x80, 0x01, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'Z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x80, 0x87, 0x1f, 0x80, 0x8d, 0x1f, 0x80, 0x19, 0x18, 0x80, 0x31, 0x18, 0x80, 0x61, 0x18,
+	0x80, 0xc1, 0x18, 0x80, 0x81, 0x19, 0x80, 0x01, 0x1b, 0x80, 0x1f, 0x1e, 0x80, 0x1f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '['
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x3f,
+	0xf0, 0xff, 0x3f, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '\'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3e, 0x00, 0x80, 0x0f, 0x00, 0xe0, 0x01,
+	0x00, 0x78, 0x00, 0x00, 0x1f, 0x00, 0xc0, 0x07, 0x00, 0xf0, 0x01, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// ']'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0xf0, 0xff, 0x3f,
+	0xf0, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '^'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x38,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '_'
+	0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '`'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60,
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'a'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x1f, 0x01, 0x80, 0x19, 0x03, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03,
+	0x80, 0x31, 0x03, 0x00, 0x33, 0x03, 0x80, 0xff, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'b'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x80, 0xff, 0x3f, 0x80, 0xff, 0x3f, 0x00, 0x83, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x00, 0x83, 0x01, 0x00, 0xff, 0x01, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'c'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x83, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x83, 0x01, 0x00, 0xe7, 0x03, 0x00, 0xe6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'd'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xff, 0x01, 0x00, 0x83, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x33, 0x00, 0x83, 0x31, 0x80, 0xff, 0x3f, 0x80, 0xff, 0x3f, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'e'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xff, 0x01, 0x00, 0xb3, 0x01, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03,
+	0x80, 0x31, 0x03, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03, 0x80, 0xb1, 0x01, 0x00, 0xf3, 0x01, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'f'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0xff, 0x0f, 0x80, 0xff, 0x1f, 0x80, 0x01, 0x33,
+	0x80, 0x01, 0x33, 0x80, 0x01, 0x33, 0x80, 0x01, 0x33, 0x80, 0x01, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'g'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xff, 0x01, 0x0c, 0x83, 0x01, 0x8c, 0x01, 0x03, 0x8c, 0x01, 0x03, 0x8c, 0x01, 0x03,
+	0x8c, 0x01, 0x03, 0x8c, 0x01, 0x03, 0x18, 0x83, 0x01, 0xf8, 0xff, 0x03, 0xf0, 0xff, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'h'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x80, 0xff, 0x3f, 0x80, 0xff, 0x3f, 0x80, 0x81, 0x01, 0x80, 0x01, 0x03, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03, 0x80, 0x01, 0x03, 0x80, 0x81, 0x03, 0x80, 0xff, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'i'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0xff, 0x33,
+	0x80, 0xff, 0x33, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'j'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x0c, 0x00, 0x03, 0x0c, 0x00, 0x03, 0x0c, 0x00, 0x03, 0x0c, 0x00, 0x03,
+	0x0c, 0x00, 0x33, 0x18, 0x00, 0x33, 0xf8, 0xff, 0x03, 0xf0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'k'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x80, 0xff, 0x3f, 0x80, 0xff, 0x3f, 0x00, 0x38, 0x00, 0x00, 0x7c, 0x00,
+	0x00, 0xee, 0x03, 0x80, 0x87, 0x03, 0x80, 0x03, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'l'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x80, 0x01, 0x30, 0x80, 0xff, 0x3f,
+	0x80, 0xff, 0x3f, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'm'
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0xff, 0x03, 0x80, 0xff, 0x03, 0x80, 0x81, 0x01, 0x80, 0x01, 0x03, 0x00, 0x00, 0x03, 0x80, 0xff, 0x03,
+	0x80, 0xff, 0x01, 0x80, 0x81, 0x03, 0x80, 0x01, 0x03, 0x00, 0x00, 0x03, 0x80, 0xff, 0x03, 0x80, 0xff, 0x01, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x00, 0x00, 0x00,
+	// 'n'
+	0x00, 0x00, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0xff, 0x03, 0x80, 0xff, 0x03, 0x80, 0x81, 0x01, 0x80, 0x01, 0x03, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03, 0x80, 0x01, 0x03, 0x80, 0x81, 0x03, 0x80, 0xff, 0x01, 0x80, 0xff, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'o'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x83, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x00, 0x83, 0x01, 0x00, 0xc7, 0x01, 0x00, 0xfe, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'p'
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x0c, 0x00, 0x03, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x03, 0x0c, 0x83, 0x01, 0x8c, 0x01, 0x03, 0x8c, 0x01, 0x03,
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x00, 0x83, 0x01, 0x00, 0xff, 0x01, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xff, 0x01, 0x00, 0x83, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+	0x8c, 0x01, 0x03, 0x8c, 0x01, 0x03, 0x0c, 0x83, 0x01, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x03, 0x0c, 0x00, 0x03, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'r'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0xff, 0x03, 0x80, 0xff, 0x03, 0x80, 0xc1, 0x00,
+	0x80, 0x81, 0x01, 0x80, 0x81, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 's'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe7, 0x00, 0x80, 0xf7, 0x01, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03, 0x80, 0x31, 0x03,
+	0x80, 0x39, 0x03, 0x80, 0x19, 0x03, 0x80, 0x1b, 0x03, 0x00, 0xdf, 0x03, 0x00, 0xce, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 't'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0xfe, 0x3f, 0x00, 0xff, 0x3f, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03,
+	0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x03, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'u'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0xfe, 0x03, 0x00, 0xff, 0x03, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+	0x80, 0x01, 0x00, 0x80, 0x01, 0x03, 0x00, 0x03, 0x03, 0x80, 0xff, 0x03, 0x80, 0xff, 0x03, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'v'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x3e, 0x03, 0x80, 0x0f, 0x00, 0x80, 0x03, 0x00,
+	0x80, 0x03, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x3e, 0x03, 0x00, 0xf0, 0x03, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'w'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x03, 0x00, 0xfe, 0x03, 0x80, 0x1f, 0x03, 0x80, 0x0f, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xe0, 0x00,
+	0x00, 0x7c, 0x00, 0x80, 0x0f, 0x00, 0x80, 0x1f, 0x03, 0x00, 0xfc, 0x03, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'x'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x80, 0x83, 0x03, 0x80, 0xc7, 0x03, 0x80, 0x6d, 0x03, 0x00, 0x38, 0x00,
+	0x00, 0x38, 0x00, 0x80, 0x6d, 0x03, 0x80, 0xc7, 0x03, 0x80, 0x83, 0x03, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// 'y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x03, 0x0c, 0x80, 0x03, 0x0c, 0xe0, 0x03, 0x0c, 0x78, 0x03, 0x1c, 0x1e, 0x03, 0x7c, 0x07, 0x00,
+	0xec, 0x03, 0x00, 0x8c, 0x07, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x78, 0x03, 0x00, 0xe0, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00,
+	// 'z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc1, 0x03, 0x80, 0xc3, 0x03, 0x80, 0x07, 0x03, 0x80, 0x0d, 0x03, 0x80, 0x19, 0x03,
+	0x80, 0x31, 0x03, 0x80, 0x61, 0x03, 0x80, 0xc1, 0x03, 0x80, 0x87, 0x03, 0x80, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '{'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0xe0, 0xff, 0x1f,
+	0xf0, 0xef, 0x3f, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '|'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x3f,
+	0xf0, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '}'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0xf0, 0xef, 0x3f,
+	0xe0, 0xff, 0x1f, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	// '~'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00
+};
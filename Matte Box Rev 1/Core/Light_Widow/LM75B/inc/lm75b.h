@@ -23,6 +23,7 @@
 
 #define LM75B_I2C_ADDR			(0x48 << 1)
 #define LM75B_I2C_TIMEOUT		1000
+#define LM75B_RETRY_INTERVAL	5000			/* ms before LM75B_GetCachedTemp retries a failed read */
 
 #define TEMP_REG				0x00			/* Temperature Register 16-bit Read Only 	*/
 #define CONFIG_REG				0x01			/* Configuration Register, 8-bit R/W 		*/
@@ -45,5 +46,11 @@ LM75B_error LM75B_Init(I2C_HandleTypeDef *hi2c, GPIO_TypeDef *Power_Port, uint16
 
 LM75B_error LM75B_ReadTemp(int8_t *temp);
 
+// Full sensor resolution, 1/8 deg C
+LM75B_error LM75B_ReadTempFine(int16_t *temp);
+
+// Last reading while it is younger than maxAge ms, a new one otherwise. 1/8 deg C
+LM75B_error LM75B_GetCachedTemp(int16_t *temp, uint32_t maxAge);
+
 
 #endif // LM75B_H
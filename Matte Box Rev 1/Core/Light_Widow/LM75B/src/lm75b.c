@@ -24,11 +24,17 @@ uint16_t LM75BPowerPin;				// Pin for the Auxiliary Components power enable
 I2C_HandleTypeDef *pi2c = 0;		// I2C Handle
 bool LM75BInitialized = false;		// Initialized Flag
 
+static int16_t cachedTemp;			// Last good reading, 1/8 deg C
+static uint32_t cachedTick;			// HAL tick of the last good reading
+static uint32_t attemptTick;		// HAL tick of the last read attempt
+static bool cachedValid = false;
+static bool attemptFailed = false;
+
 
 /******************************************************************************
  * PRIVATE PROTOTYPES
  *******************************************************************************/
-uint8_t readConfigReg(uint8_t *confReg);
+LM75B_error readConfigReg(uint8_t *confReg);
 
 LM75B_error LM75B_i2cReadBytes(uint8_t subAddr, uint8_t *dest, uint8_t Size);
 LM75B_error LM75B_i2cWriteBytes(uint8_t subAddr, uint8_t *src, uint8_t Size);
@@ -63,6 +69,17 @@ LM75B_error LM75B_Init(I2C_HandleTypeDef *hi2c, GPIO_TypeDef *Power_Port, uint16
 }
 
 LM75B_error LM75B_ReadTemp(int8_t *temp) {
+	int16_t temperature;
+
+	if (LM75B_ReadTempFine(&temperature) != LM75B_OK) {
+		return LM75B_ERR;
+	}
+
+	*temp = temperature / 8;			// 0.125 deg C Resolution, rounds towards 0
+	return LM75B_OK;
+}
+
+LM75B_error LM75B_ReadTempFine(int16_t *temp) {
 	if (!LM75BInitialized) {
 		return LM75B_ERR;
 	}
@@ -72,27 +89,43 @@ LM75B_error LM75B_ReadTemp(int8_t *temp) {
 
 	// Read the temperature register
 	uint8_t tempReg[2] = {0};
-	LM75B_i2cReadBytes(TEMP_REG, tempReg, 2);
+	LM75B_error status = LM75B_i2cReadBytes(TEMP_REG, tempReg, 2);
 
 	// Shutdown to conserve power
 	HAL_GPIO_WritePin(LM75BPowerPort, LM75BPowerPin, GPIO_PIN_RESET);
 
-	// Convert Array into signed integer
-	int16_t temperature = (tempReg[0] << 8) | tempReg[1];
+	if (status != LM75B_OK) {
+		return LM75B_ERR;
+	}
 
-	temperature = temperature >> 5;		// The temperature only uses the 11 most significant bits.
-	temperature *= 0.125;				// 0.125 deg C Resolution
+	// Two's complement, the temperature only uses the 11 most significant bits
+	*temp = (int16_t) ((tempReg[0] << 8) | tempReg[1]) >> 5;
 
-	// Check to see if temp is Negative
-	int8_t checktemp = (uint8_t) temperature;
+	return LM75B_OK;
+}
+
+LM75B_error LM75B_GetCachedTemp(int16_t *temp, uint32_t maxAge) {
+	uint32_t now = HAL_GetTick();
+
+	if (cachedValid && (now - cachedTick < maxAge)) {
+		*temp = cachedTemp;
+		return LM75B_OK;
+	}
 
-	if (checktemp & (1 << 7)) {
-		// We are negative, Strip the negative qualifier and send result
-		*temp = (checktemp & (0x7F)) * -1;
-	} else {
-		*temp = checktemp;
+	// Every read costs a 50 ms power up, don't keep retrying a sensor that fails
+	if (attemptFailed && (now - attemptTick < LM75B_RETRY_INTERVAL)) {
+		return LM75B_ERR;
+	}
+
+	attemptTick = now;
+	attemptFailed = (LM75B_ReadTempFine(&cachedTemp) != LM75B_OK);
+	if (attemptFailed) {
+		return LM75B_ERR;
 	}
 
+	cachedTick = now;
+	cachedValid = true;
+	*temp = cachedTemp;
 	return LM75B_OK;
 }
 
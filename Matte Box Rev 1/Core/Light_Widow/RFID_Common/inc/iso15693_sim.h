@@ -0,0 +1,69 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ISO15693_SIM_H_
+#define ISO15693_SIM_H_
+
+
+/********************************************************************************
+ * INCLUDES
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "st_errno.h"
+#include "iso15693_3.h"
+
+/********************************************************************************
+ * DEFINES
+ *******************************************************************************/
+#ifndef ISO15693_SIM_TAGS
+#define ISO15693_SIM_TAGS				0			/* 1 = build the simulated tag population into iso15693Inventory	*/
+#endif
+
+#define ISO15693_SIM_MAX_TAGS			64			/* Largest simulated population								*/
+#define ISO15693_SIM_FRAME_LEN			12			/* Inventory response: flags, DSFID, UID, CRC				*/
+
+// Modelled air time, high data rate, 1 out of 4 VCD coding, single subcarrier VICC
+#define ISO15693_SIM_VCD_BIT_NS			37760		/* VCD bit time												*/
+#define ISO15693_SIM_VCD_SOF_NS			75520		/* VCD SOF													*/
+#define ISO15693_SIM_VCD_EOF_NS			37760		/* VCD EOF													*/
+#define ISO15693_SIM_VICC_BIT_NS		37760		/* VICC bit time											*/
+#define ISO15693_SIM_VICC_SOF_NS		75520		/* VICC SOF													*/
+#define ISO15693_SIM_VICC_EOF_NS		37760		/* VICC EOF													*/
+#define ISO15693_SIM_T1_NS				320900		/* VICC response delay										*/
+#define ISO15693_SIM_NO_RESP_NS			396420		/* Wait for a response that never starts (t1 + VICC SOF)	*/
+#define ISO15693_SIM_EOF_GUARD_US		5000		/* Firmware delay before each slot EOF in iso15693Inventory	*/
+
+/********************************************************************************
+ * TYPES
+ *******************************************************************************/
+typedef enum {
+	SIM_UID_RANDOM,							/* Random serial numbers								*/
+	SIM_UID_SEQUENTIAL,						/* Consecutive serial numbers, one reel of tags			*/
+	SIM_UID_CLUSTERED						/* Low 32 bits shared, collisions resolve deep in the UID	*/
+} simUidDist_t;
+
+typedef struct {
+	uint32_t requests;						/* Inventory requests sent (new mask)				*/
+	uint32_t eofs;							/* Slot EOFs sent									*/
+	uint32_t collisions;					/* Slots with more than one response				*/
+	uint32_t timeouts;						/* Slots without response							*/
+	uint32_t errors;						/* Responses lost to injected RF errors				*/
+	uint32_t airTimeUs;						/* Modelled time on air								*/
+	uint32_t guardTimeUs;					/* Firmware slot delays not spent on air			*/
+	uint32_t cpuCycles;						/* DWT cycles spent in iso15693Inventory			*/
+	uint8_t tagsFound;						/* Tags returned by iso15693Inventory				*/
+} simInventoryStats_t;
+
+/********************************************************************************
+ * PROTOTYPES
+ *******************************************************************************/
+void iso15693SimLoad(uint8_t tagCount, simUidDist_t dist, uint8_t errorPercent, uint32_t seed);
+bool iso15693SimIsActive(void);
+
+// Drop-in replacements of the RFAL anticollision transceive calls
+ReturnCode iso15693SimTransceiveFrame(uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen);
+ReturnCode iso15693SimTransceiveEOF(uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen);
+
+ReturnCode iso15693SimBenchmark(iso15693NumSlots_t slotcnt, simInventoryStats_t *stats);
+
+#endif // ISO15693_SIM_H_
@@ -74,11 +74,17 @@
 */
 #define ST25R391X_COM_SINGLETXRX
 
-#define ST25R391X_SS_PIN                            RF_SPI_BSS_Pin
-#define ST25R391X_SS_PORT          	                RF_SPI_BSS_GPIO_Port
+#ifndef ST25R391X_READER_COUNT
+#define ST25R391X_READER_COUNT                      1U                  /*!< Number of ST25R3916 front-ends sharing the RF SPI bus */
+#endif
+#define ST25R391X_PRIMARY_READER                    0U                  /*!< Reader used for Wake-Up mode and as the default instance */
+
+#define ST25R391X_SS_PIN                            (platformCurrentReader()->ssPin)
+#define ST25R391X_SS_PORT                           (platformCurrentReader()->ssPort)
 
-#define ST25R391X_INT_PIN           	              RF_IRQ_Pin
-#define ST25R391X_INT_PORT          	              RF_IRQ_GPIO_Port
+#define ST25R391X_INT_PIN                           (platformCurrentReader()->intPin)
+#define ST25R391X_INT_PORT                          (platformCurrentReader()->intPort)
+#define ST25R391X_INT_IRQN                          (platformCurrentReader()->intIrqn)
 
 
 #define ST25R3916_INT_PIN           ST25DX_INT_1_Pin        /*!< GPIO pin used for ST25R3911 External Interrupt    */
@@ -103,8 +109,10 @@
 #define platformIrqST25R3916SetCallback( cb )
 #define platformIrqST25R3916PinInitialize()
 
-#define platformProtectST25R391xComm()                do{ globalCommProtectCnt++; __DSB();NVIC_DisableIRQ(RF_IRQ_EXTI_IRQn);__DSB();__ISB();}while(0) /*!< Protect unique access to ST25R391x communication channel - IRQ disable on single thread environment (MCU) ; Mutex lock on a multi thread environment      */
-#define platformUnprotectST25R391xComm()              do{ if (--globalCommProtectCnt==0) {NVIC_EnableIRQ(RF_IRQ_EXTI_IRQn);} }while(0)                /*!< Unprotect unique access to ST25R391x communication channel - IRQ enable on a single thread environment (MCU) ; Mutex unlock on a multi thread environment */
+#define platformCurrentReader()                       (&platformReaders[platformActiveReader])                      /*!< Reader instance currently addressed by the RFAL */
+
+#define platformProtectST25R391xComm()                do{ platformCurrentReader()->commProtectCnt++; __DSB();NVIC_DisableIRQ(ST25R391X_INT_IRQN);__DSB();__ISB();}while(0) /*!< Protect unique access to ST25R391x communication channel - IRQ disable on single thread environment (MCU) ; Mutex lock on a multi thread environment      */
+#define platformUnprotectST25R391xComm()              do{ if (--platformCurrentReader()->commProtectCnt==0) {NVIC_EnableIRQ(ST25R391X_INT_IRQN);} }while(0)                /*!< Unprotect unique access to ST25R391x communication channel - IRQ enable on a single thread environment (MCU) ; Mutex unlock on a multi thread environment */
 
 #define platformProtectST25R391xIrqStatus()           platformProtectST25R391xComm()
 #define platformUnprotectST25R391xIrqStatus()         platformUnprotectST25R391xComm()
@@ -113,6 +121,8 @@
 #define platformUnprotectWorker()                                                                   /* Unprotect RFAL Worker/Task/Process from concurrent execution on multi thread platforms */
 
 
+#define platformSelectReader( r )                     do{ rfalSwitchInstance(platformActiveReader, (r)); platformActiveReader = (r); }while(0) /*!< Park the RFAL/driver state of the active reader and address all following RFAL calls to reader r */
+
 #define platformSpiSelect()                           spiSelect(ST25R391X_SS_PORT, ST25R391X_SS_PIN)
 #define platformSpiDeselect()                         spiDeselect(ST25R391X_SS_PORT, ST25R391X_SS_PIN)
 
@@ -125,7 +135,11 @@
 #define platformGpioSet( port, pin )                  HAL_GPIO_WritePin(port, pin, GPIO_PIN_SET)    /*!< Turns the given GPIO High                   */
 #define platformGpioClear( port, pin )                HAL_GPIO_WritePin(port, pin, GPIO_PIN_RESET)  /*!< Turns the given GPIO Low                    */
 #define platformGpioToggle( port, pin )               HAL_GPIO_TogglePin(port, pin)                 /*!< Toogles the given GPIO                      */
+#if PLATFORM_SPI_TRACE
+#define platformGpioIsHigh( port, pin )               spiTraceGpioIsHigh(port, pin)                 /*!< Checks if the given LED is High, IRQ line emulated on replay */
+#else
 #define platformGpioIsHigh( port, pin )               (HAL_GPIO_ReadPin(port, pin) == GPIO_PIN_SET) /*!< Checks if the given LED is High             */
+#endif
 #define platformGpioIsLow( port, pin )                (!platformGpioIsHigh(port, pin))              /*!< Checks if the given LED is Low              */
 
 #define platformTimerCreate( t )                      timerCalculateTimer(t)                        /*!< Create a timer with the given time (ms)     */
@@ -148,12 +162,30 @@
 #define platformLog(...)                                                                            /*!< Log method                                  */
 
 
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! Pin assignment and protection state of one ST25R3916 front-end on the shared SPI bus */
+typedef struct {
+    GPIO_TypeDef *ssPort;                                 /*!< Chip select port                                  */
+    uint16_t      ssPin;                                  /*!< Chip select pin                                   */
+    GPIO_TypeDef *intPort;                                /*!< IRQ port                                          */
+    uint16_t      intPin;                                 /*!< IRQ pin                                           */
+    IRQn_Type     intIrqn;                                /*!< EXTI line serving the IRQ pin                     */
+    uint8_t       stage;                                  /*!< Filter stage covered by this reader, 0 = unknown  */
+    uint8_t       commProtectCnt;                         /*!< Protection counter for this reader                */
+} platformReader_t;
+
 /*
 ******************************************************************************
 * GLOBAL VARIABLES
 ******************************************************************************
 */
-extern uint8_t globalCommProtectCnt;                      /* Global Protection Counter provided per platform - instanciated in main.c    */
+extern platformReader_t platformReaders[ST25R391X_READER_COUNT]; /* Reader instances provided per platform - instanciated in rfid_controller.c */
+extern uint8_t platformActiveReader;                      /* Index of the reader currently addressed by the RFAL                         */
 
 /*
 ******************************************************************************
@@ -175,6 +207,12 @@ extern uint8_t globalCommProtectCnt;                      /* Global Protection C
 #define RFAL_FEATURE_ISO_DEP_POLL              false                   /*!< Enable/Disable RFAL support for Poller mode (PCD) ISO-DEP (ISO14443-4)    */
 #define RFAL_FEATURE_ISO_DEP_LISTEN            false                   /*!< Enable/Disable RFAL support for Listen mode (PICC) ISO-DEP (ISO14443-4)   */
 #define RFAL_FEATURE_NFC_DEP                   false                   /*!< Enable/Disable RFAL support for NFC-DEP (NFCIP1/P2P)                      */
+#ifndef RFAL_FEATURE_CRC_TABLE
+#define RFAL_FEATURE_CRC_TABLE                 true                    /*!< Table driven CRC-CCITT, costs 512 bytes of flash                          */
+#endif
+#ifndef RFAL_FEATURE_NFCV_PHY_TABLE
+#define RFAL_FEATURE_NFCV_PHY_TABLE            true                    /*!< Table driven ISO15693 1 of 4 coding and manchester decoding, 260 bytes of flash */
+#endif
 
 
 #define RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN    256                    /*!< ISO-DEP I-Block max length. Please use values as defined by rfalIsoDepFSx */
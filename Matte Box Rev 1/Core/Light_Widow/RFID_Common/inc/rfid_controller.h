@@ -20,6 +20,7 @@
 typedef struct {
 	uint8_t tagUID[ISO15693_UID_LENGTH];
 	uint8_t tagName[FILTER_NAME_LEN];
+	uint8_t stage;							/* Physical stage the tag was seen in, 0 = unknown	*/
 } filterTag_t;
 
 typedef struct {
@@ -33,5 +34,6 @@ typedef struct {
 ReturnCode rfidControllerInit(void);
 ReturnCode checkFilterTags(detectedTags_t *dTags);
 ReturnCode startWakeUpMode(void);
+void rfidReaderIrq(uint16_t intPin);
 
 #endif // RFID_CONTROLLER_H_
@@ -0,0 +1,64 @@
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SLOT_LOCATOR_H_
+#define SLOT_LOCATOR_H_
+
+
+/********************************************************************************
+ * INCLUDES
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "st_errno.h"
+#include "rfid_controller.h"
+#include "filter_controller.h"
+#include "24aa64_eep.h"
+
+/********************************************************************************
+ * DEFINES
+ *******************************************************************************/
+#define SLOT_CAL_EEPROM_ADDR		EEPROM_SLOT_CAL_ADDR	/* Calibration table lives in the reserved last page	*/
+#define SLOT_CAL_MAGIC				0x4C43		/* "LC" - marks a valid calibration table					*/
+#define SLOT_CAL_MAX_SAMPLES		16			/* Running mean weight cap, lets a centroid keep adapting	*/
+
+#define SLOT_MATCH_MAX_DIST			400			/* Max squared distance to accept a centroid match			*/
+
+/********************************************************************************
+ * TYPES
+ *******************************************************************************/
+typedef struct {								/* Change in the RF front-end caused by a wake-up event	*/
+	int16_t ampDelta;
+	int16_t phaseDelta;
+} rfSignature_t;
+
+typedef struct {								/* Mean signature of a tag inserted into one stage		*/
+	int16_t ampDelta;
+	int16_t phaseDelta;
+	uint16_t samples;
+} slotCentroid_t;
+
+typedef struct {								/* One applied wake-up event, printed as a trace line		*/
+	rfSignature_t sig;
+	uint8_t calStage;							/* Stage given by "calStage", 0 outside calibration		*/
+	uint8_t estimate;							/* Classifier output before the sample was added			*/
+} slotTrace_t;
+
+typedef struct {								/* Per-unit calibration table, stored in the EEPROM		*/
+	uint16_t magic;
+	slotCentroid_t stage[FILTER_SECTION_SIZE];
+} slotCalibration_t;
+
+/********************************************************************************
+ * PROTOTYPES
+ *******************************************************************************/
+void slotLocatorInit(void);
+
+ReturnCode slotLocatorCaptureBaseline(void);
+ReturnCode slotLocatorCaptureEvent(rfSignature_t *sig);
+uint8_t slotLocatorClassify(const rfSignature_t *sig);
+bool slotLocatorApply(detectedTags_t *dTags, filterSection_t *currentFilters, slotTrace_t *trace);
+
+void slotLocatorCalibrate(uint8_t stage);
+void slotLocatorClearCalibration(void);
+
+#endif // SLOT_LOCATOR_H_
@@ -41,6 +41,11 @@
 /* Includes ------------------------------------------------------------------*/
 #include "platform.h"
 
+/* Defines -------------------------------------------------------------------*/
+#ifndef PLATFORM_SPI_TRACE
+#define PLATFORM_SPI_TRACE    0U        /*!< 1 = record/replay every platformSpiTxRx() transaction */
+#endif
+
 /*!
  *****************************************************************************
  *  \brief  Initalize SPI
@@ -99,6 +104,112 @@ void spiDeselect(GPIO_TypeDef *ssPort, uint16_t ssPin);
  *****************************************************************************
  */
 HAL_StatusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint16_t length);
+
+#if PLATFORM_SPI_TRACE
+
+#define SPI_TRACE_BUF_LEN     16384U    /*!< Trace bytes kept in RAM. rfalInitialize, a 3 tag inventory and the name reads take well under half */
+#define SPI_TRACE_LOAD_LEN    24U       /*!< Trace bytes per spiLoad CLI line, keeps a line inside one USB packet */
+
+/*! Operating mode of the transaction trace */
+typedef enum {
+  SPI_TRACE_OFF,                        /*!< Plain pass-through to the SPI peripheral                    */
+  SPI_TRACE_RECORD,                     /*!< Transfer on the bus and store every transaction             */
+  SPI_TRACE_REPLAY                      /*!< Serve MISO bytes from a recorded trace, bus is not touched  */
+} spiTraceMode_t;
+
+/*! Header of one recorded platformSpiTxRx() transaction. The trace is a byte stream of
+ *  these, each followed by [length] MOSI bytes and [length] MISO bytes. */
+typedef struct {
+  uint32_t cycStart;                    /*!< DWT cycle counter at the start of the transfer */
+  uint32_t cycles;                      /*!< CPU cycles spent in the transfer               */
+  uint16_t length;                      /*!< Transfer length                                */
+  uint8_t  reader;                      /*!< platformActiveReader at the time of transfer   */
+  uint8_t  fromIsr;                     /*!< Issued by st25r3916Isr()                       */
+} spiTraceHeader_t;
+
+/*! Counters since the last spiTraceRecord() / spiTraceReplay() */
+typedef struct {
+  uint32_t transactions;                /*!< Transfers handled                                   */
+  uint32_t bytes;                       /*!< Bytes clocked (or replayed)                         */
+  uint32_t cycles;                      /*!< CPU cycles spent in spiTxRx()                       */
+  uint32_t dropped;                     /*!< Recorded transfers that did not fit the trace       */
+  uint32_t mismatches;                  /*!< Replay: MOSI differing from the recording           */
+  uint32_t exhausted;                   /*!< Replay: transfers past the end of the trace, sent on the bus */
+} spiTraceStats_t;
+
+/*!
+ *****************************************************************************
+ *  \brief  Clear the trace and start recording transactions
+ *
+ *  Once the trace is full, further transfers still go out on the bus and
+ *  are counted as dropped.
+ *****************************************************************************
+ */
+void spiTraceRecord(void);
+
+/*!
+ *****************************************************************************
+ *  \brief  Load a piece of a trace
+ *
+ *  Copies \a len bytes to \a offset of the trace. Offset 0 starts a new
+ *  trace, any other offset must continue the bytes loaded so far. Used by
+ *  the spiLoad CLI command, which reads back the lines spiDump printed.
+ *
+ *  \return : false when the piece does not continue the trace or does not fit
+ *
+ *****************************************************************************
+ */
+bool spiTraceLoad(uint16_t offset, const uint8_t *data, uint16_t len);
+
+/*!
+ *****************************************************************************
+ *  \brief  Replay the trace held in RAM
+ *
+ *  Following spiTxRx() calls return the recorded MISO bytes in order instead
+ *  of accessing the bus. Recorded ISR transactions are replayed by calling
+ *  st25r3916Isr() at the point they were recorded. Once the trace is used
+ *  up, the replay stops and further transfers go out on the bus again,
+ *  counted as exhausted.
+ *
+ *****************************************************************************
+ */
+void spiTraceReplay(void);
+
+/*!
+ *****************************************************************************
+ *  \brief  Stop recording or replaying, the trace is kept
+ *****************************************************************************
+ */
+void spiTraceStop(void);
+
+/*! \brief Current trace mode */
+spiTraceMode_t spiTraceGetMode(void);
+
+/*! \brief Number of transactions held in the trace */
+uint16_t spiTraceCount(void);
+
+/*! \brief Transactions consumed by the current or last replay */
+uint16_t spiTraceReplayed(void);
+
+/*! \brief Raw trace bytes, \a len receives the number of valid bytes */
+const uint8_t* spiTraceData(uint16_t *len);
+
+/*! \brief Counters since recording or replaying started */
+const spiTraceStats_t* spiTraceGetStats(void);
+
+/*!
+ *****************************************************************************
+ *  \brief  Read a GPIO, emulating the ST25R3916 IRQ line on replay
+ *
+ *  While replaying, the IRQ line reads high as long as the next recorded
+ *  transaction was issued by the ISR, so st25r3916Isr() consumes exactly the
+ *  recorded IRQ register reads. Any other pin is read from the port.
+ *
+ *****************************************************************************
+ */
+bool spiTraceGpioIsHigh(GPIO_TypeDef *port, uint16_t pin);
+
+#endif /* PLATFORM_SPI_TRACE */
    
 #endif /*__spi_H */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
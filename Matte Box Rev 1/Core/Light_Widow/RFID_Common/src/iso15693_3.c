@@ -46,12 +46,27 @@
 #include "utils.h"
 
 #include "rfal_rf.h"
+#include "iso15693_sim.h"
 
 /*
 ******************************************************************************
 * LOCAL MACROS
 ******************************************************************************
 */
+#if ISO15693_SIM_TAGS
+/* Inventory frames go to the simulated tag population while a benchmark runs */
+#define iso15693TxRxAnticollisionFrame( txBuf, txLen, rxBuf, rxLen, actLen ) \
+    (iso15693SimIsActive() ? iso15693SimTransceiveFrame(txBuf, txLen, rxBuf, rxLen, actLen) : rfalISO15693TransceiveAnticollisionFrame(txBuf, txLen, rxBuf, rxLen, actLen))
+#define iso15693TxRxEOFAnticollision( rxBuf, rxLen, actLen ) \
+    (iso15693SimIsActive() ? iso15693SimTransceiveEOF(rxBuf, rxLen, actLen) : rfalISO15693TransceiveEOFAnticollision(rxBuf, rxLen, actLen))
+#define iso15693SlotDelay( ms )  do{ if (!iso15693SimIsActive()) { HAL_Delay(ms); } }while(0)
+#else
+#define iso15693TxRxAnticollisionFrame( txBuf, txLen, rxBuf, rxLen, actLen ) \
+    rfalISO15693TransceiveAnticollisionFrame(txBuf, txLen, rxBuf, rxLen, actLen)
+#define iso15693TxRxEOFAnticollision( rxBuf, rxLen, actLen ) \
+    rfalISO15693TransceiveEOFAnticollision(rxBuf, rxLen, actLen)
+#define iso15693SlotDelay( ms )  HAL_Delay(ms)
+#endif
 
 /*
 ******************************************************************************
@@ -198,14 +213,14 @@ ReturnCode iso15693Inventory(iso15693NumSlots_t slotcnt,
             {
                 /* send the request. Note: CRC is appended by physical layer.
                    Add 3 to mask for flag field, command field and mask length */
-                err = rfalISO15693TransceiveAnticollisionFrame(iso15693Buffer, (3 + maskLengthBytes),
+                err = iso15693TxRxAnticollisionFrame(iso15693Buffer, (3 + maskLengthBytes),
                             (uint8_t*)crdptr, sizeof(iso15693ProximityCard_t), &actlength);
             }
             else
             {
-                HAL_Delay(5); /* this is a worst case delay for sending EOF. t3min depends on modulation depth and data rate */
+                iso15693SlotDelay(5); /* this is a worst case delay for sending EOF. t3min depends on modulation depth and data rate */
                 /* in case if slot count 16 slot is incremented by just sending EOF */
-                err = rfalISO15693TransceiveEOFAnticollision(
+                err = iso15693TxRxEOFAnticollision(
                             (uint8_t*)crdptr, sizeof(iso15693ProximityCard_t), &actlength);
             }
 
@@ -0,0 +1,254 @@
+/*  \file iso15693_sim.c
+ *  \author Colton Crandell
+ *  \brief  Simulated ISO15693 tag population for anticollision benchmarking
+ *
+ *  Stands in for the RFAL anticollision transceive calls used by iso15693Inventory. Every simulated
+ *  tag checks the inventory mask and slot number like a real VICC and the responses are merged bit
+ *  by bit, so a collision is reported at the first bit where the responding UIDs differ.
+ *  Only built with ISO15693_SIM_TAGS set to 1.
+ */
+
+
+/* *****************************************************************************
+ * INCLUDES
+ * *****************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "iso15693_sim.h"
+
+#if ISO15693_SIM_TAGS
+
+#include "platform.h"
+#include "rfal_crc.h"
+
+
+/* *****************************************************************************
+ * LOCAL DEFINES
+ * *****************************************************************************/
+#define SIM_ST_MFG_CODE			0x02		/* UID byte 6, STMicroelectronics	*/
+#define SIM_UID_MSB				0xE0		/* UID byte 7, fixed by ISO15693	*/
+
+/* *****************************************************************************
+ * LOCAL VARIABLES
+ * *****************************************************************************/
+static uint8_t simFrames[ISO15693_SIM_MAX_TAGS][ISO15693_SIM_FRAME_LEN];	/* Response of every tag		*/
+static uint8_t simTagCount = 0;
+static uint8_t simErrorPercent = 0;
+static uint32_t simRng = 1;
+
+static bool simActive = false;
+static simInventoryStats_t simStats;
+
+static uint8_t reqMaskLen;					/* Mask of the last inventory request	*/
+static uint8_t reqMask[ISO15693_UID_LENGTH];
+static bool reqSlots16;
+static uint8_t curSlot;
+
+/*******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ *******************************************************************************/
+static uint32_t simRandom(void);
+static bool tagResponds(const uint8_t *uid);
+static ReturnCode simRespond(uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen);
+
+/*******************************************************************************
+ * GLOBAL FUNCTIONS
+ *******************************************************************************/
+void iso15693SimLoad(uint8_t tagCount, simUidDist_t dist, uint8_t errorPercent, uint32_t seed) {
+	uint16_t crc;
+
+	if (tagCount > ISO15693_SIM_MAX_TAGS) tagCount = ISO15693_SIM_MAX_TAGS;
+
+	simTagCount = tagCount;
+	simErrorPercent = errorPercent;
+	simRng = (seed != 0) ? seed : 1;
+
+	for (uint8_t i = 0; i < tagCount; i++) {
+		uint8_t *f = simFrames[i];
+		uint8_t *uid = &f[2];
+		uint32_t serial = simRandom();
+
+		f[0] = 0x00;	// Flags
+		f[1] = 0x00;	// DSFID
+
+		switch (dist) {
+			case SIM_UID_RANDOM:
+				uid[0] = serial;
+				uid[1] = serial >> 8;
+				uid[2] = serial >> 16;
+				uid[3] = serial >> 24;
+				uid[4] = simRandom();
+				uid[5] = simRandom();
+				break;
+
+			case SIM_UID_SEQUENTIAL:
+				serial = 0x00A41000 + i;
+				uid[0] = serial;
+				uid[1] = serial >> 8;
+				uid[2] = serial >> 16;
+				uid[3] = serial >> 24;
+				uid[4] = 0x38;
+				uid[5] = 0x26;
+				break;
+
+			case SIM_UID_CLUSTERED:
+				uid[0] = 0x5A;
+				uid[1] = 0xC3;
+				uid[2] = 0x0F;
+				uid[3] = 0x96;
+				uid[4] = i;
+				uid[5] = serial;
+				break;
+		}
+		uid[6] = SIM_ST_MFG_CODE;
+		uid[7] = SIM_UID_MSB;
+
+		crc = ~rfalCrcCalculateCcitt(0xFFFF, f, ISO15693_SIM_FRAME_LEN - 2);
+		f[ISO15693_SIM_FRAME_LEN - 2] = crc;
+		f[ISO15693_SIM_FRAME_LEN - 1] = crc >> 8;
+	}
+}
+
+bool iso15693SimIsActive(void) {
+	return simActive;
+}
+
+// Inventory request, starts slot 0
+ReturnCode iso15693SimTransceiveFrame(uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen) {
+	uint8_t maskBytes;
+
+	reqSlots16 = ((txBuf[0] & ISO15693_REQ_FLAG_1_SLOT) == 0);
+	reqMaskLen = txBuf[2];
+	maskBytes = (reqMaskLen + 7) >> 3;
+	memset(reqMask, 0, sizeof(reqMask));
+	memcpy(reqMask, &txBuf[3], (maskBytes > ISO15693_UID_LENGTH) ? ISO15693_UID_LENGTH : maskBytes);
+	curSlot = 0;
+
+	simStats.requests++;
+	// Flags, command, mask length and mask plus the CRC
+	simStats.airTimeUs += (ISO15693_SIM_VCD_SOF_NS + (txBufLen + 2) * 8 * ISO15693_SIM_VCD_BIT_NS + ISO15693_SIM_VCD_EOF_NS) / 1000;
+
+	return simRespond(rxBuf, rxBufLen, actLen);
+}
+
+// EOF, moves every tag on to the next slot
+ReturnCode iso15693SimTransceiveEOF(uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen) {
+	curSlot++;
+
+	simStats.eofs++;
+	simStats.airTimeUs += ISO15693_SIM_VCD_EOF_NS / 1000;
+	simStats.guardTimeUs += ISO15693_SIM_EOF_GUARD_US;
+
+	return simRespond(rxBuf, rxBufLen, actLen);
+}
+
+// Run one full inventory against the loaded population
+ReturnCode iso15693SimBenchmark(iso15693NumSlots_t slotcnt, simInventoryStats_t *stats) {
+	static iso15693ProximityCard_t cards[ISO15693_SIM_MAX_TAGS];
+	uint8_t found = 0;
+	uint32_t cycStart;
+	ReturnCode err;
+
+	memset(&simStats, 0, sizeof(simStats));
+
+	simActive = true;
+	cycStart = DWT->CYCCNT;
+	err = iso15693Inventory(slotcnt, 0, NULL, cards, ISO15693_SIM_MAX_TAGS, &found);
+	simStats.cpuCycles = DWT->CYCCNT - cycStart;
+	simActive = false;
+
+	simStats.tagsFound = found;
+	*stats = simStats;
+	return err;
+}
+
+/* *****************************************************************************
+ * LOCAL FUNCTIONS
+ * *****************************************************************************/
+// xorshift32, repeatable for a given seed
+static uint32_t simRandom(void) {
+	simRng ^= simRng << 13;
+	simRng ^= simRng >> 17;
+	simRng ^= simRng << 5;
+	return simRng;
+}
+
+// A tag answers when the mask matches its UID, in 16 slot mode the next 4 UID bits pick the slot
+static bool tagResponds(const uint8_t *uid) {
+	uint8_t bit, slot = 0;
+
+	for (bit = 0; bit < reqMaskLen; bit++) {
+		if (((uid[bit >> 3] ^ reqMask[bit >> 3]) >> (bit & 7)) & 1) return false;
+	}
+
+	if (reqSlots16) {
+		for (uint8_t i = 0; i < 4; i++, bit++) {
+			slot |= ((uid[bit >> 3] >> (bit & 7)) & 1) << i;
+		}
+		if (slot != curSlot) return false;
+	}
+	return true;
+}
+
+// Merge the answers of all responding tags. Bits the tags agree on are received,
+// the first differing bit ends the reception with a collision.
+static ReturnCode simRespond(uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen) {
+	uint8_t andFrame[ISO15693_SIM_FRAME_LEN];
+	uint8_t orFrame[ISO15693_SIM_FRAME_LEN];
+	uint8_t responders = 0;
+	uint8_t len = (rxBufLen < ISO15693_SIM_FRAME_LEN) ? rxBufLen : ISO15693_SIM_FRAME_LEN;
+
+	memset(andFrame, 0xFF, sizeof(andFrame));
+	memset(orFrame, 0x00, sizeof(orFrame));
+
+	for (uint8_t t = 0; t < simTagCount; t++) {
+		if (!tagResponds(&simFrames[t][2])) continue;
+
+		for (uint8_t i = 0; i < ISO15693_SIM_FRAME_LEN; i++) {
+			andFrame[i] &= simFrames[t][i];
+			orFrame[i] |= simFrames[t][i];
+		}
+		responders++;
+	}
+
+	*actLen = 0;
+
+	if (responders == 0) {
+		simStats.timeouts++;
+		simStats.airTimeUs += ISO15693_SIM_NO_RESP_NS / 1000;
+		return ERR_TIMEOUT;
+	}
+
+	// Every responder sends its complete frame, the collision is only seen by the reader
+	simStats.airTimeUs += (ISO15693_SIM_T1_NS + ISO15693_SIM_VICC_SOF_NS
+			+ ISO15693_SIM_FRAME_LEN * 8 * ISO15693_SIM_VICC_BIT_NS + ISO15693_SIM_VICC_EOF_NS) / 1000;
+
+	for (uint8_t i = 0; i < len; i++) {
+		uint8_t diff = andFrame[i] ^ orFrame[i];
+
+		if (diff != 0) {
+			uint8_t bit = 0;
+			while (((diff >> bit) & 1) == 0) bit++;
+
+			// Keep the bits received before the collision
+			rxBuf[i] = andFrame[i] & ((1 << bit) - 1);
+			*actLen = i * 8 + bit;
+			simStats.collisions++;
+			return ERR_RF_COLLISION;
+		}
+		rxBuf[i] = andFrame[i];
+	}
+
+	if ((simErrorPercent > 0) && ((simRandom() % 100) < simErrorPercent)) {
+		simStats.errors++;
+		*actLen = len * 8;
+		return ERR_CRC;
+	}
+
+	*actLen = len * 8;
+	return ERR_NONE;
+}
+
+#endif // ISO15693_SIM_TAGS
@@ -19,6 +19,7 @@
 
 #include "rfal_analogConfig.h"
 #include "st25r3916/st25r3916_aat.h"
+#include "st25r3916/st25r3916_irq.h"
 #include "rfal_rf.h"
 
 
@@ -34,9 +35,26 @@ static bool rfidInitialized = false;
 static uint8_t crdcnt;
 static iso15693ProximityCard_t cards[FILTER_SECTION_SIZE];
 
+static uint8_t nextReader = 0;			/* Reader that starts the next inventory round */
+
+/* *****************************************************************************
+ * PLATFORM READER INSTANCES
+ * *****************************************************************************/
+// One entry per ST25R3916 on the RF SPI bus. Each reader gets its own chip select and IRQ line.
+// When a reader antenna only covers one filter stage, set [stage] to that stage (1..FILTER_SECTION_SIZE)
+// so tags are placed by the reader that saw them. A stage of 0 falls back to "first empty stage".
+platformReader_t platformReaders[ST25R391X_READER_COUNT] = {
+	{ RF_SPI_BSS_GPIO_Port, RF_SPI_BSS_Pin, RF_IRQ_GPIO_Port, RF_IRQ_Pin, RF_IRQ_EXTI_IRQn, 0, 0 },
+};
+
+uint8_t platformActiveReader = ST25R391X_PRIMARY_READER;
+
 /*******************************************************************************
  * LOCAL FUNCTION PROTOTYPES
  *******************************************************************************/
+static ReturnCode inventoryReader(detectedTags_t *dTags, uint8_t stage);
+static filterTag_t* findDetectedTag(detectedTags_t *dTags, const uint8_t *uid);
+static void clearDetectedTags(detectedTags_t *dTags);
 
 /*******************************************************************************
  * GLOBAL FUNCTIONS
@@ -47,67 +65,72 @@ ReturnCode rfidControllerInit(void) {
 
 	rfalAnalogConfigInitialize();                                                     /* Initialize RFAL's Analog Configs */
 
-	if ((err = rfalInitialize()) == ERR_NONE) {
-		rfidInitialized = true;
+	// Every front-end holds its own register set, so each one is initialized and tuned on its own
+	rfidInitialized = true;
+	for (uint8_t reader = 0; reader < ST25R391X_READER_COUNT; reader++) {
+		platformSelectReader(reader);
+
+		if ((err = rfalInitialize()) != ERR_NONE) {
+			rfidInitialized = false;
+			break;
+		}
+
+		err = st25r3916AatTune(NULL, &tuningStatus);
 	}
 
-	err = st25r3916AatTune(NULL, &tuningStatus);
+	platformSelectReader(ST25R391X_PRIMARY_READER);
 
 	return err;
 }
 
 ReturnCode checkFilterTags(detectedTags_t *dTags) {
 	ReturnCode err = ERR_NONE;
-	iso15693ProximityCard_t* crdptr;
-	uint8_t  resFlags;
-	uint16_t actLen;
-
-	uint8_t rxNameBuffer[16];
+	uint8_t reader;
 
 	if (!rfidInitialized) return ERR_PARAM;
 
 	// Reset dTags
-	dTags->tagCount = 0;
-	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
-		memset(dTags->filterTags[i].tagUID, 0, ISO15693_UID_LENGTH);
-		memset(dTags->filterTags[i].tagName, 0, FILTER_NAME_LEN);
-	}
-
-	crdptr = NULL;
+	clearDetectedTags(dTags);
 
-	// Initialize the Reader. Turn the field on and get ready to detect cards.
-	if ((err = iso15693Initialize(false, false)) != ERR_NONE) goto deinitReader;
+	// Round-robin the inventories across the readers. The starting reader moves on every call so
+	// no reader is always first on the bus. Every switch parks the RFAL/driver state of the previous
+	// reader and loads the one of the next, and each inventory re-initializes the ISO15693 mode on it.
+	for (uint8_t i = 0; i < ST25R391X_READER_COUNT; i++) {
+		reader = (nextReader + i) % ST25R391X_READER_COUNT;
+		platformSelectReader(reader);
 
-	// Get the card inventory. This will load the [cards] variable with UIDs and update the [crdcnt] variable
-	if ((err = iso15693Inventory(ISO15693_NUM_SLOTS_1, 0, NULL, cards, FILTER_SECTION_SIZE, &crdcnt)) != ERR_NONE) goto deinitReader;
+		if ((err = inventoryReader(dTags, platformReaders[reader].stage)) != ERR_NONE) break;
+	}
 
-	// Get the Filter names stored on each tag
-	for (uint8_t i = 0; i < crdcnt; i++) {
-		// Loop through each card by updating the UID pointer, selecting the card, read the mem block, and update the filter section name.
-		// Select the next card
-		crdptr = &cards[i];
-		if ((err = iso15693SelectPicc(crdptr)) != ERR_NONE) goto deinitReader;
+	nextReader = (nextReader + 1) % ST25R391X_READER_COUNT;
 
-		// Read the Memory Block
-		if ((err = iso15693ReadMultipleBlocks(crdptr, 0, 4, &resFlags, rxNameBuffer, sizeof(rxNameBuffer) + 1, &actLen)) != ERR_NONE) goto deinitReader;
+	// A failed round reports no tags, same as a single reader does. Partial results would make the
+	// missing tags look like empty stages.
+	if (err != ERR_NONE) clearDetectedTags(dTags);
 
-		// Copy the UID and Filter Name into the filterSection
-		memcpy(dTags->filterTags[i].tagUID, cards[i].uid, ISO15693_UID_LENGTH);
-		memcpy(dTags->filterTags[i].tagName, rxNameBuffer, FILTER_NAME_LEN);
-	}
+	// Hand the bus back to the primary reader for Wake-Up mode
+	platformSelectReader(ST25R391X_PRIMARY_READER);
 
-	dTags->tagCount = crdcnt;
+	return err;
+}
 
-	// Deinitialize the Reader
-	deinitReader:
-		iso15693Deinitialize(false);
+void rfidReaderIrq(uint16_t intPin) {
+#if PLATFORM_SPI_TRACE
+	// A replay raises the recorded IRQs itself, the real chip must not consume trace entries
+	if (spiTraceGetMode() == SPI_TRACE_REPLAY) return;
+#endif
 
-	return err;
+	// Only the reader currently addressed by the RFAL has its IRQ enabled and serviced
+	if (intPin == ST25R391X_INT_PIN) {
+		st25r3916Isr();
+	}
 }
 
 ReturnCode startWakeUpMode(void) {
 	rfalWakeUpConfig wkupConfig;
 
+	platformSelectReader(ST25R391X_PRIMARY_READER);
+
 	// Set up the Wake Up Configuration
 	wkupConfig.period = RFAL_WUM_PERIOD_100MS;
 	wkupConfig.irqTout = false;
@@ -145,6 +168,74 @@ ReturnCode startWakeUpMode(void) {
 /* *****************************************************************************
  * LOCAL FUNCTIONS
  * *****************************************************************************/
+// Run one inventory on the active reader and append the tags it found to dTags
+static ReturnCode inventoryReader(detectedTags_t *dTags, uint8_t stage) {
+	ReturnCode err = ERR_NONE;
+	iso15693ProximityCard_t* crdptr;
+	filterTag_t* dTag;
+	uint8_t  resFlags;
+	uint16_t actLen;
+
+	uint8_t rxNameBuffer[16];
+
+	// Initialize the Reader. Turn the field on and get ready to detect cards.
+	if ((err = iso15693Initialize(false, false)) != ERR_NONE) goto deinitReader;
+
+	// Get the card inventory. This will load the [cards] variable with UIDs and update the [crdcnt] variable
+	if ((err = iso15693Inventory(ISO15693_NUM_SLOTS_1, 0, NULL, cards, FILTER_SECTION_SIZE, &crdcnt)) != ERR_NONE) goto deinitReader;
+
+	// Get the Filter names stored on each tag
+	for (uint8_t i = 0; i < crdcnt; i++) {
+		crdptr = &cards[i];
+
+		// A tag that another reader already saw is coupled into more than one stage. Its stage can't be trusted.
+		dTag = findDetectedTag(dTags, crdptr->uid);
+		if (dTag != NULL) {
+			dTag->stage = 0;
+			continue;
+		}
+
+		if (dTags->tagCount >= FILTER_SECTION_SIZE) break;
+
+		// Select the card and read the mem block holding the filter name
+		if ((err = iso15693SelectPicc(crdptr)) != ERR_NONE) goto deinitReader;
+
+		if ((err = iso15693ReadMultipleBlocks(crdptr, 0, 4, &resFlags, rxNameBuffer, sizeof(rxNameBuffer) + 1, &actLen)) != ERR_NONE) goto deinitReader;
+
+		// Copy the UID, Filter Name and stage into the next free detected tag
+		dTag = &dTags->filterTags[dTags->tagCount];
+		memcpy(dTag->tagUID, crdptr->uid, ISO15693_UID_LENGTH);
+		memcpy(dTag->tagName, rxNameBuffer, FILTER_NAME_LEN);
+		dTag->stage = stage;
+
+		dTags->tagCount++;
+	}
+
+	// Deinitialize the Reader
+	deinitReader:
+		iso15693Deinitialize(false);
+
+	return err;
+}
+
+static void clearDetectedTags(detectedTags_t *dTags) {
+	dTags->tagCount = 0;
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
+		memset(dTags->filterTags[i].tagUID, 0, ISO15693_UID_LENGTH);
+		memset(dTags->filterTags[i].tagName, 0, FILTER_NAME_LEN);
+		dTags->filterTags[i].stage = 0;
+	}
+}
+
+static filterTag_t* findDetectedTag(detectedTags_t *dTags, const uint8_t *uid) {
+	for (uint8_t i = 0; i < dTags->tagCount; i++) {
+		if (memcmp(dTags->filterTags[i].tagUID, uid, ISO15693_UID_LENGTH) == 0) {
+			return &dTags->filterTags[i];
+		}
+	}
+	return NULL;
+}
+
 
 // Send Stay Quiet
 
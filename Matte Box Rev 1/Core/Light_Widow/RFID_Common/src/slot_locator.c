@@ -0,0 +1,217 @@
+/*  \file slot_locator.c
+ *  \author Colton Crandell
+ *  \brief  Estimates the filter stage of a newly inserted tag
+ *
+ *  A tag entering the matte box detunes the reader antenna differently depending on the stage it
+ *  sits in. The amplitude and phase are measured before Wake-Up mode is entered and again after the
+ *  reader woke up. The difference is matched against a per-unit table of stage centroids.
+ *  The table is recorded with the "calStage" CLI command and stored in the EEPROM.
+ *
+ *  Every wake-up prints "WAKEUP amp,phase" over CDC and every applied event prints
+ *  "SLOT amp,phase,calStage,estimate". Tools/slot_eval.py replays a captured log of these lines
+ *  through the same classifier.
+ */
+
+
+/* *****************************************************************************
+ * INCLUDES
+ * *****************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "slot_locator.h"
+#include "24aa64_eep.h"
+
+#include "st25r3916/st25r3916.h"
+
+
+/* *****************************************************************************
+ * LOCAL DEFINES
+ * *****************************************************************************/
+_Static_assert(sizeof(slotCalibration_t) <= EEPROM_SLOT_CAL_LEN, "slotCalibration_t outgrows the reserved EEPROM page");
+
+/* *****************************************************************************
+ * LOCAL VARIABLES
+ * *****************************************************************************/
+static slotCalibration_t slotCal;
+
+static uint8_t baseAmp;					/* Measurements taken before Wake-Up mode		*/
+static uint8_t basePhase;
+static bool baseValid = false;
+
+static bool eventPending = false;		/* A wake-up signature waits to be applied		*/
+static rfSignature_t eventSig;
+
+static uint8_t calStage = 0;			/* Stage armed for calibration, 0 = not armed	*/
+
+/*******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ *******************************************************************************/
+static filterTag_t* findSingleNewTag(detectedTags_t *dTags, filterSection_t *currentFilters);
+static void addCalibrationSample(uint8_t stage, const rfSignature_t *sig);
+
+/*******************************************************************************
+ * GLOBAL FUNCTIONS
+ *******************************************************************************/
+void slotLocatorInit(void) {
+	eepromRead(SLOT_CAL_EEPROM_ADDR, (uint8_t *) &slotCal, sizeof(slotCal));
+
+	if (slotCal.magic != SLOT_CAL_MAGIC) {
+		// Blank or foreign EEPROM content. Start without calibration.
+		memset(&slotCal, 0, sizeof(slotCal));
+		slotCal.magic = SLOT_CAL_MAGIC;
+	}
+}
+
+ReturnCode slotLocatorCaptureBaseline(void) {
+	ReturnCode err;
+
+	baseValid = false;
+
+	if ((err = st25r3916MeasureAmplitude(&baseAmp)) != ERR_NONE) return err;
+	if ((err = st25r3916MeasurePhase(&basePhase)) != ERR_NONE) return err;
+
+	baseValid = true;
+	return ERR_NONE;
+}
+
+ReturnCode slotLocatorCaptureEvent(rfSignature_t *sig) {
+	ReturnCode err;
+	uint8_t amp, phase;
+
+	eventPending = false;
+
+	if (!baseValid) return ERR_WRONG_STATE;
+
+	if ((err = st25r3916MeasureAmplitude(&amp)) != ERR_NONE) return err;
+	if ((err = st25r3916MeasurePhase(&phase)) != ERR_NONE) return err;
+
+	eventSig.ampDelta = (int16_t) amp - baseAmp;
+	eventSig.phaseDelta = (int16_t) phase - basePhase;
+	eventPending = true;
+	baseValid = false;
+
+	if (sig != NULL) {
+		*sig = eventSig;
+	}
+	return ERR_NONE;
+}
+
+// Nearest centroid lookup. Returns the stage (1..FILTER_SECTION_SIZE) or 0 when no stage is a clear match.
+uint8_t slotLocatorClassify(const rfSignature_t *sig) {
+	uint32_t bestDist = UINT32_MAX;
+	uint32_t nextDist = UINT32_MAX;
+	uint8_t bestStage = 0;
+
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
+		if (slotCal.stage[i].samples == 0) continue;
+
+		int32_t da = sig->ampDelta - slotCal.stage[i].ampDelta;
+		int32_t dp = sig->phaseDelta - slotCal.stage[i].phaseDelta;
+		uint32_t dist = (uint32_t) (da * da + dp * dp);
+
+		if (dist < bestDist) {
+			nextDist = bestDist;
+			bestDist = dist;
+			bestStage = i + 1;
+		} else if (dist < nextDist) {
+			nextDist = dist;
+		}
+	}
+
+	// Too far from every centroid, or the runner-up is almost as close
+	if (bestDist > SLOT_MATCH_MAX_DIST || (nextDist != UINT32_MAX && nextDist < 2 * bestDist)) {
+		return 0;
+	}
+	return bestStage;
+}
+
+// Stamp the stage estimate onto the tag inserted during the last wake-up event.
+// The estimate is only usable when exactly one new tag showed up. Returns true and fills [trace]
+// when the event was applied, so the caller can record it for offline evaluation (Tools/slot_eval.py).
+bool slotLocatorApply(detectedTags_t *dTags, filterSection_t *currentFilters, slotTrace_t *trace) {
+	filterTag_t *newTag;
+	uint8_t estimate;
+
+	if (!eventPending) return false;
+	eventPending = false;
+
+	newTag = findSingleNewTag(dTags, currentFilters);
+	if (newTag == NULL) return false;
+
+	// Classify before a calibration sample moves the centroid, the trace then scores the table as it was
+	estimate = slotLocatorClassify(&eventSig);
+
+	if (trace != NULL) {
+		trace->sig = eventSig;
+		trace->calStage = calStage;
+		trace->estimate = estimate;
+	}
+
+	if (calStage > 0) {
+		// Calibration run, the operator told us where the tag went
+		addCalibrationSample(calStage, &eventSig);
+		newTag->stage = calStage;
+		calStage = 0;
+		return true;
+	}
+
+	// A reader that covers a single stage already knows the answer
+	if (newTag->stage == 0) {
+		newTag->stage = estimate;
+	}
+	return true;
+}
+
+void slotLocatorCalibrate(uint8_t stage) {
+	if (stage > FILTER_SECTION_SIZE) return;
+	calStage = stage;
+}
+
+void slotLocatorClearCalibration(void) {
+	memset(&slotCal, 0, sizeof(slotCal));
+	slotCal.magic = SLOT_CAL_MAGIC;
+	eepromWrite(SLOT_CAL_EEPROM_ADDR, (uint8_t *) &slotCal, sizeof(slotCal));
+}
+
+/* *****************************************************************************
+ * LOCAL FUNCTIONS
+ * *****************************************************************************/
+static filterTag_t* findSingleNewTag(detectedTags_t *dTags, filterSection_t *currentFilters) {
+	filterTag_t *newTag = NULL;
+	uint8_t tempZero[ISO15693_UID_LENGTH] = {0};
+
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
+		bool known = false;
+
+		if (memcmp(dTags->filterTags[i].tagUID, tempZero, ISO15693_UID_LENGTH) == 0) continue;
+
+		for (uint8_t j = 0; j < FILTER_SECTION_SIZE; j++) {
+			if (memcmp(dTags->filterTags[i].tagUID, currentFilters->filter[j].filterTagUID, ISO15693_UID_LENGTH) == 0) {
+				known = true;
+				break;
+			}
+		}
+
+		if (!known) {
+			if (newTag != NULL) return NULL;	// More than one new tag, the signature is a mix
+			newTag = &dTags->filterTags[i];
+		}
+	}
+	return newTag;
+}
+
+static void addCalibrationSample(uint8_t stage, const rfSignature_t *sig) {
+	slotCentroid_t *c = &slotCal.stage[stage - 1];
+
+	if (c->samples < SLOT_CAL_MAX_SAMPLES) {
+		c->samples++;
+	}
+
+	// Running mean. Capping the weight keeps the centroid following slow drift of the antenna.
+	c->ampDelta += (sig->ampDelta - c->ampDelta) / (int16_t) c->samples;
+	c->phaseDelta += (sig->phaseDelta - c->phaseDelta) / (int16_t) c->samples;
+
+	eepromWrite(SLOT_CAL_EEPROM_ADDR, (uint8_t *) &slotCal, sizeof(slotCal));
+}
@@ -42,6 +42,10 @@
 #include "st_errno.h"
 #include "string.h"
 
+#if PLATFORM_SPI_TRACE
+#include "st25r3916/st25r3916_irq.h"
+#endif
+
 #define SPI_TIMEOUT   1000
 #define SPI_BUF_LEN   512
 
@@ -51,6 +55,22 @@ static uint8_t   rxBuf[SPI_BUF_LEN];
 
 SPI_HandleTypeDef *pSpi = 0;
 
+#if PLATFORM_SPI_TRACE
+static spiTraceMode_t         traceMode = SPI_TRACE_OFF;
+static uint8_t                traceBuf[SPI_TRACE_BUF_LEN];
+static uint16_t               traceLen;         /* Valid bytes in traceBuf       */
+static uint16_t               traceCount;       /* Transactions in traceBuf      */
+static spiTraceStats_t        traceStats;
+
+static uint16_t               replayPos;        /* Offset of the next transaction to replay */
+static uint16_t               replayDone;       /* Transactions replayed          */
+static bool                   replayInIsr;
+
+static HAL_StatusTypeDef spiTraceReplayTxRx(const uint8_t *txData, uint8_t *rxData, uint16_t length);
+static void spiTraceStore(const uint8_t *txData, const uint8_t *rxData, uint16_t length, uint32_t cycStart, uint32_t cycles);
+static bool spiTraceNextIsIsr(void);
+#endif /* PLATFORM_SPI_TRACE */
+
 
 void spiInit(SPI_HandleTypeDef *hspi)
 {
@@ -90,7 +110,211 @@ HAL_StatusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint16_t lengt
     memset(txBuf, 0x00, length );
   }
 
+#if PLATFORM_SPI_TRACE
+  if(traceMode == SPI_TRACE_REPLAY)
+  {
+    return spiTraceReplayTxRx(txBuf, rxData, length);
+  }
+
+  if(traceMode == SPI_TRACE_RECORD)
+  {
+    HAL_StatusTypeDef ret;
+    uint32_t cycStart = DWT->CYCCNT;
+
+    ret = HAL_SPI_TransmitReceive(pSpi, txBuf, (rxData != NULL) ? rxData : rxBuf, length, SPI_TIMEOUT);
+    spiTraceStore(txBuf, (rxData != NULL) ? rxData : rxBuf, length, cycStart, DWT->CYCCNT - cycStart);
+    return ret;
+  }
+#endif /* PLATFORM_SPI_TRACE */
+
   return HAL_SPI_TransmitReceive(pSpi, txBuf, (rxData != NULL) ? rxData : rxBuf, length, SPI_TIMEOUT);
 }
 
+#if PLATFORM_SPI_TRACE
+void spiTraceRecord(void)
+{
+  traceLen   = 0;
+  traceCount = 0;
+  memset(&traceStats, 0, sizeof(traceStats));
+  traceMode  = SPI_TRACE_RECORD;
+}
+
+bool spiTraceLoad(uint16_t offset, const uint8_t *data, uint16_t len)
+{
+  if(offset == 0U)
+  {
+    traceMode  = SPI_TRACE_OFF;
+    traceLen   = 0;
+    traceCount = 0;
+  }
+
+  if((offset != traceLen) || (len > (SPI_TRACE_BUF_LEN - traceLen)))
+  {
+    return false;
+  }
+
+  memcpy(&traceBuf[traceLen], data, len);
+  traceLen += len;
+  return true;
+}
+
+void spiTraceReplay(void)
+{
+  spiTraceHeader_t h;
+  uint16_t         pos = 0;
+
+  /* A loaded trace only carries bytes, count the complete transactions in it */
+  traceCount = 0;
+  while((pos + sizeof(h)) <= traceLen)
+  {
+    memcpy(&h, &traceBuf[pos], sizeof(h));
+    if((pos + sizeof(h) + (2U * h.length)) > traceLen)
+    {
+      break;
+    }
+    pos += sizeof(h) + (2U * h.length);
+    traceCount++;
+  }
+  traceLen = pos;
+
+  replayPos   = 0;
+  replayDone  = 0;
+  replayInIsr = false;
+  memset(&traceStats, 0, sizeof(traceStats));
+  traceMode   = SPI_TRACE_REPLAY;
+}
+
+void spiTraceStop(void)
+{
+  traceMode = SPI_TRACE_OFF;
+}
+
+spiTraceMode_t spiTraceGetMode(void)
+{
+  return traceMode;
+}
+
+uint16_t spiTraceCount(void)
+{
+  return traceCount;
+}
+
+uint16_t spiTraceReplayed(void)
+{
+  return replayDone;
+}
+
+const uint8_t* spiTraceData(uint16_t *len)
+{
+  *len = traceLen;
+  return traceBuf;
+}
+
+const spiTraceStats_t* spiTraceGetStats(void)
+{
+  return &traceStats;
+}
+
+static void spiTraceStore(const uint8_t *txData, const uint8_t *rxData, uint16_t length, uint32_t cycStart, uint32_t cycles)
+{
+  spiTraceHeader_t h;
+
+  traceStats.transactions++;
+  traceStats.bytes  += length;
+  traceStats.cycles += cycles;
+
+  /* A partial trace still replays up to the first missing transfer, keep the start */
+  if((sizeof(h) + (2U * length)) > (SPI_TRACE_BUF_LEN - traceLen))
+  {
+    traceStats.dropped++;
+    return;
+  }
+
+  h.cycStart = cycStart;
+  h.cycles   = cycles;
+  h.length   = length;
+  h.reader   = platformActiveReader;
+  h.fromIsr  = (__get_IPSR() != 0U) ? 1U : 0U;
+
+  memcpy(&traceBuf[traceLen], &h, sizeof(h));
+  traceLen += sizeof(h);
+  memcpy(&traceBuf[traceLen], txData, length);
+  traceLen += length;
+  memcpy(&traceBuf[traceLen], rxData, length);
+  traceLen += length;
+  traceCount++;
+}
+
+static bool spiTraceNextIsIsr(void)
+{
+  spiTraceHeader_t h;
+
+  if((replayPos + sizeof(h)) > traceLen)
+  {
+    return false;
+  }
+  memcpy(&h, &traceBuf[replayPos], sizeof(h));
+  return (h.fromIsr != 0U);
+}
+
+static HAL_StatusTypeDef spiTraceReplayTxRx(const uint8_t *txData, uint8_t *rxData, uint16_t length)
+{
+  spiTraceHeader_t h;
+  const uint8_t   *tx;
+  const uint8_t   *rx;
+  uint16_t         n;
+  uint32_t         cycStart = DWT->CYCCNT;
+
+  if((replayPos + sizeof(h)) > traceLen)
+  {
+    /* Code under test issued more transfers than were recorded. Stop replaying and let this
+     * and every following transfer go out on the bus, the exhausted counter reports it. */
+    traceMode = SPI_TRACE_OFF;
+    traceStats.exhausted++;
+    return HAL_SPI_TransmitReceive(pSpi, (uint8_t *)txData, (rxData != NULL) ? rxData : rxBuf, length, SPI_TIMEOUT);
+  }
+
+  memcpy(&h, &traceBuf[replayPos], sizeof(h));
+  tx = &traceBuf[replayPos + sizeof(h)];
+  rx = tx + h.length;
+  replayPos += sizeof(h) + (2U * h.length);
+  replayDone++;
+  n = (h.length < length) ? h.length : length;
+
+  if((h.length != length) || (memcmp(tx, txData, n) != 0))
+  {
+    traceStats.mismatches++;
+  }
+
+  if(rxData != NULL)
+  {
+    memset(rxData, 0x00, length);
+    memcpy(rxData, rx, n);
+  }
+
+  traceStats.transactions++;
+  traceStats.bytes  += length;
+  traceStats.cycles += DWT->CYCCNT - cycStart;
+
+  /* The IRQ fired after this transfer on the recording, raise it at the same point */
+  if(!replayInIsr && spiTraceNextIsIsr())
+  {
+    replayInIsr = true;
+    st25r3916Isr();
+    replayInIsr = false;
+  }
+  return HAL_OK;
+}
+
+bool spiTraceGpioIsHigh(GPIO_TypeDef *port, uint16_t pin)
+{
+  if((traceMode == SPI_TRACE_REPLAY) && (port == ST25R391X_INT_PORT) && (pin == ST25R391X_INT_PIN))
+  {
+    return spiTraceNextIsIsr();
+  }
+
+  return (HAL_GPIO_ReadPin(port, pin) == GPIO_PIN_SET);
+}
+#endif /* PLATFORM_SPI_TRACE */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
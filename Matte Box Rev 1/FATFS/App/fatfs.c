@@ -64,6 +64,7 @@ SD_error FatFsInit(void) {
 			 res = f_mkfs(SDPath, FM_ANY, 0, workBuffer, sizeof(workBuffer));
 			 if (res != FR_OK) {
 				 /* Error, failed to initialize filesystem */
+				 FATFS_UnLinkDriver(SDPath);
 				 return SD_ERR;
 			 }
 		 }
@@ -75,6 +76,20 @@ SD_error FatFsInit(void) {
 	return SD_OK;
 }
 
+// Mount without the f_mkfs fallback, for a card that was powered down between writes.
+// A card that fails to mount keeps its content.
+SD_error FatFsMount(void) {
+	if (FATFS_LinkDriver(&SD_Driver, SDPath) != 0) {
+		return SD_ERR;
+	}
+	if (f_mount(&SDFatFS, (TCHAR const*)SDPath, 1) != FR_OK) {
+		FATFS_UnLinkDriver(SDPath);
+		return SD_ERR;
+	}
+	fatFsModInit = true;
+	return SD_OK;
+}
+
 SD_error FatFsDeInit(void) {
 	fatFsModInit = false;
 	return FATFS_UnLinkDriver(SDPath);
@@ -46,6 +46,7 @@ void MX_FATFS_Init(void);
 
 /* USER CODE BEGIN Prototypes */
 SD_error FatFsInit(void);
+SD_error FatFsMount(void);
 SD_error FatFsDeInit(void);
 SD_error FatFsReMake(void);
 bool FatFsIsModuleInit(void) ;
@@ -18,10 +18,12 @@
   */
 /* USER CODE END Header */
 
-/* Note: code generation based on sd_diskio_template.c v2.1.1 as "Use dma template" is disabled. */
+/* Note: code generation based on sd_diskio_dma_template_bspv1.c v2.1.4
+   as "Use dma template" is enabled. */
 
 /* USER CODE BEGIN firstSection */
 /* can be used to modify / undefine following code or add new definitions */
+#include <string.h>
 /* USER CODE END firstSection*/
 
 /* Includes ------------------------------------------------------------------*/
@@ -31,14 +33,12 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
-/* use the default SD timout as defined in the platform BSP driver*/
-#if defined(SDMMC_DATATIMEOUT)
-#define SD_TIMEOUT SDMMC_DATATIMEOUT
-#elif defined(SD_DATATIMEOUT)
-#define SD_TIMEOUT SD_DATATIMEOUT
-#else
+
+/*
+ * the following Timeout is useful to give the control back to the applications
+ * in case of errors in either BSP_SD_ReadCpltCallback() or BSP_SD_WriteCpltCallback()
+ */
 #define SD_TIMEOUT 30 * 1000
-#endif
 
 #define SD_DEFAULT_BLOCK_SIZE 512
 
@@ -52,9 +52,36 @@
 /* #define DISABLE_SD_INIT */
 /* USER CODE END disableSDInit */
 
+/*
+ * when using cachable memory region, it may be needed to maintain the cache
+ * validity. Enable the define below to activate a cache maintenance at each
+ * read and write operation.
+ * Notice: This is applicable only for cortex M7 based platform.
+ */
+/* USER CODE BEGIN enableSDDmaCacheMaintenance */
+/* #define ENABLE_SD_DMA_CACHE_MAINTENANCE  1 */
+/* USER CODE END enableSDDmaCacheMaintenance */
+
+/*
+* Some DMA requires 4-Byte aligned address buffer to correctly read/write data,
+* in FatFs some accesses aren't thus we need a 4-byte aligned scratch buffer to correctly
+* transfer data
+*/
+/* USER CODE BEGIN enableScratchBuffer */
+#define ENABLE_SCRATCH_BUFFER
+/* USER CODE END enableScratchBuffer */
+
+/* Private variables ---------------------------------------------------------*/
+#if defined(ENABLE_SCRATCH_BUFFER)
+__ALIGN_BEGIN static uint8_t scratch[BLOCKSIZE] __ALIGN_END;
+#endif
+
 /* Disk status */
 static volatile DSTATUS Stat = STA_NOINIT;
 
+/* Transfer status, 0 = in flight, 1 = done, 2 = failed */
+static volatile UINT WriteStatus = 0, ReadStatus = 0;
+
 /* Private function prototypes -----------------------------------------------*/
 static DSTATUS SD_CheckStatus(BYTE lun);
 DSTATUS SD_initialize (BYTE);
@@ -83,10 +110,60 @@ const Diskio_drvTypeDef  SD_Driver =
 
 /* USER CODE BEGIN beforeFunctionSection */
 /* can be used to modify / undefine following code or add new code */
+static SD_stats sdStats;
+
+/*
+ * Runs in the wait loops of the driver while the DMA or the card is busy.
+ * The application can step work here that doesn't touch the card.
+ */
+__weak void SD_WaitCallback(void)
+{
+}
+
+void SD_GetStats(SD_stats *stats)
+{
+  *stats = sdStats;
+}
+
+/* Wait for a completion callback, 0 once the transfer is done */
+static int SD_WaitStatus(volatile UINT *status, uint32_t timeout)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t timer = HAL_GetTick();
+
+  while ((*status == 0) && (HAL_GetTick() - timer < timeout))
+  {
+    SD_WaitCallback();
+  }
+  sdStats.waitCycles += DWT->CYCCNT - start;
+
+  return (*status == 1) ? 0 : -1;
+}
 /* USER CODE END beforeFunctionSection */
 
 /* Private functions ---------------------------------------------------------*/
 
+static int SD_CheckStatusWithTimeout(uint32_t timeout)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t timer = HAL_GetTick();
+  int res = -1;
+
+  /* block until SDIO IP is ready again or a timeout occur */
+  while (HAL_GetTick() - timer < timeout)
+  {
+    if (BSP_SD_GetCardState() == SD_TRANSFER_OK)
+    {
+      res = 0;
+      break;
+    }
+    SD_WaitCallback();
+  }
+  sdStats.waitCycles += DWT->CYCCNT - start;
+
+  return res;
+}
+
 static DSTATUS SD_CheckStatus(BYTE lun)
 {
   Stat = STA_NOINIT;
@@ -133,6 +210,31 @@ DSTATUS SD_status(BYTE lun)
 
 /* USER CODE BEGIN beforeReadSection */
 /* can be used to modify previous code / undefine following code / add new code */
+
+/* One DMA read into a word aligned buffer */
+static DRESULT SD_ReadDMA(uint32_t *buff, DWORD sector, UINT count)
+{
+  /* ensure the SD card is ready for a new operation */
+  if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
+  {
+    return RES_ERROR;
+  }
+
+  ReadStatus = 0;
+  if (BSP_SD_ReadBlocks_DMA(buff, (uint32_t) (sector), count) != MSD_OK)
+  {
+    return RES_ERROR;
+  }
+
+  /* Wait that the reading process is completed or a timeout occurs */
+  if (SD_WaitStatus(&ReadStatus, SD_TIMEOUT) < 0)
+  {
+    return RES_ERROR;
+  }
+
+  /* FatFs takes a card that isn't back in transfer state for uninitialized */
+  return (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0) ? RES_ERROR : RES_OK;
+}
 /* USER CODE END beforeReadSection */
 /**
   * @brief  Reads Sector(s)
@@ -146,23 +248,67 @@ DSTATUS SD_status(BYTE lun)
 DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 {
   DRESULT res = RES_ERROR;
+  uint32_t start = DWT->CYCCNT;
 
-  if(BSP_SD_ReadBlocks((uint32_t*)buff,
-                       (uint32_t) (sector),
-                       count, SD_TIMEOUT) == MSD_OK)
+#if defined(ENABLE_SCRATCH_BUFFER)
+  if ((uint32_t)buff & 0x3)
   {
-    /* wait until the read operation is finished */
-    while(BSP_SD_GetCardState()!= MSD_OK)
+    /* Slow path, fetch each sector a part and memcpy to destination buffer */
+    res = RES_OK;
+    for (UINT i = 0; (i < count) && (res == RES_OK); i++)
     {
+      res = SD_ReadDMA((uint32_t*)scratch, sector + i, 1);
+      memcpy(buff, scratch, BLOCKSIZE);
+      buff += BLOCKSIZE;
     }
-    res = RES_OK;
+    sdStats.scratch += count;
+  }
+  else
+#endif
+  {
+    res = SD_ReadDMA((uint32_t*)buff, sector, count);
   }
 
+  sdStats.reads++;
+  sdStats.sectors += count;
+  if (res != RES_OK)
+  {
+    sdStats.errors++;
+  }
+  sdStats.cycles += DWT->CYCCNT - start;
+
   return res;
 }
 
 /* USER CODE BEGIN beforeWriteSection */
 /* can be used to modify previous code / undefine following code / add new code */
+
+/*
+ * One DMA write from a word aligned buffer. The transfer and the programming of the
+ * card take most of the time, both are spent in SD_WaitCallback.
+ */
+static DRESULT SD_WriteDMA(uint32_t *buff, DWORD sector, UINT count)
+{
+  if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
+  {
+    return RES_ERROR;
+  }
+
+  WriteStatus = 0;
+  if (BSP_SD_WriteBlocks_DMA(buff, (uint32_t) (sector), count) != MSD_OK)
+  {
+    return RES_ERROR;
+  }
+
+  /* Wait that the writing process is completed or a timeout occurs */
+  if (SD_WaitStatus(&WriteStatus, SD_TIMEOUT) < 0)
+  {
+    return RES_ERROR;
+  }
+
+  /* The card is busy until the sectors are programmed */
+  return (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0) ? RES_ERROR : RES_OK;
+}
 /* USER CODE END beforeWriteSection */
 /**
   * @brief  Writes Sector(s)
@@ -177,17 +323,34 @@ DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 DRESULT SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
 {
   DRESULT res = RES_ERROR;
+  uint32_t start = DWT->CYCCNT;
 
-  if(BSP_SD_WriteBlocks((uint32_t*)buff,
-                        (uint32_t)(sector),
-                        count, SD_TIMEOUT) == MSD_OK)
+#if defined(ENABLE_SCRATCH_BUFFER)
+  if ((uint32_t)buff & 0x3)
   {
-	/* wait until the Write operation is finished */
-    while(BSP_SD_GetCardState() != MSD_OK)
+    /* Slow path, memcpy each sector to the scratch buffer and write it a part */
+    res = RES_OK;
+    for (UINT i = 0; (i < count) && (res == RES_OK); i++)
     {
+      memcpy(scratch, buff, BLOCKSIZE);
+      res = SD_WriteDMA((uint32_t*)scratch, sector + i, 1);
+      buff += BLOCKSIZE;
     }
-    res = RES_OK;
+    sdStats.scratch += count;
+  }
+  else
+#endif
+  {
+    res = SD_WriteDMA((uint32_t*)buff, sector, count);
+  }
+
+  sdStats.writes++;
+  sdStats.sectors += count;
+  if (res != RES_OK)
+  {
+    sdStats.errors++;
   }
+  sdStats.cycles += DWT->CYCCNT - start;
 
   return res;
 }
@@ -251,8 +414,44 @@ DRESULT SD_ioctl(BYTE lun, BYTE cmd, void *buff)
 /* can be used to modify previous code / undefine following code / add new code */
 /* USER CODE END afterIoctlSection */
 
+/* USER CODE BEGIN callbackSection */
+/* can be used to modify / following code or add new code */
+/* USER CODE END callbackSection */
+/**
+  * @brief Tx Transfer completed callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void BSP_SD_WriteCpltCallback(void)
+{
+  WriteStatus = 1;
+}
+
+/**
+  * @brief Rx Transfer completed callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void BSP_SD_ReadCpltCallback(void)
+{
+  ReadStatus = 1;
+}
+
 /* USER CODE BEGIN lastSection */ 
 /* can be used to modify / undefine previous code or add new code */
+
+/* DMA or data path errors end the transfer, the wait loops don't have to run into their timeout */
+void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd)
+{
+  if (WriteStatus == 0)
+  {
+    WriteStatus = 2;
+  }
+  if (ReadStatus == 0)
+  {
+    ReadStatus = 2;
+  }
+}
 /* USER CODE END lastSection */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
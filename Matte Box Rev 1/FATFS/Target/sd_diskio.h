@@ -37,6 +37,20 @@ extern const Diskio_drvTypeDef  SD_Driver;
 
 /* USER CODE BEGIN lastSection */ 
 /* can be used to modify / undefine previous code or add new definitions */
+typedef struct {
+  uint32_t reads;         /* SD_read calls                                              */
+  uint32_t writes;        /* SD_write calls                                             */
+  uint32_t sectors;       /* Sectors read and written                                   */
+  uint32_t scratch;       /* Sectors copied through the scratch buffer, unaligned data  */
+  uint32_t errors;        /* Failed or timed out transfers                              */
+  uint32_t cycles;        /* DWT cycles spent in SD_read and SD_write                   */
+  uint32_t waitCycles;    /* Part of them waiting on the DMA and the card               */
+} SD_stats;
+
+void SD_GetStats(SD_stats *stats);
+
+/* Called while a transfer is in flight, override to step work that doesn't use the card */
+void SD_WaitCallback(void);
 /* USER CODE END lastSection */
 
 #endif /* __SD_DISKIO_H */
@@ -715,6 +715,23 @@ void rfalSetPostTxRxCallback( rfalPostTxRxCallback pFunc );
 ReturnCode rfalDeinitialize( void );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL Switch Instance
+ *  
+ * Parks the RFAL and ST25R391x driver state of front-end \a from and loads
+ * the state of front-end \a to. Must be called with the RFAL idle (no
+ * ongoing Transceive, Wake-Up or Listen mode) whenever the platform moves
+ * the SPI chip select and IRQ line to another front-end.
+ *
+ * \param[in]  from : index of the front-end currently addressed
+ * \param[in]  to   : index of the front-end to address next
+ * 
+ *****************************************************************************
+ */
+void rfalSwitchInstance( uint8_t from, uint8_t to );
+
+
 /*! 
  *****************************************************************************
  * \brief  RFAL Set Mode
@@ -54,6 +54,10 @@
     #define RFAL_FEATURE_NFCV   false    /* NFC-V module configuration missing. Disabled by default */
 #endif
 
+#ifndef RFAL_FEATURE_NFCV_PHY_TABLE
+    #define RFAL_FEATURE_NFCV_PHY_TABLE   false    /* Table driven PHY coding configuration missing. Bitwise coding by default */
+#endif
+
 #if RFAL_FEATURE_NFCV
 
 /*
@@ -96,6 +100,36 @@
 */
 static iso15693PhyConfig_t iso15693PhyConfig; /*!< current phy configuration */
 
+#if RFAL_FEATURE_NFCV_PHY_TABLE
+/*! 1 of 4 pulse position of each 2 bit symbol. 4 bytes of flash */
+static const uint8_t iso15693Code1Of4Table[4] =
+{
+    ISO15693_DAT_00_1_4, ISO15693_DAT_01_1_4, ISO15693_DAT_10_1_4, ISO15693_DAT_11_1_4
+};
+
+/*! Four manchester pairs (LSB first) to their four data bits, 0xFF when a pair is
+ *  not a clean 01/10 (collision, EOF). 256 bytes of flash */
+static const uint8_t iso15693ManchesterTable[256] =
+{
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x01U, 0xFFU, 0xFFU, 0x02U, 0x03U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x04U, 0x05U, 0xFFU, 0xFFU, 0x06U, 0x07U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x08U, 0x09U, 0xFFU, 0xFFU, 0x0AU, 0x0BU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x0CU, 0x0DU, 0xFFU, 0xFFU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+#endif /* RFAL_FEATURE_NFCV_PHY_TABLE */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
@@ -329,6 +363,36 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
         bool isEOF = false;
         
         uint8_t man;
+
+#if RFAL_FEATURE_NFCV_PHY_TABLE
+        /* Decode four clean pairs at once. With bp a multiple of 4 the nibble stays within one
+           output byte and an EOF can only start after the last of the four pairs.
+           Anything else takes the bitwise path */
+        if ( ((bp & 3U) == 0U) && ((mp + 8U) < (inBufLen * 8U)) && ((bp + 4U) <= (outBufLen * 8U)) )
+        {
+            uint8_t nibble = iso15693ManchesterTable[(uint8_t)((inBuf[mp/8U] | ((uint16_t)inBuf[(mp/8U)+1U] << 8)) >> (mp%8U))];
+
+            if (nibble != 0xFFU)
+            {
+                outBuf[bp/8U] = (uint8_t)(outBuf[bp/8U] | (nibble << (bp%8U)));
+                bp += 4U;
+                mp += 6U;   /* Last pair of the four, the loop adds the final 2 */
+
+                if ( ((bp%8U) == 0U) && ((inBuf[mp/8U] & 0xe0U) == 0xa0U) && (inBuf[(mp/8U)+1U] == 0x03U) )
+                {
+                    ISO_15693_DEBUG("EOF\n");
+                    break;
+                }
+                if (bp >= (outBufLen * 8U))
+                {
+                    break;
+                }
+                continue;
+            }
+        }
+#endif /* RFAL_FEATURE_NFCV_PHY_TABLE */
+
+
         man  = (inBuf[mp/8U] >> (mp%8U)) & 0x1U;
         man |= ((inBuf[(mp+1U)/8U] >> ((mp+1U)%8U)) & 0x1U) << 1;
         if (1U == man)
@@ -434,10 +498,12 @@ ReturnCode iso15693VICCDecode(const uint8_t *inBuf,
  */
 static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuffer, uint16_t maxOutBufLen, uint16_t* outBufLen)
 {
-    uint8_t tmp;
     ReturnCode err = ERR_NONE;
+#if !RFAL_FEATURE_NFCV_PHY_TABLE
+    uint8_t tmp;
     uint16_t a;
     uint8_t* outbuf = outbuffer;
+#endif /* !RFAL_FEATURE_NFCV_PHY_TABLE */
 
     *outBufLen = 0;
 
@@ -445,6 +511,13 @@ static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuffer,
         return ERR_NOMEM;
     }
 
+#if RFAL_FEATURE_NFCV_PHY_TABLE
+    outbuffer[0] = iso15693Code1Of4Table[data & 0x3U];
+    outbuffer[1] = iso15693Code1Of4Table[(data >> 2) & 0x3U];
+    outbuffer[2] = iso15693Code1Of4Table[(data >> 4) & 0x3U];
+    outbuffer[3] = iso15693Code1Of4Table[(data >> 6) & 0x3U];
+    *outBufLen = 4U;
+#else
     tmp = data;
     for (a = 0; a < 4U; a++)
     {
@@ -470,6 +543,7 @@ static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuffer,
         (*outBufLen)++;
         tmp >>= 2;
     }
+#endif /* RFAL_FEATURE_NFCV_PHY_TABLE */
     return err;
 }
 
@@ -390,6 +390,10 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Both members are of the same type
 
 static rfal gRFAL;              /*!< RFAL module instance               */
 
+#if ST25R391X_READER_COUNT > 1
+static rfal gRFALInst[ST25R391X_READER_COUNT]; /*!< Parked RFAL instance of every front-end */
+#endif /* ST25R391X_READER_COUNT > 1 */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
@@ -573,6 +577,26 @@ ReturnCode rfalDeinitialize( void )
 }
 
 
+/*******************************************************************************/
+void rfalSwitchInstance( uint8_t from, uint8_t to )
+{
+#if ST25R391X_READER_COUNT > 1
+    if( (from == to) || (from >= ST25R391X_READER_COUNT) || (to >= ST25R391X_READER_COUNT) )
+    {
+        return;
+    }
+    
+    gRFALInst[from] = gRFAL;
+    gRFAL           = gRFALInst[to];
+    
+    st25r3916SwitchInstance( from, to );
+#else
+    NO_WARNING(from);
+    NO_WARNING(to);
+#endif /* ST25R391X_READER_COUNT > 1 */
+}
+
+
 /*******************************************************************************/
 void rfalSetObsvMode( uint8_t txMode, uint8_t rxMode )
 {
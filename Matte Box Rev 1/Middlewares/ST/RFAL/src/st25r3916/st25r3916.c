@@ -83,6 +83,10 @@
 
 static uint32_t gST25R3916NRT_64fcs;
 
+#if ST25R391X_READER_COUNT > 1
+static uint32_t gST25R3916NRTInst[ST25R391X_READER_COUNT]; /*!< Parked NRT of every front-end */
+#endif /* ST25R391X_READER_COUNT > 1 */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
@@ -184,6 +188,21 @@ void st25r3916Deinitialize( void )
 }
 
 
+/*******************************************************************************/
+void st25r3916SwitchInstance( uint8_t from, uint8_t to )
+{
+#if ST25R391X_READER_COUNT > 1
+    gST25R3916NRTInst[from] = gST25R3916NRT_64fcs;
+    gST25R3916NRT_64fcs     = gST25R3916NRTInst[to];
+    
+    st25r3916SwitchInterruptInstance( from, to );
+#else
+    NO_WARNING(from);
+    NO_WARNING(to);
+#endif /* ST25R391X_READER_COUNT > 1 */
+}
+
+
 /*******************************************************************************/
 void st25r3916OscOn( void )
 {
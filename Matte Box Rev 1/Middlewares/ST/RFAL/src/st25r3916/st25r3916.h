@@ -201,6 +201,20 @@ ReturnCode st25r3916Initialize( void );
  */
 void st25r3916Deinitialize( void );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Switch ST25R3916 driver instance
+ *
+ *  Parks the driver state (NRT, interrupt status and mask) of front-end
+ *  \a from and loads the state of front-end \a to.
+ *
+ *  \param[in] from: index of the front-end currently addressed
+ *  \param[in] to:   index of the front-end to address next
+ *
+ *****************************************************************************
+ */
+void st25r3916SwitchInstance( uint8_t from, uint8_t to );
+
 /*! 
  *****************************************************************************
  *  \brief  Turn on Oscillator and Regulator
@@ -82,6 +82,10 @@ typedef struct
 
 static volatile st25r3916Interrupt   st25r3916interrupt; /*!< Instance of ST25R3916 interrupt */
 
+#if ST25R391X_READER_COUNT > 1
+static st25r3916Interrupt   st25r3916interruptInst[ST25R391X_READER_COUNT]; /*!< Parked interrupt instance of every front-end */
+#endif /* ST25R391X_READER_COUNT > 1 */
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -232,6 +236,21 @@ void st25r3916DisableInterrupts(uint32_t mask)
     st25r3916ModifyInterrupts(0, mask);
 }
 
+/*******************************************************************************/
+void st25r3916SwitchInterruptInstance( uint8_t from, uint8_t to )
+{
+#if ST25R391X_READER_COUNT > 1
+    /* The ISR of the front-end being parked must not update the status mid-copy */
+    platformProtectST25R391xIrqStatus();
+    st25r3916interruptInst[from] = *((st25r3916Interrupt*)&st25r3916interrupt);
+    *((st25r3916Interrupt*)&st25r3916interrupt) = st25r3916interruptInst[to];
+    platformUnprotectST25R391xIrqStatus();
+#else
+    NO_WARNING(from);
+    NO_WARNING(to);
+#endif /* ST25R391X_READER_COUNT > 1 */
+}
+
 /*******************************************************************************/
 void st25r3916ClearInterrupts( void )
 {
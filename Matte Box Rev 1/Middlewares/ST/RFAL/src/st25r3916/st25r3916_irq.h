@@ -226,6 +226,17 @@ void st25r3916DisableInterrupts( uint32_t mask );
  */
 void st25r3916ClearInterrupts( void );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Switch the ST25R3916 interrupt instance
+ *
+ *  Parks the interrupt status, mask and callbacks of front-end \a from
+ *  and loads the ones of front-end \a to.
+ *
+ *****************************************************************************
+ */
+void st25r3916SwitchInterruptInstance( uint8_t from, uint8_t to );
+
 /*! 
  *****************************************************************************
  *  \brief  Clears and then enables the given ST25R3916 Interrupt sources
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Font and image bytes the linker keeps, with and without FONT_ASSET_PACK.
+
+    python3 asset_sizes.py <binary, FONT_ASSET_PACK 0> <binary, FONT_ASSET_PACK 1>
+
+The binaries are the display code linked with --gc-sections (make sizes). The data
+symbols of the font sources, fonts_rotated.c and assets_packed.c are summed per
+kind from nm. The sFONT structs hold pointers and are 8 bytes larger than on the
+Cortex-M4, the tables are byte arrays of the same size there. Tools/asset_pack.py
+--check prints the saving it expects from the table sizes alone.
+"""
+
+import os
+import re
+import subprocess
+import sys
+
+ASSET_FILES = re.compile(r"/EPD/src/(font\d+|fonts_rotated|assets_packed)\.c:")
+KINDS = (
+    ("ST tables", re.compile(r"Font\d+_Table$")),
+    ("rotated", re.compile(r"Font\d+_Rotated$")),
+    ("packed glyphs", re.compile(r"Font\d+_(Data|Index)$")),
+    ("packed images", re.compile(r"Image_\w+$")),
+    ("sFONT", re.compile(r"Font\d+(_Packed)?$")),
+)
+
+
+def data_symbols(binary):
+    """{name: size} of the data symbols defined in the asset sources"""
+    out = subprocess.run(["nm", "-S", "-l", "--defined-only", binary], check=True,
+                         capture_output=True, text=True).stdout
+    symbols = {}
+    for line in out.splitlines():
+        fields, _, where = line.partition("\t")
+        fields = fields.split()
+        if len(fields) == 4 and fields[2] in "rRdD" and ASSET_FILES.search(where):
+            symbols[fields[3]] = int(fields[1], 16)
+    return symbols
+
+
+def totals(symbols):
+    sums = {kind: 0 for kind, _ in KINDS}
+    for name, size in symbols.items():
+        for kind, pattern in KINDS:
+            if pattern.match(name):
+                sums[kind] += size
+                break
+        else:
+            sums.setdefault("other", 0)
+            sums["other"] += size
+    return sums
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    sums = [totals(data_symbols(b)) for b in sys.argv[1:3]]
+    kinds = [kind for kind, _ in KINDS] + (["other"] if any("other" in s for s in sums) else [])
+
+    print("%-14s %8s %8s" % ("linked", "pack 0", "pack 1"))
+    for kind in kinds:
+        print("%-14s %8d %8d" % (kind, sums[0].get(kind, 0), sums[1].get(kind, 0)))
+    total = [sum(s.values()) for s in sums]
+    print("%-14s %8d %8d" % ("total", total[0], total[1]))
+    print("FONT_ASSET_PACK 1 links %d B less font and image data (%s)"
+          % (total[0] - total[1], ", ".join(os.path.basename(b) for b in sys.argv[1:3])))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,244 @@
+/*
+ * epd_test.c
+ *
+ * SPI traffic of the G2 driver for one panel (MATTE_BOX_EPD_SIZE), the frames come
+ * from a gfx_test dump directory:
+ *   - the line buffers of the first frame of every stage are written in the format of
+ *     Tools/epd_frame.py --stream, make check compares them with the script output
+ *   - a digest of every update (bytes, transfers, CRC of all bytes sent, frames, times)
+ *     is held against golden/<panel>/epd.txt
+ *   - EPD_estimate has to be within EPD_MODEL_TOLERANCE of the simulated time and byte count
+ *   - a partial update of identical images must not send anything or power the COG up
+ *
+ *     epd_test <frame dir> <out dir>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hal_stub.h"
+#include "epd_g2.h"
+#include "lm75b.h"
+
+#define FRAME_SIZE				(EPD_MAX_DOTS / 8 * EPD_MAX_LINES)
+#define EPD_MODEL_TOLERANCE		2		/* % of the simulated update time	*/
+
+static const char* const stageNames[] = {"EPD_compensate", "EPD_white", "EPD_inverse", "EPD_normal"};
+static const char* const updateNames[] = {"none", "clear", "image_0", "image", "partial"};
+
+static SPI_HandleTypeDef hspi2;
+static DMA_HandleTypeDef hdma;
+static EPD_HandleTypeDef epd1;
+
+static uint8_t white[FRAME_SIZE];
+static uint8_t filters[FRAME_SIZE];
+static uint8_t highlight[FRAME_SIZE];
+static uint8_t change[FRAME_SIZE];
+
+// Capture of the running update
+static uint32_t crc;
+static FILE *stream = NULL;
+static int streamStage;
+static uint16_t streamLine;
+static int failures = 0;
+
+static uint32_t crc32(uint32_t c, const uint8_t *data, uint16_t size) {
+	c = ~c;
+	while (size--) {
+		c ^= *data++;
+		for (uint8_t k = 0; k < 8; k++) {
+			c = (c >> 1) ^ (0xedb88320U & -(c & 1));
+		}
+	}
+	return ~c;
+}
+
+// Line number of the n-th line a partial frame drives
+static uint16_t mapLine(uint16_t n) {
+	for (uint16_t l = 0; l < epd1.lines_per_display; l++) {
+		if ((epd1.line_map[l / 8] & (1 << (l % 8))) && (n-- == 0)) {
+			return l;
+		}
+	}
+	return 0xffff;
+}
+
+static void capture(const uint8_t *data, uint16_t size, bool dma) {
+	uint16_t line;
+
+	crc = crc32(crc, data, size);
+
+	// Line buffers go out by DMA and start with 0x72, the output commands are blocking
+	if ((stream == NULL) || !dma || (data[0] != 0x72) ||
+			(epd1.step != EPD_STEP_STAGE) || (epd1.stage_frames != 0)) {
+		return;
+	}
+	if (epd1.stage != streamStage) {
+		streamStage = epd1.stage;
+		streamLine = 0;
+		fprintf(stream, "# %s\n", stageNames[streamStage]);
+	}
+	line = (epd1.update == EPD_UPDATE_PARTIAL) ? mapLine(streamLine) : streamLine;
+	streamLine++;
+	fprintf(stream, "%3u ", line);
+	for (uint16_t i = 0; i < size; i++) {
+		fprintf(stream, "%02x", data[i]);
+	}
+	fprintf(stream, "\n");
+}
+
+static void loadFrame(const char *dir, const char *name, uint8_t *frame) {
+	char path[256];
+	unsigned dots, lines;
+	FILE *f;
+
+	snprintf(path, sizeof(path), "%s/%s.txt", dir, name);
+	f = fopen(path, "r");
+	if ((f == NULL) || (fscanf(f, "FRAME %ux%u", &dots, &lines) != 2) ||
+			(dots != epd1.dots_per_line) || (lines != epd1.lines_per_display)) {
+		fprintf(stderr, "%s: no %ux%u frame\n", path, epd1.dots_per_line, epd1.lines_per_display);
+		exit(2);
+	}
+	for (unsigned i = 0; i < dots / 8 * lines; i++) {
+		unsigned b;
+
+		if (fscanf(f, "%2x", &b) != 1) {
+			fprintf(stderr, "%s: short frame\n", path);
+			exit(2);
+		}
+		frame[i] = b;
+	}
+	fclose(f);
+}
+
+static void runUpdate(FILE *digest, const char *outDir, EPD_update update, const uint8_t *oldImage, const uint8_t *newImage) {
+	uint8_t lineMap[EPD_LINE_MAP_SIZE];
+	uint16_t lines = epd1.lines_per_display;
+	int16_t temperature;
+	uint32_t startTick, powerMs, totalMs, bytes = 0, transfers = 0;
+	int32_t error;
+	EPD_spi_stats stats;
+	EPD_cost cost;
+	char path[256];
+
+	if (update == EPD_UPDATE_PARTIAL) {
+		lines = EPD_changed_lines(&epd1, oldImage, newImage, lineMap);
+	}
+	// EPD_STEP_POWER_ON reads the sensor, a held COG keeps the temperature it has
+	if (epd1.COG_on || (LM75B_GetCachedTemp(&temperature, EPD_TEMPERATURE_MAX_AGE) != LM75B_OK)) {
+		temperature = epd1.temperature;
+	}
+	EPD_estimate(&epd1, update, lines, temperature, &cost);
+
+	// Streams in the format of epd_frame.py, which only writes these two
+	if ((update == EPD_UPDATE_IMAGE_0) || (update == EPD_UPDATE_PARTIAL)) {
+		snprintf(path, sizeof(path), "%s/%s.stream", outDir, updateNames[update]);
+		stream = fopen(path, "w");
+		if (stream == NULL) {
+			perror(path);
+			exit(2);
+		}
+		fprintf(stream, (update == EPD_UPDATE_PARTIAL) ? "# EPD_UPDATE_PARTIAL, changed lines of one frame\n" :
+				"# EPD_UPDATE_IMAGE_0, one frame per stage\n");
+		streamStage = -1;
+	}
+
+	crc = 0;
+	startTick = HAL_GetTick();
+	if (!EPD_start_update(&epd1, update, oldImage, newImage, lineMap)) {
+		printf("FAIL: %s didn't start\n", updateNames[update]);
+		failures++;
+		return;
+	}
+	while (EPD_busy(&epd1)) {
+		EPD_process(&epd1);
+	}
+	if (stream != NULL) {
+		fclose(stream);
+		stream = NULL;
+	}
+
+	EPD_get_spi_stats(update, &stats);
+	for (uint8_t s = 0; s < 4; s++) {
+		bytes += stats.stage[s].bytes;
+		transfers += stats.stage[s].transactions;
+	}
+	powerMs = epd1.frames_start - startTick;
+	totalMs = powerMs + stats.update_ms;
+	error = (int32_t) cost.total_ms - (int32_t) totalMs;
+
+	fprintf(digest, "%-8s %3u lines %4.1f C  power %5u B %3u transfers  stages %6u B %5u transfers  crc %08x\n",
+			updateNames[update], lines, temperature / 8.0, stats.power.bytes, stats.power.transactions,
+			bytes, transfers, crc);
+	fprintf(digest, "         frames %u/%u/%u/%u  power up %u ms  total %u ms, model %u ms %u B\n",
+			stats.frames[0], stats.frames[1], stats.frames[2], stats.frames[3], powerMs, totalMs,
+			cost.total_ms, cost.bytes);
+	printf("%-8s %u ms, model %u ms (%+.1f%%), %u B, model %u B\n", updateNames[update], totalMs,
+			cost.total_ms, 100.0 * error / totalMs, bytes, cost.bytes);
+
+	if (abs(error) * 100 > EPD_MODEL_TOLERANCE * (int32_t) totalMs) {
+		printf("FAIL: %s: the model is off by more than %d%%\n", updateNames[update], EPD_MODEL_TOLERANCE);
+		failures++;
+	}
+}
+
+int main(int argc, char **argv) {
+	uint8_t allLines[EPD_LINE_MAP_SIZE];
+	char path[256];
+	FILE *digest;
+
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s <frame dir> <out dir>\n", argv[0]);
+		return 2;
+	}
+
+	hdma.Instance = DMA1_Stream4;
+	hspi2.Instance = SPI2;
+	hspi2.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_4;
+	hspi2.hdmatx = &hdma;
+	hspi2.State = HAL_SPI_STATE_READY;
+
+	EPD_Init(MATTE_BOX_EPD_SIZE, &hspi2, &epd1);
+	memset(white, 0xff, sizeof(white));
+	loadFrame(argv[1], "filters", filters);
+	loadFrame(argv[1], "highlight", highlight);
+	loadFrame(argv[1], "change", change);
+
+	snprintf(path, sizeof(path), "%s/epd.txt", argv[2]);
+	digest = fopen(path, "w");
+	if (digest == NULL) {
+		perror(path);
+		return 2;
+	}
+	hostSpiCapture(capture);
+
+	// A burst from a cold COG, held between the updates
+	runUpdate(digest, argv[2], EPD_UPDATE_IMAGE_0, white, filters);
+	runUpdate(digest, argv[2], EPD_UPDATE_PARTIAL, filters, highlight);
+	runUpdate(digest, argv[2], EPD_UPDATE_IMAGE, highlight, change);
+
+	// The hold runs out, the next update powers up again in the cold
+	hostAdvanceMs(EPD_COG_HOLD_MS);
+	while (EPD_process(&epd1)) {
+	}
+
+	// Nothing changed, the COG stays off
+	memset(allLines, 0xff, sizeof(allLines));
+	crc = 0;
+	if (!EPD_start_update(&epd1, EPD_UPDATE_PARTIAL, change, change, allLines) || EPD_busy(&epd1) ||
+			epd1.COG_on || (crc != 0)) {
+		printf("FAIL: a partial update of identical images drives the panel\n");
+		failures++;
+	}
+
+	hostSetTemperature(0, true);
+	hostAdvanceMs(EPD_TEMPERATURE_MAX_AGE);
+	runUpdate(digest, argv[2], EPD_UPDATE_CLEAR, change, white);
+	EPD_release(&epd1);
+	fclose(digest);
+
+	printf("%ux%u, EPD_PIXEL_LUT %d: %s\n", epd1.dots_per_line, epd1.lines_per_display, EPD_PIXEL_LUT,
+			failures ? "FAILED" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * gfx_bench.c
+ *
+ * canvas_Benchmark ("gfxBench" on the box) on the host clock: the 3 slot screen with
+ * every text path, repeated and the fastest run of each path kept. The times are
+ * host times in 100 MHz cycles, they compare the paths, not the Cortex-M4.
+ *
+ *     gfx_bench [runs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hal_stub.h"
+#include "epd_gfx.h"
+
+#define RUNS_DEFAULT	2000
+
+static SPI_HandleTypeDef hspi2;
+static DMA_HandleTypeDef hdma;
+static EPD_HandleTypeDef epd1;
+static Canvas canvas1;
+
+static uint32_t keepMin(uint32_t min, uint32_t cycles) {
+	return (cycles < min) ? cycles : min;
+}
+
+static void printPath(const char *name, uint32_t cycles, uint32_t pixelCycles) {
+	printf("  %-8s %7u cycles %6.1f us  %4.1fx\n", name, cycles, cycles / 100.0, (double) pixelCycles / cycles);
+}
+
+int main(int argc, char **argv) {
+	uint32_t runs = (argc > 1) ? strtoul(argv[1], NULL, 10) : RUNS_DEFAULT;
+	Canvas_bench bench, best = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, true};
+
+	hdma.Instance = DMA1_Stream4;
+	hspi2.Instance = SPI2;
+	hspi2.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_4;
+	hspi2.hdmatx = &hdma;
+	hspi2.State = HAL_SPI_STATE_READY;
+
+	EPD_Init(MATTE_BOX_EPD_SIZE, &hspi2, &epd1);
+	if (Canvas_Init(&canvas1, epd1.dots_per_line, epd1.lines_per_display) != CANVAS_OK) {
+		printf("FAIL: Canvas_Init %ux%u\n", epd1.dots_per_line, epd1.lines_per_display);
+		return 1;
+	}
+	canvas_SetRotate(&canvas1, ROTATE_90);
+	canvas_SetSlots(&canvas1, FILTER_SECTION_SIZE);
+	canvas_DrawLayout(&canvas1);
+
+	hostRealTime(true);
+	for (uint32_t i = 0; i < runs; i++) {
+		if (canvas_Benchmark(&canvas1, &epd1, &bench) != CANVAS_OK) {
+			printf("FAIL: canvas_Benchmark\n");
+			return 1;
+		}
+		best.pixelCycles = keepMin(best.pixelCycles, bench.pixelCycles);
+		best.blitCycles = keepMin(best.blitCycles, bench.blitCycles);
+		best.packedCycles = keepMin(best.packedCycles, bench.packedCycles);
+		best.cachedCycles = keepMin(best.cachedCycles, bench.cachedCycles);
+		best.match = best.match && bench.match;
+	}
+	hostRealTime(false);
+
+	printf("%ux%u, FONT_ASSET_PACK %d, fastest of %u runs:\n", canvas1.width, canvas1.height,
+			FONT_ASSET_PACK, runs);
+	printPath("pixels", best.pixelCycles, best.pixelCycles);
+	printPath("glyphs", best.blitCycles, best.pixelCycles);
+	printPath("packed", best.packedCycles, best.pixelCycles);
+	printPath("cached", best.cachedCycles, best.pixelCycles);
+	if (!best.match) {
+		printf("FAIL: the text paths draw different frames\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,284 @@
+/*
+ * gfx_test.c
+ *
+ * Filter display of one panel (MATTE_BOX_EPD_SIZE) through the setupIOs and main loop calls,
+ * on the real G2 driver:
+ *   - a fixed set of screens is dumped in the "epdFrame" format, make check holds them
+ *     against the PBMs in golden/<panel> with Tools/epd_frame.py --compare
+ *   - canvas_Benchmark must draw the same frame with every text path and leave the name
+ *     cache counters as they were
+ *   - random slot changes: after every redraw the displayed frame has to match the same
+ *     slots drawn from scratch, and every partial update has to drive all lines that changed
+ *
+ *     gfx_test <dump dir> [changes] [seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "hal_stub.h"
+#include "epd_gfx.h"
+
+#define CHANGES_DEFAULT		2000
+
+typedef struct {
+	const char *name;
+	uint8_t slots;					/* Layout drawn and printed first when it changes	*/
+	const char *filters[FILTER_SECTION_SIZE];
+	uint8_t invPosition;
+} screen_t;
+
+static const screen_t screens[] = {
+	{"filters",   3, {"ND0.6", "BLKPROMIST", "POL"}, 0},
+	{"highlight", 3, {"ND0.6", "BLKPROMIST", "POL"}, 2},
+	{"change",    3, {"IRND1.2", "BLKPROMIST", ""}, 0},
+	{"long",      3, {"1234567890", "gjpqy_|~", "W"}, 3},
+	{"slots2",    2, {"ND0.9", "POLARIZER", ""}, 1},
+	{"slots1",    1, {"BLACK PRO", "", ""}, 0},
+};
+
+static const char* const names[] = {
+	"", "ND0.3", "ND0.6", "ND0.9", "ND1.2", "POL", "BLKPROMIST", "IRND1.2",
+	"HBM 1/4", "CLEAR", "W", "1234567890", "gjpqy_|~", "Soft FX 2"
+};
+
+static SPI_HandleTypeDef hspi2;
+static DMA_HandleTypeDef hdma;
+static EPD_HandleTypeDef epd1;
+static Canvas canvas1;
+static filterSection_t filters;
+
+// What the panel shows, kept by the EPD_start_update wrapper
+static uint8_t panel[CANVAS_BUFFER_SIZE];
+static uint32_t partials, fulls, linesDriven, linesChanged;
+static int failures = 0;
+
+bool __real_EPD_start_update(EPD_HandleTypeDef *epd, EPD_update update, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map);
+
+// Checks every update canvas_StartRefresh starts against the frame on the panel
+bool __wrap_EPD_start_update(EPD_HandleTypeDef *epd, EPD_update update, const uint8_t *old_image, const uint8_t *new_image, const uint8_t *line_map) {
+	uint16_t bytesPerLine = canvas1.width / 8;
+	bool started = __real_EPD_start_update(epd, update, old_image, new_image, line_map);
+
+	if (!started) {
+		return false;
+	}
+
+	if (update == EPD_UPDATE_PARTIAL) {
+		partials++;
+		if (memcmp(old_image, panel, CANVAS_BUFFER_SIZE) != 0) {
+			printf("FAIL: partial update %u: old image isn't the frame on the panel\n", partials);
+			failures++;
+		}
+		for (uint16_t l = 0; l < canvas1.height; l++) {
+			bool driven = line_map[l / 8] & (1 << (l % 8));
+			bool changed = memcmp(&new_image[l * bytesPerLine], &panel[l * bytesPerLine], bytesPerLine) != 0;
+
+			linesDriven += driven;
+			linesChanged += changed;
+			if (changed && !driven) {
+				printf("FAIL: partial update %u: line %u changed but isn't driven\n", partials, l);
+				failures++;
+			}
+		}
+	} else {
+		fulls++;
+	}
+	memcpy(panel, new_image, CANVAS_BUFFER_SIZE);
+	return true;
+}
+
+static void setFilters(const char* const slotNames[FILTER_SECTION_SIZE]) {
+	memset(&filters, 0, sizeof(filters));
+	for (uint8_t i = 0; i < FILTER_SECTION_SIZE; i++) {
+		// Names are 10 bytes without a terminator, like on the tags
+		strncpy((char *) filters.filter[i].filterName, slotNames[i], FILTER_NAME_LEN);
+		filters.filter[i].position = (slotNames[i][0] != '\0') ? i + 1 : 0;
+		filters.filterCount += (slotNames[i][0] != '\0');
+	}
+}
+
+static void dumpFrame(const char *dir, const char *name) {
+	char path[256];
+	FILE *f;
+
+	snprintf(path, sizeof(path), "%s/%s.txt", dir, name);
+	f = fopen(path, "w");
+	if (f == NULL) {
+		perror(path);
+		exit(2);
+	}
+	fprintf(f, "FRAME %ux%u\n", canvas1.width, canvas1.height);
+	for (uint16_t y = 0; y < canvas1.height; y++) {
+		for (uint16_t b = 0; b < canvas1.width / 8; b++) {
+			fprintf(f, "%02x", canvas1.front[y * (canvas1.width / 8) + b]);
+		}
+		fprintf(f, "\n");
+	}
+	fprintf(f, "END\n");
+	fclose(f);
+}
+
+static void drawLayout(uint8_t slots) {
+	canvas_SetSlots(&canvas1, slots);
+	canvas_DrawLayout(&canvas1);
+	canvas_PrintEPD(&canvas1, &epd1);
+}
+
+// The slots as a fresh box would show them: layout and every slot drawn, in a child
+// so the state of this one stays as it is
+static bool freshFrame(uint8_t invPosition, uint8_t *frame) {
+	int fds[2];
+	pid_t pid;
+	size_t got = 0;
+	int status;
+
+	if (pipe(fds) != 0) {
+		return false;
+	}
+	pid = fork();
+	if (pid == 0) {
+		close(fds[0]);
+		canvas_DrawLayout(&canvas1);
+		canvas_DrawFilters(&canvas1, &epd1, &filters, invPosition);
+		canvas_Flush(&canvas1, &epd1);
+		if (write(fds[1], canvas1.front, CANVAS_BUFFER_SIZE) != CANVAS_BUFFER_SIZE) {
+			_exit(1);
+		}
+		_exit(0);
+	}
+	close(fds[1]);
+	while (got < CANVAS_BUFFER_SIZE) {
+		ssize_t n = read(fds[0], frame + got, CANVAS_BUFFER_SIZE - got);
+
+		if (n <= 0) {
+			break;
+		}
+		got += n;
+	}
+	close(fds[0]);
+	waitpid(pid, &status, 0);
+	return (got == CANVAS_BUFFER_SIZE) && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+}
+
+static void randomChanges(uint32_t changes) {
+	static uint8_t fresh[CANVAS_BUFFER_SIZE];
+	const char* slotNames[FILTER_SECTION_SIZE] = {"", "", ""};
+	uint16_t size = canvas1.width * canvas1.height / 8;
+	uint8_t invPosition = 0;
+	Canvas_refresh_stats stats;
+	Canvas_cache_stats cache;
+	uint32_t mismatches = 0;
+
+	for (uint32_t i = 0; i < changes; i++) {
+		// One to three requests, the ones after the first coalesce while the update runs
+		for (int r = 1 + rand() % 3; r > 0; r--) {
+			if (rand() % 4 == 0) {
+				invPosition = rand() % (FILTER_SECTION_SIZE + 1);
+			} else {
+				slotNames[rand() % FILTER_SECTION_SIZE] = names[rand() % (sizeof(names) / sizeof(names[0]))];
+			}
+			setFilters(slotNames);
+			canvas_DrawFilters(&canvas1, &epd1, &filters, invPosition);
+			// Some requests come in while the update runs
+			for (int s = rand() % 40; s > 0; s--) {
+				canvas_Process(&canvas1, &epd1);
+			}
+		}
+		// The cold makes the slots reach the ghosting limit sooner, a full refresh follows
+		if (rand() % 50 == 0) {
+			hostSetTemperature((rand() % 40 - 5) * 8, true);
+		}
+		canvas_Flush(&canvas1, &epd1);
+
+		if (memcmp(canvas1.image, canvas1.front, size) != 0) {
+			printf("FAIL: change %u: the back buffer isn't a copy of the displayed frame\n", i);
+			failures++;
+		}
+		if (!freshFrame(invPosition, fresh) || (memcmp(fresh, canvas1.front, size) != 0)) {
+			if (mismatches++ < 5) {
+				printf("FAIL: change %u: \"%s\" \"%s\" \"%s\" highlight %u differs from a full redraw\n",
+						i, slotNames[0], slotNames[1], slotNames[2], invPosition);
+			}
+			failures++;
+		}
+	}
+
+	canvas_GetRefreshStats(&stats);
+	canvas_GetNameCacheStats(&cache);
+	printf("%u random changes: %u requests, %u coalesced, %u partial and %u full updates\n",
+			changes, stats.requests, stats.coalesced, partials, fulls);
+	printf("  partial updates drove %u lines, %u of them changed; name cache %u hits, %u misses\n",
+			linesDriven, linesChanged, cache.hits, cache.misses);
+}
+
+int main(int argc, char **argv) {
+	uint32_t changes = (argc > 2) ? strtoul(argv[2], NULL, 10) : CHANGES_DEFAULT;
+	uint8_t slots = 0;
+#if CANVAS_BENCHMARK
+	Canvas_bench bench;
+	Canvas_cache_stats cacheBefore, cacheAfter;
+#endif
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <dump dir> [changes] [seed]\n", argv[0]);
+		return 2;
+	}
+	srand((argc > 3) ? strtoul(argv[3], NULL, 10) : 1);
+
+	hdma.Instance = DMA1_Stream4;
+	hspi2.Instance = SPI2;
+	hspi2.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_4;
+	hspi2.hdmatx = &hdma;
+	hspi2.State = HAL_SPI_STATE_READY;
+
+	// setupIOs
+	EPD_Init(MATTE_BOX_EPD_SIZE, &hspi2, &epd1);
+	if (Canvas_Init(&canvas1, epd1.dots_per_line, epd1.lines_per_display) != CANVAS_OK) {
+		printf("FAIL: Canvas_Init %ux%u\n", epd1.dots_per_line, epd1.lines_per_display);
+		return 1;
+	}
+	canvas_SetRotate(&canvas1, ROTATE_90);
+	EPD_begin(&epd1);
+	EPD_clear(&epd1);
+	EPD_end(&epd1);
+	drawLayout(FILTER_SECTION_SIZE);
+	slots = FILTER_SECTION_SIZE;
+	dumpFrame(argv[1], "layout");
+
+	for (uint8_t i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+		const screen_t *s = &screens[i];
+
+		if (s->slots != slots) {
+			drawLayout(s->slots);
+			slots = s->slots;
+		}
+		setFilters(s->filters);
+		canvas_DrawFilters(&canvas1, &epd1, &filters, s->invPosition);
+		canvas_Flush(&canvas1, &epd1);
+		dumpFrame(argv[1], s->name);
+	}
+
+	drawLayout(FILTER_SECTION_SIZE);
+#if CANVAS_BENCHMARK
+	canvas_GetNameCacheStats(&cacheBefore);
+	if ((canvas_Benchmark(&canvas1, &epd1, &bench) != CANVAS_OK) || !bench.match) {
+		printf("FAIL: canvas_Benchmark, the text paths draw different frames\n");
+		failures++;
+	}
+	canvas_GetNameCacheStats(&cacheAfter);
+	if (memcmp(&cacheBefore, &cacheAfter, sizeof(cacheBefore)) != 0) {
+		printf("FAIL: canvas_Benchmark changes the name cache counters\n");
+		failures++;
+	}
+#endif
+
+	randomChanges(changes);
+
+	printf("%ux%u, FONT_ASSET_PACK %d: %s\n", canvas1.width, canvas1.height, FONT_ASSET_PACK,
+			failures ? "FAILED" : "ok");
+	return failures ? 1 : 0;
+}
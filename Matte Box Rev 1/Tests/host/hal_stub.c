@@ -0,0 +1,335 @@
+/*
+ * hal_stub.c
+ *
+ * HAL, DWT, LM75B and RTC stand-ins of the host build, see hal_stub.h
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "hal_stub.h"
+#include "main.h"
+#include "dwt_delay.h"
+#include "lm75b.h"
+#include "rtc.h"
+
+#define HOST_PINS			32
+#define HOST_SPIN_CALLS		8		/* HAL_GetTick calls in a row taken for a wait loop	*/
+#define HOST_IRQS			96		/* Device interrupts of the STM32F411				*/
+
+typedef struct {
+	GPIO_TypeDef *port;
+	uint16_t pin;
+	GPIO_PinState state;
+} hostPin_t;
+
+static uint64_t simCycles;
+static uint64_t spinMark;			/* simCycles after the last HAL_GetTick	*/
+static uint32_t spinCalls;
+static bool realTime = false;
+static struct timespec realStart;
+static DWT_Type dwt;
+
+static hostPin_t pins[HOST_PINS];
+static uint8_t pinCount = 0;
+static bool cardIn = true;
+
+static hostSpiHook spiHook = NULL;
+static hostSpiResponder spiResponder = NULL;
+static uint64_t dmaEnd;
+
+static void (*irqHandlers[HOST_IRQS])(void);
+static bool irqEnabled[HOST_IRQS];
+static bool irqPending[HOST_IRQS];
+static uint32_t ipsr;				/* Exception number, 0 in thread mode	*/
+
+static int16_t temperature = 25 * 8;
+static bool temperatureValid = true;
+
+static time_t rtcBase;				/* Date and time at simulated cycle 0	*/
+static bool rtcInit = false;
+
+RTC_HandleTypeDef hrtc;
+uint32_t SystemCoreClock = HOST_CORE_HZ;
+
+/********************************************************************************
+ * Simulated time
+ *******************************************************************************/
+uint64_t hostCycles(void) {
+	return simCycles;
+}
+
+void hostAdvance(uint64_t cycles) {
+	simCycles += cycles;
+}
+
+void hostAdvanceMs(uint32_t ms) {
+	simCycles += (uint64_t) ms * HOST_CYCLES_PER_MS;
+}
+
+void hostRealTime(bool on) {
+	realTime = on;
+	clock_gettime(CLOCK_MONOTONIC, &realStart);
+}
+
+DWT_Type* hostDwt(void) {
+	if (realTime) {
+		struct timespec now;
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		dwt.CYCCNT = (uint32_t) (((now.tv_sec - realStart.tv_sec) * 1000000000LL + now.tv_nsec - realStart.tv_nsec) / 10);
+	} else {
+		dwt.CYCCNT = (uint32_t) simCycles;
+	}
+	return &dwt;
+}
+
+uint32_t HAL_GetTick(void) {
+	// A loop spinning on the tick, nothing else moved the time since the last calls.
+	// It sees the same tick until the next millisecond, skip there.
+	if (simCycles == spinMark) {
+		if (++spinCalls >= HOST_SPIN_CALLS) {
+			simCycles = (simCycles / HOST_CYCLES_PER_MS + 1) * HOST_CYCLES_PER_MS - HOST_TICK_CYCLES;
+		}
+	} else {
+		spinCalls = 0;
+	}
+	simCycles += HOST_TICK_CYCLES;
+	spinMark = simCycles;
+	return (uint32_t) (simCycles / HOST_CYCLES_PER_MS);
+}
+
+void HAL_Delay(uint32_t Delay) {
+	hostAdvanceMs(Delay);
+}
+
+void DWT_Init(void) {
+}
+
+void DWT_Delay(uint32_t us) {
+	simCycles += (uint64_t) us * (HOST_CORE_HZ / 1000000U) + HOST_DELAY_US_CYCLES;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+	return HOST_PCLK1_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void) {
+	return HOST_PCLK2_HZ;
+}
+
+/********************************************************************************
+ * GPIO, pin numbers repeat on every port
+ *******************************************************************************/
+static hostPin_t* findPin(GPIO_TypeDef *port, uint16_t pin) {
+	for (uint8_t i = 0; i < pinCount; i++) {
+		if ((pins[i].port == port) && (pins[i].pin == pin)) {
+			return &pins[i];
+		}
+	}
+	if (pinCount == HOST_PINS) {
+		return NULL;
+	}
+	pins[pinCount] = (hostPin_t) {port, pin, GPIO_PIN_RESET};
+	return &pins[pinCount++];
+}
+
+GPIO_PinState hostPin(GPIO_TypeDef *port, uint16_t pin) {
+	hostPin_t *p = findPin(port, pin);
+
+	return (p == NULL) ? GPIO_PIN_RESET : p->state;
+}
+
+void hostSetPin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+	hostPin_t *p = findPin(port, pin);
+
+	if (p != NULL) {
+		p->state = state;
+	}
+}
+
+void hostSetCard(bool inserted) {
+	cardIn = inserted;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+	hostSetPin(GPIOx, GPIO_Pin, PinState);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+	if ((GPIOx == SD_DETECT_GPIO_Port) && (GPIO_Pin == SD_DETECT_Pin)) {
+		return cardIn ? GPIO_PIN_RESET : GPIO_PIN_SET;
+	}
+	// The COG is never busy
+	if ((GPIOx == EPD_BUSY_GPIO_Port) && (GPIO_Pin == EPD_BUSY_Pin)) {
+		return GPIO_PIN_RESET;
+	}
+	return hostPin(GPIOx, GPIO_Pin);
+}
+
+/********************************************************************************
+ * SPI, blocking and DMA transmit at the clock of the instance
+ *******************************************************************************/
+void hostSpiCapture(hostSpiHook hook) {
+	spiHook = hook;
+}
+
+void hostSpiRespond(hostSpiResponder responder) {
+	spiResponder = responder;
+}
+
+static uint64_t byteCycles(SPI_HandleTypeDef *hspi) {
+	uint32_t pclk = (hspi->Instance == SPI1) ? HOST_PCLK2_HZ : HOST_PCLK1_HZ;
+	uint32_t div = 2U << ((hspi->Init.BaudRatePrescaler & SPI_CR1_BR) >> SPI_CR1_BR_Pos);
+
+	return 8ULL * div * (HOST_CORE_HZ / pclk);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+	(void) Timeout;
+	if (spiHook != NULL) {
+		spiHook(pData, Size, false);
+	}
+	simCycles += HOST_SPI_CALL_CYCLES + Size * byteCycles(hspi);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) {
+	if (hspi->State != HAL_SPI_STATE_READY) {
+		return HAL_BUSY;
+	}
+	if (spiHook != NULL) {
+		spiHook(pData, Size, true);
+	}
+	simCycles += HOST_SPI_CALL_CYCLES;
+	dmaEnd = simCycles + Size * byteCycles(hspi);
+	hspi->State = HAL_SPI_STATE_BUSY_TX;
+	return HAL_OK;
+}
+
+// The G2 COG: ID 0x12 on 0x71, the charge pumps and DC check report ready (0x40 set)
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout) {
+	(void) Timeout;
+	if (spiHook != NULL) {
+		spiHook(pTxData, Size, false);
+	}
+	simCycles += HOST_SPI_CALL_CYCLES + Size * byteCycles(hspi);
+	memset(pRxData, 0x00, Size);
+	if (spiResponder != NULL) {
+		spiResponder(hspi, pTxData, pRxData, Size);
+	} else if (Size > 1) {
+		pRxData[1] = (pTxData[0] == 0x71) ? 0x12 : 0xc0;
+	}
+	return HAL_OK;
+}
+
+// Polled until the DMA is done, the time passes in one go
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi) {
+	if ((hspi->State == HAL_SPI_STATE_BUSY_TX) && (simCycles < dmaEnd)) {
+		simCycles = dmaEnd;
+	}
+	hspi->State = HAL_SPI_STATE_READY;
+	return HAL_SPI_STATE_READY;
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi) {
+	hspi->State = HAL_SPI_STATE_READY;
+	return HAL_OK;
+}
+
+/********************************************************************************
+ * NVIC, one priority level: a handler is not interrupted by another one
+ *******************************************************************************/
+static void runIrq(IRQn_Type irq) {
+	if ((ipsr != 0) || !irqEnabled[irq] || !irqPending[irq] || (irqHandlers[irq] == NULL)) {
+		return;
+	}
+	irqPending[irq] = false;
+	ipsr = (uint32_t) irq + 16U;
+	irqHandlers[irq]();
+	ipsr = 0;
+}
+
+void hostIrqHandler(IRQn_Type irq, void (*handler)(void)) {
+	irqHandlers[irq] = handler;
+}
+
+void hostRaiseIrq(IRQn_Type irq) {
+	irqPending[irq] = true;
+	runIrq(irq);
+}
+
+void hostNvicEnable(IRQn_Type irq) {
+	if (irq >= 0) {
+		irqEnabled[irq] = true;
+		runIrq(irq);
+	}
+}
+
+void hostNvicDisable(IRQn_Type irq) {
+	if (irq >= 0) {
+		irqEnabled[irq] = false;
+	}
+}
+
+uint32_t hostIpsr(void) {
+	return ipsr;
+}
+
+/********************************************************************************
+ * LM75B
+ *******************************************************************************/
+void hostSetTemperature(int16_t eighths, bool valid) {
+	temperature = eighths;
+	temperatureValid = valid;
+}
+
+LM75B_error LM75B_GetCachedTemp(int16_t *temp, uint32_t maxAge) {
+	(void) maxAge;
+	if (!temperatureValid) {
+		return LM75B_ERR;
+	}
+	*temp = temperature;
+	return LM75B_OK;
+}
+
+/********************************************************************************
+ * RTC
+ *******************************************************************************/
+void hostSetDateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds) {
+	struct tm t = {0};
+
+	t.tm_year = year - 1900;
+	t.tm_mon = month - 1;
+	t.tm_mday = day;
+	t.tm_hour = hours;
+	t.tm_min = minutes;
+	t.tm_sec = seconds;
+	rtcBase = timegm(&t) - (time_t) (simCycles / HOST_CORE_HZ);
+}
+
+void rtcModuleInit(RTC_HandleTypeDef *hrtc) {
+	(void) hrtc;
+	rtcInit = true;
+}
+
+bool rtcModuleIsInit(void) {
+	return rtcInit;
+}
+
+RTC_error rtcGetDateTime(RTC_DateTypeDef* dateRet, RTC_TimeTypeDef* timeRet) {
+	time_t now = rtcBase + (time_t) (simCycles / HOST_CORE_HZ);
+	struct tm t;
+
+	gmtime_r(&now, &t);
+	memset(dateRet, 0, sizeof(RTC_DateTypeDef));
+	memset(timeRet, 0, sizeof(RTC_TimeTypeDef));
+	dateRet->Year = t.tm_year - 100;
+	dateRet->Month = t.tm_mon + 1;
+	dateRet->Date = t.tm_mday;
+	dateRet->WeekDay = (t.tm_wday == 0) ? 7 : t.tm_wday;
+	timeRet->Hours = t.tm_hour;
+	timeRet->Minutes = t.tm_min;
+	timeRet->Seconds = t.tm_sec;
+	return RTC_OK;
+}
@@ -0,0 +1,57 @@
+/*
+ * hal_stub.h
+ *
+ * The parts of the HAL, the board and the sensors the display and logger sources
+ * call, on a simulated timeline. Time only moves when the firmware waits, polls or
+ * sends: a 100 MHz core with SPI2 on a 50 MHz APB1, the clocks of the box.
+ */
+
+#ifndef HAL_STUB_H
+#define HAL_STUB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
+#define HOST_CORE_HZ		100000000U	/* SystemCoreClock of the box							*/
+#define HOST_PCLK1_HZ		50000000U	/* SPI2, SPI3											*/
+#define HOST_PCLK2_HZ		100000000U	/* SPI1													*/
+#define HOST_CYCLES_PER_MS	(HOST_CORE_HZ / 1000U)
+
+// CPU time of the HAL calls, estimates for a 100 MHz Cortex-M4
+#define HOST_SPI_CALL_CYCLES	300U	/* HAL_SPI_Transmit(_DMA) and the CS writes around it		*/
+#define HOST_TICK_CYCLES		20U		/* HAL_GetTick, a busy wait polls it						*/
+#define HOST_DELAY_US_CYCLES	30U		/* DWT_Delay call on top of the delay						*/
+
+// Simulated time
+uint64_t hostCycles(void);
+void hostAdvance(uint64_t cycles);
+void hostAdvanceMs(uint32_t ms);
+// DWT->CYCCNT follows the host clock (10 ns steps) instead, for benchmarks of code
+// that doesn't wait on the simulated peripherals
+void hostRealTime(bool on);
+
+// GPIO outputs as the firmware left them, inputs as set here
+GPIO_PinState hostPin(GPIO_TypeDef *port, uint16_t pin);
+void hostSetPin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+void hostSetCard(bool inserted);			/* SD_DETECT, low = card in							*/
+
+// Every SPI transfer, data as it leaves the MOSI pin
+typedef void (*hostSpiHook)(const uint8_t *data, uint16_t size, bool dma);
+void hostSpiCapture(hostSpiHook hook);
+// Device on the other end of HAL_SPI_TransmitReceive, NULL answers as the G2 COG
+typedef void (*hostSpiResponder)(SPI_HandleTypeDef *hspi, const uint8_t *tx, uint8_t *rx, uint16_t size);
+void hostSpiRespond(hostSpiResponder responder);
+
+// IRQ lines, a raised line runs its handler as an exception as soon as the NVIC has it enabled
+void hostIrqHandler(IRQn_Type irq, void (*handler)(void));
+void hostRaiseIrq(IRQn_Type irq);
+
+// LM75B_GetCachedTemp, valid = false answers LM75B_ERR
+void hostSetTemperature(int16_t eighths, bool valid);
+
+// RTC, runs with the simulated time from the given date
+void hostSetDateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds);
+
+#endif // HAL_STUB_H
@@ -0,0 +1,35 @@
+/*
+ * host.h
+ *
+ * Forced include (-include host.h) of the host build, see Makefile.
+ * The firmware sources compile unchanged against the ST headers, only the
+ * cycle counter, the NVIC enables and the exception number are moved from the
+ * Cortex-M4 to hal_stub.c.
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+#include "stm32f4xx.h"
+
+// DWT->CYCCNT of the firmware reads the simulated 100 MHz core clock of hal_stub.c,
+// or the host clock in 10 ns steps after hostRealTime(true)
+DWT_Type* hostDwt(void);
+
+#undef DWT
+#define DWT (hostDwt())
+
+// NVIC_EnableIRQ runs a pending handler of hal_stub.c, __get_IPSR() is non zero inside it
+void hostNvicEnable(IRQn_Type irq);
+void hostNvicDisable(IRQn_Type irq);
+uint32_t hostIpsr(void);
+
+#undef NVIC_EnableIRQ
+#undef NVIC_DisableIRQ
+#define NVIC_EnableIRQ(irq)		hostNvicEnable(irq)
+#define NVIC_DisableIRQ(irq)	hostNvicDisable(irq)
+#define __get_IPSR()			hostIpsr()
+#define __DSB()
+#define __ISB()
+
+#endif // HOST_H
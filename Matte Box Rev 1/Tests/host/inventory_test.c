@@ -0,0 +1,156 @@
+/*
+ * inventory_test.c
+ *
+ * iso15693Inventory of iso15693_3.c against the simulated tag population of iso15693_sim.c
+ * (ISO15693_SIM_TAGS 1), 20 to 50 tags in one and in 16 slots. The RF front-end is not
+ * there, the RFAL calls below only have to be linked and must not be reached.
+ *   - without arguments every population of every UID distribution is inventoried and the
+ *     requests, slots and modelled air time are printed, make check holds them against
+ *     golden/inventory.txt. Every tag has to be found.
+ *   - with a run count the CPU time of iso15693Inventory is measured on the host clock
+ *     for 50 random tags, the fastest run is kept (make bench)
+ *
+ *     inventory_test [runs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hal_stub.h"
+#include "iso15693_3.h"
+#include "iso15693_sim.h"
+#include "rfal_rf.h"
+
+#define SIM_SEED		0x1569
+
+static const uint8_t tagCounts[] = {20, 30, 40, 50};
+static const char *const distNames[] = {"random", "sequential", "clustered"};
+
+static uint32_t rfCalls = 0;
+static bool failed = false;
+
+/********************************************************************************
+ * RFAL, only the anticollision calls are taken over by the simulation
+ *******************************************************************************/
+ReturnCode rfalSetMode(rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR) {
+	(void) mode;
+	(void) txBR;
+	(void) rxBR;
+	return ERR_NONE;
+}
+
+void rfalSetErrorHandling(rfalEHandling eHandling) {
+	(void) eHandling;
+}
+
+void rfalSetFDTPoll(uint32_t FDTPoll) {
+	(void) FDTPoll;
+}
+
+void rfalSetFDTListen(uint32_t FDTListen) {
+	(void) FDTListen;
+}
+
+void rfalSetGT(uint32_t GT) {
+	(void) GT;
+}
+
+ReturnCode rfalFieldOnAndStartGT(void) {
+	return ERR_NONE;
+}
+
+ReturnCode rfalFieldOff(void) {
+	return ERR_NONE;
+}
+
+ReturnCode rfalISO15693TransceiveAnticollisionFrame(uint8_t *txBuf, uint8_t txBufLen, uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen) {
+	(void) txBuf;
+	(void) txBufLen;
+	(void) rxBuf;
+	(void) rxBufLen;
+	*actLen = 0;
+	rfCalls++;
+	return ERR_TIMEOUT;
+}
+
+ReturnCode rfalISO15693TransceiveEOFAnticollision(uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen) {
+	(void) rxBuf;
+	(void) rxBufLen;
+	*actLen = 0;
+	rfCalls++;
+	return ERR_TIMEOUT;
+}
+
+ReturnCode rfalTransceiveBlockingTxRx(uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *actLen, uint32_t flags, uint32_t fwt) {
+	(void) txBuf;
+	(void) txBufLen;
+	(void) rxBuf;
+	(void) rxBufLen;
+	(void) flags;
+	(void) fwt;
+	*actLen = 0;
+	rfCalls++;
+	return ERR_TIMEOUT;
+}
+
+/********************************************************************************
+ * Inventory rounds
+ *******************************************************************************/
+static void inventory(simUidDist_t dist, uint8_t tags, iso15693NumSlots_t slotcnt) {
+	simInventoryStats_t s;
+	ReturnCode err;
+
+	iso15693SimLoad(tags, dist, 0, SIM_SEED + tags);
+	err = iso15693SimBenchmark(slotcnt, &s);
+
+	printf("%-10s %2u tags %2u slot%s %2u found, %3u requests, %4u EOFs, %3u collisions, %4u timeouts, "
+			"air %6.1f ms, guard %6.1f ms, total %6.1f ms\n", distNames[dist], tags,
+			(slotcnt == ISO15693_NUM_SLOTS_1) ? 1 : 16, (slotcnt == ISO15693_NUM_SLOTS_1) ? ": " : "s:",
+			s.tagsFound, (unsigned) s.requests, (unsigned) s.eofs, (unsigned) s.collisions, (unsigned) s.timeouts,
+			s.airTimeUs / 1000.0, s.guardTimeUs / 1000.0, (s.airTimeUs + s.guardTimeUs) / 1000.0);
+
+	if ((err != ERR_NONE) || (s.tagsFound != tags)) {
+		printf("FAIL: %s %u tags in %u slots, error %d, %u found\n", distNames[dist], tags,
+				(slotcnt == ISO15693_NUM_SLOTS_1) ? 1 : 16, err, s.tagsFound);
+		failed = true;
+	}
+}
+
+static int bench(uint32_t runs) {
+	uint32_t best[2] = {UINT32_MAX, UINT32_MAX};
+	simInventoryStats_t s;
+
+	iso15693SimLoad(50, SIM_UID_RANDOM, 0, SIM_SEED + 50);
+	hostRealTime(true);
+	for (uint32_t run = 0; run < runs; run++) {
+		for (uint8_t k = 0; k < 2; k++) {
+			iso15693SimBenchmark(k ? ISO15693_NUM_SLOTS_16 : ISO15693_NUM_SLOTS_1, &s);
+			best[k] = (s.cpuCycles < best[k]) ? s.cpuCycles : best[k];
+		}
+	}
+	hostRealTime(false);
+
+	printf("iso15693Inventory, 50 random tags, fastest of %u runs:\n", (unsigned) runs);
+	printf("   1 slot   %8u cycles %8.2f us\n", (unsigned) best[0], best[0] / 100.0);
+	printf("  16 slots  %8u cycles %8.2f us\n", (unsigned) best[1], best[1] / 100.0);
+	return 0;
+}
+
+int main(int argc, char **argv) {
+	if (argc > 1) {
+		return bench(strtoul(argv[1], NULL, 10));
+	}
+
+	for (uint8_t dist = SIM_UID_RANDOM; dist <= SIM_UID_CLUSTERED; dist++) {
+		for (uint8_t i = 0; i < sizeof(tagCounts); i++) {
+			inventory(dist, tagCounts[i], ISO15693_NUM_SLOTS_1);
+			inventory(dist, tagCounts[i], ISO15693_NUM_SLOTS_16);
+		}
+	}
+
+	if (rfCalls != 0) {
+		printf("FAIL: %u RFAL transceive calls passed the simulation\n", (unsigned) rfCalls);
+		failed = true;
+	}
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Export the logs logger_test pulled from its cards with Tools/log_export.py and
+compare them with the CSVs the old logger would have written.
+
+    python3 logger_check.py <logger_test out dir>
+
+For every scenario and day the logs of all cards are exported in card order and
+their rows joined. Rows the logger lost have to be missing from the reference
+without anything else changing; they are counted, not failed, the golden report
+holds the expected counts. Exit 1 when an export has rows or a header the old
+logger wouldn't have written.
+"""
+
+import glob
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "Tools"))
+from log_export import export  # noqa: E402
+
+HEADER_LINES = 6
+
+
+def same_row(row, ref):
+    # "?" is a name defined in a block or on a card the export doesn't have
+    fields, ref_fields = row.rstrip("\n").split(","), ref.rstrip("\n").split(",")
+    return len(fields) == len(ref_fields) and all(f in (r, "?") for f, r in zip(fields, ref_fields))
+
+
+def missing_rows(ref, rows):
+    """Rows of ref not in rows, None when rows isn't ref with rows left out."""
+    i = 0
+    for row in ref:
+        if i < len(rows) and same_row(rows[i], row):
+            i += 1
+    return None if i < len(rows) else len(ref) - len(rows)
+
+
+def check(scenario_dir):
+    ok = True
+    name = os.path.basename(scenario_dir)
+
+    for ref_path in sorted(glob.glob(os.path.join(scenario_dir, "*.csv"))):
+        base = os.path.splitext(os.path.basename(ref_path))[0]
+        with open(ref_path, newline="") as f:
+            ref = f.read().splitlines(True)
+        header, rows = None, []
+
+        for log in sorted(glob.glob(os.path.join(scenario_dir, "card*", base + ".lwl"))):
+            with open(log, "rb") as f:
+                data = f.read()
+            csv, _, stats = export(data)
+            lines = csv.splitlines(True)
+            print("%s %s: %d B, %d blocks, %d records, %d B skipped, %d B unused"
+                  % (name, os.path.relpath(log, scenario_dir), len(data), stats["blocks"],
+                     stats["records"], stats["skipped"], stats["unused"]))
+            if header is None or header[1] == "Matte Box ID:,?\n":
+                header = lines[:HEADER_LINES]
+            rows += lines[HEADER_LINES:]
+
+        missing = None if header != ref[:HEADER_LINES] else missing_rows(ref[HEADER_LINES:], rows)
+        unnamed = sum(1 for row in rows if "?" in row.rstrip("\n").split(","))
+        if missing is None:
+            print("%s %s: FAIL, rows or header the old logger wouldn't have written" % (name, base))
+            ok = False
+        elif missing == 0 and unnamed == 0:
+            print("%s %s: %d rows, identical to the old CSV" % (name, base, len(rows)))
+        else:
+            print("%s %s: %d rows, %d of the old CSV missing, %d with a name lost"
+                  % (name, base, len(rows), missing, unnamed))
+    return ok
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    ok = True
+    for scenario_dir in sorted(glob.glob(os.path.join(sys.argv[1], "*", ""))):
+        ok = check(scenario_dir.rstrip(os.sep)) and ok
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
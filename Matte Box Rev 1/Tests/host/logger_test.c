@@ -0,0 +1,438 @@
+/*
+ * logger_test.c
+ *
+ * The data logger on the real FatFs and RAM cards, driven the way process_controller.c
+ * does: SDDataLog on a filter change, dataLoggerProcess from the main loop, dataLoggerInit
+ * and dataLoggerDeInit on card insert and removal, dataLoggerSync before sleep.
+ * Every scenario runs in its own process and writes to <out dir>/<scenario>:
+ *   - card<n>/  the log files as the card holds them at the end
+ *   - the CSVs the old logger would have written for the same filter changes
+ * logger_check.py exports the logs with Tools/log_export.py and compares them with those.
+ * The counters printed here and its report make up golden/logger.txt.
+ *
+ *     logger_test <out dir>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "hal_stub.h"
+#include "ram_disk.h"
+#include "main.h"
+#include "fatfs.h"
+#include "sd_diskio.h"
+#include "rtc.h"
+#include "dataLogger.h"
+
+#define LOOP_MS				100U		/* Main loop period between dataLoggerProcess calls	*/
+#define REF_FILES			8U
+
+typedef struct {
+	char name[48];						/* Old file name without ".csv"						*/
+	char *csv;
+	size_t len;
+	size_t cap;
+} refFile_t;
+
+typedef struct {
+	const char *name;
+	void (*run)(void);
+} scenario_t;
+
+// Filter names fit the 10 bytes of a tag with the terminator
+static const char* const names[] = {
+	"", "ND0.3", "ND0.6", "ND0.9", "ND1.2", "POL", "BLKPROMST", "IRND1.2", "HBM 1/4", "CLEAR"
+};
+
+static const char *outDir;
+static char scenarioDir[256];
+static filterSection_t section;
+static refFile_t refs[REF_FILES];
+static uint8_t refCount;
+static uint32_t rows;
+static bool cardInserted = false;
+static uint64_t startCycles;
+
+/********************************************************************************
+ * Old CSV layout, what the logger before the binary format wrote for every change
+ *******************************************************************************/
+static void refAppend(refFile_t *ref, const char *text) {
+	size_t n = strlen(text);
+
+	if (ref->len + n + 1 > ref->cap) {
+		ref->cap = (ref->cap + n + 1) * 2;
+		ref->csv = realloc(ref->csv, ref->cap);
+	}
+	memcpy(&ref->csv[ref->len], text, n + 1);
+	ref->len += n;
+}
+
+static void refRow(void) {
+	RTC_DateTypeDef date;
+	RTC_TimeTypeDef time;
+	char name[48];
+	char text[128];
+	refFile_t *ref = NULL;
+
+	rtcGetDateTime(&date, &time);
+	snprintf(name, sizeof(name), "FilterLog_%02d-%02d-%d_%s", date.Month, date.Date, date.Year + 2000, MATTE_BOX_HW_ID);
+	for (uint8_t i = 0; i < refCount; i++) {
+		if (strcmp(refs[i].name, name) == 0) {
+			ref = &refs[i];
+		}
+	}
+	if (ref == NULL) {
+		ref = &refs[refCount++];
+		strcpy(ref->name, name);
+		snprintf(text, sizeof(text), "Light Widow Matte Box\nMatte Box ID:,%s\nDate:,%02d-%02d-%d\nNotes:\n\n",
+				MATTE_BOX_HW_ID, date.Month, date.Date, date.Year + 2000);
+		refAppend(ref, text);
+		refAppend(ref, "Time,Filter Slot 1,Filter Slot 2,Filter Slot 3\n");
+	}
+	snprintf(text, sizeof(text), "%02d:%02d:%02d,%s,%s,%s\n", time.Hours, time.Minutes, time.Seconds,
+			section.filter[0].filterName, section.filter[1].filterName, section.filter[2].filterName);
+	refAppend(ref, text);
+}
+
+// A file deleted on a PC, the old logger would have started it over
+static void refForget(const char *name) {
+	for (uint8_t i = 0; i < refCount; i++) {
+		if (strncmp(refs[i].name, name, strlen(name)) == 0) {
+			refs[i] = refs[--refCount];
+			memset(&refs[refCount], 0, sizeof(refFile_t));
+		}
+	}
+}
+
+/********************************************************************************
+ * The box
+ *******************************************************************************/
+static void runFor(uint32_t ms) {
+	while (ms > 0) {
+		uint32_t step = (ms < LOOP_MS) ? ms : LOOP_MS;
+
+		hostAdvanceMs(step);
+		dataLoggerProcess();
+		ms -= step;
+	}
+}
+
+// One slot gets another filter, logged like filterMachine does
+static void filterChange(void) {
+	uint8_t slot = rand() % FILTER_SECTION_SIZE;
+
+	memset(section.filter[slot].filterName, 0, sizeof(section.filter[slot].filterName));
+	strcpy((char *) section.filter[slot].filterName, names[rand() % (sizeof(names) / sizeof(names[0]))]);
+	SDDataLog(&section);
+	rows++;
+	// Without a card the logger is shut down, the old one didn't log either
+	if (cardInserted) {
+		refRow();
+	}
+}
+
+// Filter changes gapMin..gapMax seconds apart
+static void changes(uint32_t count, uint32_t gapMin, uint32_t gapMax) {
+	for (uint32_t i = 0; i < count; i++) {
+		runFor((gapMin + rand() % (gapMax - gapMin + 1)) * 1000U);
+		filterChange();
+	}
+}
+
+static void cardOut(void) {
+	hostSetCard(false);
+	cardInserted = false;
+	dataLoggerDeInit();
+}
+
+static void cardIn(uint8_t card) {
+	ramDiskSelect(card);
+	hostSetCard(true);
+	cardInserted = true;
+	dataLoggerInit(SDIO_POWER_GPIO_Port, SDIO_POWER_Pin);
+}
+
+static void boot(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes) {
+	hostSetDateTime(year, month, day, hours, minutes, 0);
+	startCycles = hostCycles();
+	cardIn(0);
+}
+
+/********************************************************************************
+ * Card contents and the report
+ *******************************************************************************/
+static void writeFile(const char *path, const void *data, size_t len) {
+	FILE *f = fopen(path, "wb");
+
+	if ((f == NULL) || (fwrite(data, 1, len, f) != len)) {
+		perror(path);
+		exit(2);
+	}
+	fclose(f);
+}
+
+// The log files of a card, read like a card reader would: SDIO powered, mounted, no logger
+static void readCard(uint8_t card) {
+	static uint8_t data[4 * 1024 * 1024];
+	char dir[300], path[600], fsPath[300];
+	FILINFO fno;
+	DIR logDir;
+	FIL fil;
+	UINT br;
+
+	if (ramDiskData(card) == NULL) {
+		return;
+	}
+	snprintf(dir, sizeof(dir), "%s/card%u", scenarioDir, card);
+	mkdir(dir, 0777);
+
+	ramDiskSelect(card);
+	hostSetCard(true);
+	hostSetPin(SDIO_POWER_GPIO_Port, SDIO_POWER_Pin, GPIO_PIN_SET);
+	if ((FatFsMount() != SD_OK) || (f_opendir(&logDir, "0:/LIGHT_WIDOW") != FR_OK)) {
+		printf("FAIL: card %u doesn't mount\n", card);
+		exit(1);
+	}
+	while ((f_readdir(&logDir, &fno) == FR_OK) && (fno.fname[0] != '\0')) {
+		snprintf(fsPath, sizeof(fsPath), "0:/LIGHT_WIDOW/%s", fno.fname);
+		if ((f_open(&fil, fsPath, FA_READ) != FR_OK) || (f_size(&fil) > sizeof(data)) ||
+				(f_read(&fil, data, f_size(&fil), &br) != FR_OK) || (br != f_size(&fil))) {
+			printf("FAIL: %s can't be read\n", fsPath);
+			exit(1);
+		}
+		f_close(&fil);
+		snprintf(path, sizeof(path), "%s/%s", dir, fno.fname);
+		writeFile(path, data, br);
+		printf("  card%u/%s %u B\n", card, fno.fname, br);
+	}
+	f_closedir(&logDir);
+	FatFsDeInit();
+}
+
+static void report(const char *what) {
+	uint64_t ms = (hostCycles() - startCycles) / HOST_CYCLES_PER_MS;
+	DL_stats stats;
+	SD_stats sd;
+
+	dataLoggerGetStats(&stats);
+	SD_GetStats(&sd);
+	printf("  %u rows over %u min, %s\n", rows, (unsigned) (ms / 60000U), what);
+	printf("  logger: %u records, %u blocks, %u dropped, %u B lost, %u writes of %u B, %u syncs, %u opens, %u power ups\n",
+			stats.records, stats.blocks, stats.dropped, stats.lost, stats.flushes, stats.bytes, stats.syncs,
+			stats.opens, stats.powerUps);
+	printf("  card: %u sectors written in %u commands, %u reads, %u errors, powered %u%% of the time\n",
+			ramDiskWritten(), sd.writes, sd.reads, sd.errors, (unsigned) (stats.poweredMs * 100ULL / ms));
+}
+
+static void writeRefs(void) {
+	char path[600];
+
+	for (uint8_t i = 0; i < refCount; i++) {
+		snprintf(path, sizeof(path), "%s/%s.csv", scenarioDir, refs[i].name);
+		writeFile(path, refs[i].csv, refs[i].len);
+		printf("  %s.csv %u B in the old layout\n", refs[i].name, (unsigned) refs[i].len);
+	}
+}
+
+/********************************************************************************
+ * Scenarios
+ *******************************************************************************/
+// A busy hour across midnight with the card out for 5 minutes, then sleep
+static void hour(void) {
+	boot(2021, 3, 14, 23, 30);
+	changes(130, 1, 17);
+	cardOut();
+	changes(30, 1, 17);
+	cardIn(0);
+	changes(230, 1, 17);
+	dataLoggerSync();
+	report("card out for 30 changes, midnight, sync");
+}
+
+// Two shooting days, the box sleeps over night
+static void days(void) {
+	boot(2021, 3, 15, 9, 0);
+	changes(195, 60, 272);
+	dataLoggerSync();
+	hostSetDateTime(2021, 3, 16, 9, 0, 0);
+	changes(195, 60, 272);
+	dataLoggerSync();
+	report("two days, sync after each");
+}
+
+// A changer running all day, the card pulled without a sync, then midnight
+static void busy(void) {
+	boot(2021, 3, 17, 2, 0);
+	changes(20000, 1, 3);
+	cardOut();
+	runFor(60000);
+	cardIn(0);
+	changes(21000, 1, 3);
+	dataLoggerSync();
+	report("pulled without sync and put back, midnight, sync");
+}
+
+// A log deleted on a PC after sleep, its blocks still fill the clusters the new file
+// reserves. The card is pulled while the new file is open.
+static void phantom(void) {
+	char path[64];
+
+	boot(2021, 3, 18, 10, 0);
+	changes(300, 5, 30);
+	dataLoggerSync();
+	cardOut();
+
+	snprintf(path, sizeof(path), "0:/LIGHT_WIDOW/FilterLog_03-18-2021_%s.lwl", MATTE_BOX_HW_ID);
+	hostSetCard(true);
+	hostSetPin(SDIO_POWER_GPIO_Port, SDIO_POWER_Pin, GPIO_PIN_SET);
+	if ((FatFsMount() != SD_OK) || (f_unlink(path) != FR_OK)) {
+		printf("FAIL: %s can't be deleted\n", path);
+	}
+	FatFsDeInit();
+	hostSetPin(SDIO_POWER_GPIO_Port, SDIO_POWER_Pin, GPIO_PIN_RESET);
+	refForget("FilterLog_03-18-2021");
+
+	cardIn(0);
+	changes(40, 5, 30);
+	hostSetCard(false);
+	report("log deleted, 40 more changes, pulled without sync");
+}
+
+// Another card put in, the block the first one got the head of is lost
+static void cardswap(void) {
+	boot(2021, 3, 19, 10, 0);
+	changes(150, 1, 10);
+	cardOut();
+	cardIn(1);
+	changes(150, 1, 10);
+	dataLoggerSync();
+	report("second card after 150 changes, sync");
+}
+
+// The card is out over midnight, the old day's records have nowhere to go
+static void daycard(void) {
+	boot(2021, 3, 20, 23, 40);
+	changes(60, 1, 10);
+	cardOut();
+	changes(240, 1, 10);
+	cardIn(0);
+	changes(30, 1, 10);
+	dataLoggerSync();
+	report("card out over midnight, sync");
+}
+
+// sdBench with records waiting, with the card pulled and with the logger shut down
+static void sdbench(void) {
+	static const DL_bench_step expected[] = {DL_BENCH_DONE, DL_BENCH_NO_CARD, DL_BENCH_NOT_READY};
+	static const char* const what[] = {"records waiting", "card pulled", "logger shut down"};
+	DL_bench bench;
+	DL_error err;
+
+	boot(2021, 3, 21, 9, 0);
+	changes(30, 1, 10);
+	for (uint8_t i = 0; i < 3; i++) {
+		if (i == 1) {
+			hostSetCard(false);
+		} else if (i == 2) {
+			cardOut();
+		}
+		err = dataLoggerBenchmark(256, &bench);
+		printf("  sdBench 256 KB, %s: %s, step %u, FRESULT %u, %u B, %u mismatches\n", what[i],
+				(err == DATALOG_OK) ? "OK" : "failed", bench.step, bench.fr, bench.bytes, bench.mismatches);
+		if (bench.step != expected[i]) {
+			printf("FAIL: sdBench, %s: stopped at step %u instead of %u\n", what[i], bench.step, expected[i]);
+		}
+	}
+	cardIn(0);
+	changes(30, 1, 10);
+	dataLoggerSync();
+	report("sdBench, pulled without sync and put back, sync");
+}
+
+static const scenario_t scenarios[] = {
+	{"hour", hour},
+	{"days", days},
+	{"busy", busy},
+	{"phantom", phantom},
+	{"cardswap", cardswap},
+	{"daycard", daycard},
+	{"sdbench", sdbench},
+};
+
+// One byte flipped in the middle of a log of the days scenario
+static void damage(void) {
+	char path[600], copy[600];
+	static uint8_t data[65536];
+	size_t len;
+	FILE *f;
+
+	snprintf(path, sizeof(path), "%s/days/card0/FilterLog_03-15-2021_%s.lwl", outDir, MATTE_BOX_HW_ID);
+	f = fopen(path, "rb");
+	if (f == NULL) {
+		perror(path);
+		exit(2);
+	}
+	len = fread(data, 1, sizeof(data), f);
+	fclose(f);
+	data[len / 2] ^= 0x10;
+
+	snprintf(scenarioDir, sizeof(scenarioDir), "%s/damaged", outDir);
+	mkdir(scenarioDir, 0777);
+	snprintf(copy, sizeof(copy), "%s/card0", scenarioDir);
+	mkdir(copy, 0777);
+	snprintf(copy, sizeof(copy), "%s/card0/FilterLog_03-15-2021_%s.lwl", scenarioDir, MATTE_BOX_HW_ID);
+	writeFile(copy, data, len);
+
+	snprintf(path, sizeof(path), "%s/days/FilterLog_03-15-2021_%s.csv", outDir, MATTE_BOX_HW_ID);
+	f = fopen(path, "rb");
+	len = (f == NULL) ? 0 : fread(data, 1, sizeof(data), f);
+	if (f != NULL) {
+		fclose(f);
+	}
+	snprintf(copy, sizeof(copy), "%s/FilterLog_03-15-2021_%s.csv", scenarioDir, MATTE_BOX_HW_ID);
+	writeFile(copy, data, len);
+	printf("damaged: byte %u of the first days log flipped\n", (unsigned) (len / 2));
+}
+
+int main(int argc, char **argv) {
+	int failures = 0;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <out dir>\n", argv[0]);
+		return 2;
+	}
+	outDir = argv[1];
+	mkdir(outDir, 0777);
+
+	for (uint8_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+		int status;
+		pid_t pid;
+
+		fflush(stdout);
+		pid = fork();
+		if (pid == 0) {
+			srand(i + 1);
+			snprintf(scenarioDir, sizeof(scenarioDir), "%s/%s", outDir, scenarios[i].name);
+			mkdir(scenarioDir, 0777);
+			printf("%s:\n", scenarios[i].name);
+			scenarios[i].run();
+			writeRefs();
+			for (uint8_t card = 0; card < RAM_DISK_CARDS; card++) {
+				readCard(card);
+			}
+			fflush(stdout);
+			_exit(0);
+		}
+		waitpid(pid, &status, 0);
+		if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+			printf("FAIL: scenario %s\n", scenarios[i].name);
+			failures++;
+		}
+	}
+	damage();
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * ram_disk.c
+ *
+ * SD_Driver of the host build: the real FatFs runs on cards held in RAM.
+ * A card answers while SDIO_POWER is on and SD_DETECT reports it inserted,
+ * every command takes simulated time like the SDIO driver waiting on the card.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ram_disk.h"
+#include "hal_stub.h"
+#include "main.h"
+#include "ff_gen_drv.h"
+#include "sd_diskio.h"
+
+static uint8_t *cards[RAM_DISK_CARDS];
+static uint8_t card = 0;
+static DSTATUS stat = STA_NOINIT;
+static SD_stats sdStats;
+static uint32_t written;
+
+static bool cardReady(void) {
+	return (HAL_GPIO_ReadPin(SD_DETECT_GPIO_Port, SD_DETECT_Pin) == GPIO_PIN_RESET) &&
+			(hostPin(SDIO_POWER_GPIO_Port, SDIO_POWER_Pin) == GPIO_PIN_SET);
+}
+
+static DSTATUS RAM_initialize(BYTE lun) {
+	(void) lun;
+	stat = STA_NOINIT;
+	if (!cardReady()) {
+		return stat;
+	}
+	if (cards[card] == NULL) {
+		// A blank card, FatFsInit formats it
+		cards[card] = calloc(RAM_DISK_SECTORS, RAM_DISK_SECTOR_SIZE);
+		if (cards[card] == NULL) {
+			return stat;
+		}
+	}
+	stat = 0;
+	return stat;
+}
+
+static DSTATUS RAM_status(BYTE lun) {
+	(void) lun;
+	return cardReady() ? stat : STA_NOINIT;
+}
+
+static DRESULT transfer(DWORD sector, UINT count, uint32_t cycles) {
+	if (!cardReady() || (stat & STA_NOINIT)) {
+		sdStats.errors++;
+		return RES_NOTRDY;
+	}
+	if ((sector >= RAM_DISK_SECTORS) || (count > RAM_DISK_SECTORS - sector)) {
+		sdStats.errors++;
+		return RES_PARERR;
+	}
+	sdStats.sectors += count;
+	sdStats.cycles += cycles;
+	sdStats.waitCycles += cycles;
+	hostAdvance(cycles);
+	return RES_OK;
+}
+
+static DRESULT RAM_read(BYTE lun, BYTE *buff, DWORD sector, UINT count) {
+	DRESULT res = transfer(sector, count, RAM_DISK_READ_CYCLES + count * RAM_DISK_SECTOR_CYCLES);
+
+	(void) lun;
+	sdStats.reads++;
+	if (res == RES_OK) {
+		memcpy(buff, &cards[card][sector * RAM_DISK_SECTOR_SIZE], count * RAM_DISK_SECTOR_SIZE);
+	}
+	return res;
+}
+
+static DRESULT RAM_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count) {
+	DRESULT res = transfer(sector, count, RAM_DISK_WRITE_CYCLES + count * RAM_DISK_SECTOR_CYCLES);
+
+	(void) lun;
+	sdStats.writes++;
+	if (res == RES_OK) {
+		written += count;
+		memcpy(&cards[card][sector * RAM_DISK_SECTOR_SIZE], buff, count * RAM_DISK_SECTOR_SIZE);
+	}
+	return res;
+}
+
+static DRESULT RAM_ioctl(BYTE lun, BYTE cmd, void *buff) {
+	(void) lun;
+	if (stat & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+
+	switch (cmd) {
+	case CTRL_SYNC:
+		return RES_OK;
+	case GET_SECTOR_COUNT:
+		*(DWORD*) buff = RAM_DISK_SECTORS;
+		return RES_OK;
+	case GET_SECTOR_SIZE:
+		*(WORD*) buff = RAM_DISK_SECTOR_SIZE;
+		return RES_OK;
+	case GET_BLOCK_SIZE:
+		*(DWORD*) buff = 1;
+		return RES_OK;
+	default:
+		return RES_PARERR;
+	}
+}
+
+const Diskio_drvTypeDef SD_Driver = {
+	RAM_initialize,
+	RAM_status,
+	RAM_read,
+	RAM_write,
+	RAM_ioctl,
+};
+
+void SD_GetStats(SD_stats *stats) {
+	*stats = sdStats;
+}
+
+void ramDiskSelect(uint8_t n) {
+	card = n % RAM_DISK_CARDS;
+	stat = STA_NOINIT;
+}
+
+uint8_t* ramDiskData(uint8_t n) {
+	return cards[n % RAM_DISK_CARDS];
+}
+
+uint32_t ramDiskWritten(void) {
+	return written;
+}
@@ -0,0 +1,28 @@
+/*
+ * ram_disk.h
+ *
+ * SD cards in RAM behind SD_Driver, see ram_disk.c
+ */
+
+#ifndef RAM_DISK_H
+#define RAM_DISK_H
+
+#include <stdint.h>
+
+#define RAM_DISK_CARDS			2
+#define RAM_DISK_SECTOR_SIZE	512U
+#define RAM_DISK_SECTORS		131072U		/* 64 MB, FatFsInit formats it FAT16						*/
+
+// Card time per command and per sector, a class 4 card on the 4-bit bus
+#define RAM_DISK_WRITE_CYCLES	(HOST_CORE_HZ / 1000U)		/* 1 ms programming					*/
+#define RAM_DISK_READ_CYCLES	(HOST_CORE_HZ / 5000U)		/* 200 us access					*/
+#define RAM_DISK_SECTOR_CYCLES	(HOST_CORE_HZ / 10000U)		/* 100 us, 5 MB/s					*/
+
+// Card in the slot from the next SD_initialize, each one starts blank
+void ramDiskSelect(uint8_t n);
+// Sectors of a card, NULL while it was never initialized
+uint8_t* ramDiskData(uint8_t n);
+// Sectors written to all cards, SD_stats only counts the commands
+uint32_t ramDiskWritten(void);
+
+#endif // RAM_DISK_H
@@ -0,0 +1,294 @@
+/*
+ * readers_test.c
+ *
+ * rfid_controller.c with ST25R391X_READER_COUNT front-ends on the RF SPI bus (3 by the
+ * Makefile). The RFAL and the ISO15693 layer below it are fakes: every reader has its own
+ * set of tags in its field, rfalSwitchInstance moves the fake to another reader. Each case
+ * runs checkFilterTags and prints the reader order and the tags it reported, make check
+ * holds them against golden/readers.txt. Checked on every call:
+ *   - the RFAL is only used on the reader platformSelectReader switched it to
+ *   - no two readers have their field on, every field is off after a round
+ *   - the primary reader is addressed again after a round
+ *
+ *     readers_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hal_stub.h"
+#include "platform.h"
+#include "rfid_controller.h"
+#include "rfal_analogConfig.h"
+#include "rfal_rf.h"
+#include "st25r3916/st25r3916_aat.h"
+#include "st25r3916/st25r3916_irq.h"
+
+#define READERS			ST25R391X_READER_COUNT
+#define FAKE_TAGS		6
+#define NAME_BLOCKS_LEN	16			/* Blocks 0 to 3, the filter name					*/
+
+typedef struct {
+	uint8_t uid[ISO15693_UID_LENGTH];
+	char name[NAME_BLOCKS_LEN + 1];
+} fakeTag_t;
+
+typedef struct {
+	uint8_t inField[FAKE_TAGS];		/* Tags this reader's antenna reaches, in inventory order	*/
+	uint8_t tagCount;
+	bool field;
+	bool selected;					/* A tag was selected since the field came on				*/
+	uint8_t inits;					/* rfalInitialize calls									*/
+	uint8_t tunes;					/* st25r3916AatTune calls								*/
+	ReturnCode initError;			/* Answer of the next rfalInitialize					*/
+	ReturnCode inventoryError;		/* Answer of the next iso15693Inventory					*/
+} fakeReader_t;
+
+static const fakeTag_t tags[FAKE_TAGS] = {
+	{{0x11, 0x30, 0x1F, 0x4E, 0x03, 0x00, 0x02, 0xE0}, "ND 0.3          "},
+	{{0x12, 0x60, 0x1F, 0x4E, 0x03, 0x00, 0x02, 0xE0}, "ND 0.6          "},
+	{{0x13, 0x90, 0x1F, 0x4E, 0x03, 0x00, 0x02, 0xE0}, "ND 0.9          "},
+	{{0x14, 0x01, 0x2C, 0x4E, 0x03, 0x00, 0x02, 0xE0}, "POLA            "},
+	{{0x15, 0x04, 0x2C, 0x4E, 0x03, 0x00, 0x02, 0xE0}, "BPM 1/4         "},
+	{{0x16, 0x08, 0x2C, 0x4E, 0x03, 0x00, 0x02, 0xE0}, "BPM 1/8         "},
+};
+
+static fakeReader_t readers[READERS];
+static uint8_t active = ST25R391X_PRIMARY_READER;	/* Reader the fake RFAL is switched to	*/
+static char order[32];								/* Readers in the order of their inventory	*/
+static uint8_t nameReads;
+static uint8_t roundNum = 0;
+static bool failed = false;
+
+static void check(bool ok, const char *what) {
+	if (!ok) {
+		printf("FAIL: round %u, %s\n", roundNum, what);
+		failed = true;
+	}
+}
+
+// Every call into the RFAL has to address the reader platformSelectReader picked
+static fakeReader_t* current(void) {
+	check(platformActiveReader == active, "the RFAL isn't switched to the active reader");
+	return &readers[active];
+}
+
+/********************************************************************************
+ * RFAL and ST25R3916 driver
+ *******************************************************************************/
+void rfalAnalogConfigInitialize(void) {
+}
+
+ReturnCode rfalInitialize(void) {
+	fakeReader_t *r = current();
+	ReturnCode err = r->initError;
+
+	r->inits++;
+	r->initError = ERR_NONE;
+	return err;
+}
+
+void rfalSwitchInstance(uint8_t from, uint8_t to) {
+	check(from == active, "rfalSwitchInstance parks another reader than the active one");
+	check(to < READERS, "rfalSwitchInstance to a reader that isn't there");
+	check(!readers[from].field, "switched away from a reader with its field on");
+	active = to;
+}
+
+ReturnCode st25r3916AatTune(const struct st25r3916AatTuneParams *tuningParams, struct st25r3916AatTuneResult *tuningStatus) {
+	(void) tuningParams;
+	(void) tuningStatus;
+	current()->tunes++;
+	return ERR_NONE;
+}
+
+ReturnCode rfalWakeUpModeStart(const rfalWakeUpConfig *config) {
+	(void) config;
+	check(current() == &readers[ST25R391X_PRIMARY_READER], "Wake-Up mode started on another reader than the primary");
+	return ERR_NONE;
+}
+
+void st25r3916Isr(void) {
+}
+
+/********************************************************************************
+ * ISO15693
+ *******************************************************************************/
+ReturnCode iso15693Initialize(bool useSlowTX, bool useFastRX) {
+	fakeReader_t *r = current();
+
+	(void) useSlowTX;
+	(void) useFastRX;
+	for (uint8_t i = 0; i < READERS; i++) {
+		check(!readers[i].field, "a field is already on");
+	}
+	r->field = true;
+	r->selected = false;
+	return ERR_NONE;
+}
+
+ReturnCode iso15693Deinitialize(uint8_t keep_on) {
+	fakeReader_t *r = current();
+
+	(void) keep_on;
+	r->field = false;
+	return ERR_NONE;
+}
+
+ReturnCode iso15693Inventory(iso15693NumSlots_t slotcnt, uint8_t maskLength, uint8_t *mask,
+		iso15693ProximityCard_t *cards, uint8_t maxCards, uint8_t *cardsFound) {
+	fakeReader_t *r = current();
+	ReturnCode err = r->inventoryError;
+	size_t len = strlen(order);
+
+	(void) slotcnt;
+	(void) maskLength;
+	(void) mask;
+	snprintf(&order[len], sizeof(order) - len, (len == 0) ? "%u" : " %u", active);
+	check(r->field, "inventory without the field on");
+
+	*cardsFound = 0;
+	r->inventoryError = ERR_NONE;
+	if (err != ERR_NONE) {
+		return err;
+	}
+	for (uint8_t i = 0; (i < r->tagCount) && (i < maxCards); i++) {
+		memset(&cards[i], 0, sizeof(iso15693ProximityCard_t));
+		memcpy(cards[i].uid, tags[r->inField[i]].uid, ISO15693_UID_LENGTH);
+		(*cardsFound)++;
+	}
+	return ERR_NONE;
+}
+
+static const fakeTag_t* findTag(const fakeReader_t *r, const uint8_t *uid) {
+	for (uint8_t i = 0; i < r->tagCount; i++) {
+		if (memcmp(tags[r->inField[i]].uid, uid, ISO15693_UID_LENGTH) == 0) {
+			return &tags[r->inField[i]];
+		}
+	}
+	return NULL;
+}
+
+ReturnCode iso15693SelectPicc(const iso15693ProximityCard_t *card) {
+	fakeReader_t *r = current();
+
+	if (findTag(r, card->uid) == NULL) {
+		check(false, "a tag outside the field is selected");
+		return ERR_TIMEOUT;
+	}
+	r->selected = true;
+	return ERR_NONE;
+}
+
+ReturnCode iso15693ReadMultipleBlocks(const iso15693ProximityCard_t *card, uint8_t startblock, uint8_t numBlocks,
+		uint8_t *res_flags, uint8_t *data, uint16_t dataLen, uint16_t *actLen) {
+	fakeReader_t *r = current();
+	const fakeTag_t *t = findTag(r, card->uid);
+
+	check(r->selected, "blocks read without a selected tag");
+	check((startblock == 0) && (numBlocks == 4) && (dataLen >= NAME_BLOCKS_LEN), "the name is read from other blocks");
+	if (t == NULL) {
+		return ERR_TIMEOUT;
+	}
+	*res_flags = 0;
+	memcpy(data, t->name, NAME_BLOCKS_LEN);
+	*actLen = NAME_BLOCKS_LEN;
+	nameReads++;
+	return ERR_NONE;
+}
+
+/********************************************************************************
+ * Rounds
+ *******************************************************************************/
+static void place(uint8_t reader, const uint8_t *tagList, uint8_t count) {
+	memcpy(readers[reader].inField, tagList, count);
+	readers[reader].tagCount = count;
+}
+
+static void runRound(const char *name) {
+	detectedTags_t dTags;
+	ReturnCode err;
+
+	roundNum++;
+	order[0] = '\0';
+	nameReads = 0;
+	memset(&dTags, 0xA5, sizeof(dTags));
+
+	err = checkFilterTags(&dTags);
+
+	printf("%-22s order %-6s error %2d, %u names read, %u tags:", name, order, err, nameReads, dTags.tagCount);
+	for (uint8_t i = 0; i < dTags.tagCount; i++) {
+		printf(" [%02X %.*s stage %u]", dTags.filterTags[i].tagUID[0], FILTER_NAME_LEN,
+				dTags.filterTags[i].tagName, dTags.filterTags[i].stage);
+	}
+	printf("\n");
+
+	check(platformActiveReader == ST25R391X_PRIMARY_READER, "the primary reader isn't addressed after the round");
+	for (uint8_t i = 0; i < READERS; i++) {
+		check(!readers[i].field, "a field is still on after the round");
+	}
+	check(dTags.tagCount <= FILTER_SECTION_SIZE, "more tags than filter stages");
+	for (uint8_t i = dTags.tagCount; i < FILTER_SECTION_SIZE; i++) {
+		check((dTags.filterTags[i].stage == 0) && (dTags.filterTags[i].tagName[0] == 0), "an unused entry isn't cleared");
+	}
+}
+
+int main(void) {
+	static const uint8_t tag0[] = {0}, tag1[] = {1}, tag2[] = {2}, tag12[] = {1, 2}, tag345[] = {3, 4, 5};
+	detectedTags_t dTags;
+
+	// Reader r covers stage r + 1, every reader gets a chip select and IRQ line of its own
+	for (uint8_t r = 0; r < READERS; r++) {
+		if (r != ST25R391X_PRIMARY_READER) {
+			platformReaders[r] = platformReaders[ST25R391X_PRIMARY_READER];
+			platformReaders[r].ssPin <<= r;
+			platformReaders[r].intPin <<= r;
+		}
+		platformReaders[r].stage = r + 1;
+	}
+
+	check(checkFilterTags(&dTags) == ERR_PARAM, "a round runs before the readers are initialized");
+	check(rfidControllerInit() == ERR_NONE, "rfidControllerInit fails");
+	for (uint8_t r = 0; r < READERS; r++) {
+		check((readers[r].inits == 1) && (readers[r].tunes == 1), "a reader isn't initialized and tuned once");
+	}
+	check(platformActiveReader == ST25R391X_PRIMARY_READER, "the primary reader isn't addressed after the init");
+
+	// One tag per stage, the starting reader moves on every round
+	place(0, tag0, 1);
+	place(1, tag1, 1);
+	place(2, tag2, 1);
+	runRound("one tag per reader");
+	runRound("one tag per reader");
+	runRound("one tag per reader");
+
+	// A tag coupled into two antennas has no stage it can be trusted for, its name is read once
+	place(2, tag12, 2);
+	runRound("tag seen twice");
+
+	// A reader without a stage of its own
+	platformReaders[1].stage = 0;
+	place(2, tag2, 1);
+	runRound("reader without stage");
+	platformReaders[1].stage = 2;
+
+	// More tags than stages, the first FILTER_SECTION_SIZE are kept
+	place(0, tag345, 3);
+	runRound("more tags than stages");
+	place(0, tag0, 1);
+
+	// A reader failing its inventory fails the whole round, no partial result
+	readers[2].inventoryError = ERR_IO;
+	runRound("failed inventory");
+	runRound("after the failure");
+
+	check(startWakeUpMode() == ERR_NONE, "startWakeUpMode fails");
+
+	// A reader failing its init leaves the controller uninitialized
+	readers[1].initError = ERR_SYSTEM;
+	check(rfidControllerInit() == ERR_SYSTEM, "a failed rfalInitialize isn't reported");
+	check(platformActiveReader == ST25R391X_PRIMARY_READER, "the primary reader isn't addressed after a failed init");
+	check(checkFilterTags(&dTags) == ERR_PARAM, "a round runs after a failed init");
+
+	return failed ? 1 : 0;
+}
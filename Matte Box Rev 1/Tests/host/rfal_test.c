@@ -0,0 +1,308 @@
+/*
+ * rfal_test.c
+ *
+ * rfal_crc.c and rfal_iso15693_2.c on repeatable pseudo random input. The Makefile builds
+ * it with the table switches of platform.h off and on (RFAL_FEATURE_CRC_TABLE and
+ * RFAL_FEATURE_NFCV_PHY_TABLE both 0 or both 1):
+ *   - without arguments every case is run and a digest of each group is printed. Both
+ *     builds have to print the same, make check holds them against golden/rfal.txt
+ *   - with a run count the CRC, the 1 of 4 coding and the decoding of one inventory
+ *     response are timed on the host clock, the fastest run of each is kept (make bench)
+ *
+ *     rfal_test [runs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hal_stub.h"
+#include "rfal_crc.h"
+#include "rfal_iso15693_2.h"
+
+#define CASES			2000
+#define FRAME_MAX		40			/* Bytes of a coded request, CRC not included	*/
+#define RESPONSE_MAX	32			/* Bytes of a decoded response, CRC included	*/
+#define STREAM_MAX		(1 + (RESPONSE_MAX * 16 + 10 + 7) / 8 + 2)
+
+typedef struct {
+	const char *name;
+	uint32_t digest;
+} group_t;
+
+static uint32_t rng = 0x1569;
+
+// xorshift32, the same sequence on every build
+static uint32_t nextRandom(void) {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static void fillRandom(uint8_t *buf, uint16_t len) {
+	for (uint16_t i = 0; i < len; i++) {
+		buf[i] = nextRandom();
+	}
+}
+
+// FNV-1a, independent of the CRC under test
+static void digestBytes(group_t *g, const void *data, size_t len) {
+	const uint8_t *p = data;
+
+	for (size_t i = 0; i < len; i++) {
+		g->digest = (g->digest ^ p[i]) * 16777619U;
+	}
+}
+
+static void digestValue(group_t *g, uint32_t value) {
+	digestBytes(g, &value, sizeof(value));
+}
+
+static void printGroup(const group_t *g, const char *counts) {
+	printf("%-10s %s, digest %08x\n", g->name, counts, g->digest);
+}
+
+/********************************************************************************
+ * The tag side of a response: SOF, manchester pairs LSB first, EOF
+ *******************************************************************************/
+static uint8_t getBit(const uint8_t *stream, uint16_t pos) {
+	return (stream[pos / 8] >> (pos % 8)) & 1;
+}
+
+static void setBit(uint8_t *stream, uint16_t pos, uint8_t bit) {
+	stream[pos / 8] = (stream[pos / 8] & ~(1U << (pos % 8))) | ((bit & 1) << (pos % 8));
+}
+
+static void putBit(uint8_t *stream, uint16_t *pos, uint8_t bit) {
+	setBit(stream, (*pos)++, bit);
+}
+
+// The CRC as the tag appends it, ~CRC preset 0xFFFF, 0xE012 and not inverted on Picopass
+static uint16_t appendCrc(uint8_t *frame, uint16_t len, bool picopass) {
+	uint16_t crc = rfalCrcCalculateCcitt(picopass ? 0xE012U : 0xFFFFU, frame, len);
+
+	crc = picopass ? crc : (uint16_t) ~crc;
+	frame[len] = crc & 0xFF;
+	frame[len + 1] = crc >> 8;
+	return len + 2;
+}
+
+static uint16_t encodeResponse(const uint8_t *frame, uint16_t len, uint8_t *stream) {
+	static const uint8_t sof[5] = {1, 1, 1, 0, 1};
+	static const uint8_t eof[8] = {1, 0, 1, 1, 1, 0, 0, 0};
+	uint16_t pos = 0;
+
+	memset(stream, 0, STREAM_MAX);
+	for (uint8_t i = 0; i < sizeof(sof); i++) {
+		putBit(stream, &pos, sof[i]);
+	}
+	for (uint16_t i = 0; i < len * 8; i++) {
+		uint8_t bit = (frame[i / 8] >> (i % 8)) & 1;
+
+		putBit(stream, &pos, !bit);
+		putBit(stream, &pos, bit);
+	}
+	for (uint8_t i = 0; i < sizeof(eof); i++) {
+		putBit(stream, &pos, eof[i]);
+	}
+	return (pos + 7) / 8 + 1;
+}
+
+/********************************************************************************
+ * Cases
+ *******************************************************************************/
+static void crcCases(void) {
+	static const uint16_t presets[] = {0xFFFF, 0xE012, 0x0000};
+	group_t g = {"crc", 2166136261U};
+	uint8_t buf[300];
+	uint32_t bytes = 0;
+
+	for (uint16_t i = 0; i < CASES; i++) {
+		uint16_t len = nextRandom() % sizeof(buf);
+		uint16_t preset = (i < 3 * 16) ? presets[i % 3] : nextRandom();
+
+		fillRandom(buf, len);
+		digestValue(&g, rfalCrcCalculateCcitt(preset, buf, len));
+		bytes += len;
+	}
+
+	char counts[64];
+	snprintf(counts, sizeof(counts), "%u buffers of %u B", CASES, (unsigned) bytes);
+	printGroup(&g, counts);
+}
+
+// A request coded in one call, or piece by piece into a small buffer until it is done
+static void codeCases(iso15693VcdCoding_t coding, const char *name) {
+	iso15693PhyConfig_t config = {coding, 0};
+	const struct iso15693StreamConfig *stream;
+	group_t g = {name, 2166136261U};
+	uint8_t frame[FRAME_MAX];
+	uint8_t out[1 + (FRAME_MAX + 2) * 64 + 1];
+	uint32_t calls = 0, coded = 0;
+
+	iso15693PhyConfigure(&config, &stream);
+	for (uint16_t i = 0; i < CASES / 4; i++) {
+		uint16_t len = nextRandom() % FRAME_MAX;
+		bool sendCrc = nextRandom() & 1;
+		bool sendFlags = nextRandom() & 1;
+		bool picopass = (len > 1) && ((nextRandom() % 8) == 0);
+		uint16_t chunk = (nextRandom() & 1) ? sizeof(out) : 65 + nextRandom() % 64;
+		uint16_t total, offset = 0, actLen, outLen = 0;
+		ReturnCode err;
+
+		fillRandom(frame, len);
+		do {
+			err = iso15693VCDCode(frame, len, sendCrc, sendFlags, picopass, &total, &offset,
+					&out[outLen], (chunk < sizeof(out) - outLen) ? chunk : sizeof(out) - outLen, &actLen);
+			outLen += actLen;
+			calls++;
+		} while (err == ERR_AGAIN);
+
+		digestValue(&g, err);
+		digestValue(&g, total);
+		digestBytes(&g, frame, len);
+		digestBytes(&g, out, outLen);
+		coded += outLen;
+	}
+
+	config.coding = ISO15693_VCD_CODING_1_4;
+	iso15693PhyConfigure(&config, &stream);
+
+	char counts[64];
+	snprintf(counts, sizeof(counts), "%u requests in %u calls, %u B coded", CASES / 4, (unsigned) calls, (unsigned) coded);
+	printGroup(&g, counts);
+}
+
+// Clean responses, a collision, a flipped bit, a cut stream, a short output buffer
+static void decodeCases(void) {
+	group_t g = {"decode", 2166136261U};
+	uint8_t frame[RESPONSE_MAX + 2];
+	uint8_t stream[STREAM_MAX];
+	uint8_t out[RESPONSE_MAX + 2];
+	uint32_t ok = 0, crc = 0, collision = 0, other = 0;
+
+	for (uint16_t i = 0; i < CASES; i++) {
+		uint16_t len = 1 + nextRandom() % (RESPONSE_MAX - 2);
+		bool picopass = (nextRandom() % 8) == 0;
+		uint16_t streamLen, outLen = sizeof(out), outPos, bitsBeforeCol, ignoreBits = 0;
+		ReturnCode err;
+
+		fillRandom(frame, len);
+		len = appendCrc(frame, len, picopass);
+		streamLen = encodeResponse(frame, len, stream);
+
+		switch (i % 5) {
+			case 1: {
+				// Both halves of a pair modulated, or neither
+				uint16_t bit = nextRandom() % (len * 8);
+				uint8_t both = nextRandom() & 1;
+
+				setBit(stream, 5 + bit * 2, both);
+				setBit(stream, 5 + bit * 2 + 1, both);
+				ignoreBits = (nextRandom() & 1) ? nextRandom() % (bit + 1) : 0;
+				break;
+			}
+			case 2: {
+				// Both halves of a pair swapped, the bit turns over and the CRC fails
+				uint16_t pos = 5 + (nextRandom() % (len * 8)) * 2;
+
+				setBit(stream, pos, !getBit(stream, pos));
+				setBit(stream, pos + 1, !getBit(stream, pos + 1));
+				break;
+			}
+			case 3:
+				streamLen = 1 + nextRandom() % streamLen;
+				break;
+			case 4:
+				outLen = 1 + nextRandom() % len;
+				break;
+			default:
+				break;
+		}
+
+		err = iso15693VICCDecode(stream, streamLen, out, outLen, &outPos, &bitsBeforeCol, ignoreBits, picopass);
+		digestValue(&g, err);
+		digestValue(&g, outPos);
+		digestValue(&g, bitsBeforeCol);
+		digestBytes(&g, out, outLen);
+
+		if (err == ERR_NONE) {
+			ok++;
+		} else if (err == ERR_CRC) {
+			crc++;
+		} else if (err == ERR_RF_COLLISION) {
+			collision++;
+		} else {
+			other++;
+		}
+	}
+
+	char counts[96];
+	snprintf(counts, sizeof(counts), "%u responses: %u ok, %u CRC, %u collision, %u other",
+			CASES, (unsigned) ok, (unsigned) crc, (unsigned) collision, (unsigned) other);
+	printGroup(&g, counts);
+}
+
+/********************************************************************************
+ * Host times
+ *******************************************************************************/
+static uint32_t keepMin(uint32_t min, uint32_t cycles) {
+	return (cycles < min) ? cycles : min;
+}
+
+static int bench(uint32_t runs) {
+	iso15693PhyConfig_t config = {ISO15693_VCD_CODING_1_4, 0};
+	const struct iso15693StreamConfig *stream;
+	uint8_t buf[256], request[11], coded[1 + 13 * 4 + 1], frame[12], response[STREAM_MAX], out[12];
+	uint32_t crcBest = UINT32_MAX, codeBest = UINT32_MAX, decodeBest = UINT32_MAX;
+	volatile uint16_t sink = 0;
+
+	fillRandom(buf, sizeof(buf));
+	fillRandom(request, sizeof(request));
+	// An inventory response: flags, DSFID, UID and the CRC
+	fillRandom(frame, 10);
+	encodeResponse(frame, appendCrc(frame, 10, false), response);
+	iso15693PhyConfigure(&config, &stream);
+
+	hostRealTime(true);
+	for (uint32_t i = 0; i < runs; i++) {
+		uint16_t total, offset = 0, actLen, pos, bits;
+		uint32_t start;
+
+		start = DWT->CYCCNT;
+		sink += rfalCrcCalculateCcitt(0xFFFF, buf, sizeof(buf));
+		crcBest = keepMin(crcBest, DWT->CYCCNT - start);
+
+		start = DWT->CYCCNT;
+		iso15693VCDCode(request, sizeof(request), true, true, false, &total, &offset, coded, sizeof(coded), &actLen);
+		codeBest = keepMin(codeBest, DWT->CYCCNT - start);
+
+		start = DWT->CYCCNT;
+		if (iso15693VICCDecode(response, sizeof(response), out, sizeof(out), &pos, &bits, 0, false) != ERR_NONE) {
+			printf("FAIL: the inventory response doesn't decode\n");
+			return 1;
+		}
+		decodeBest = keepMin(decodeBest, DWT->CYCCNT - start);
+	}
+	hostRealTime(false);
+
+	printf("RFAL_FEATURE_CRC_TABLE %d, RFAL_FEATURE_NFCV_PHY_TABLE %d, fastest of %u runs:\n",
+			RFAL_FEATURE_CRC_TABLE, RFAL_FEATURE_NFCV_PHY_TABLE, runs);
+	printf("  crc      %4u B     %6u cycles %6.2f us\n", (unsigned) sizeof(buf), crcBest, crcBest / 100.0);
+	printf("  code     %4u B     %6u cycles %6.2f us\n", (unsigned) sizeof(request), codeBest, codeBest / 100.0);
+	printf("  decode   %4u B     %6u cycles %6.2f us\n", (unsigned) sizeof(frame), decodeBest, decodeBest / 100.0);
+	return 0;
+}
+
+int main(int argc, char **argv) {
+	if (argc > 1) {
+		return bench(strtoul(argv[1], NULL, 10));
+	}
+
+	crcCases();
+	codeCases(ISO15693_VCD_CODING_1_4, "code 1of4");
+	codeCases(ISO15693_VCD_CODING_1_256, "code 1of256");
+	decodeCases();
+	return 0;
+}
@@ -0,0 +1,363 @@
+/*
+ * spi_trace_test.c
+ *
+ * The SPI trace of spi.c (PLATFORM_SPI_TRACE 1) under st25r3916_com.c and st25r3916_irq.c.
+ * A register model of the ST25R3916 answers on the bus. One script of register, space B,
+ * test register, FIFO and direct command accesses with an IRQ in the middle is:
+ *   - recorded against the model, the register traffic is printed, make check holds it
+ *     against golden/spi_trace.txt
+ *   - loaded again in spiLoad pieces and replayed with the bus idle, the script has to read
+ *     back the same values, the IRQ has to be raised at the recorded point
+ *   - replayed with one written value changed (one mismatch) and with one transfer more
+ *     than recorded (exhausted, the transfer goes out on the bus)
+ *
+ *     spi_trace_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hal_stub.h"
+#include "main.h"
+#include "platform.h"
+#include "st25r3916/st25r3916.h"
+#include "st25r3916/st25r3916_com.h"
+#include "st25r3916/st25r3916_irq.h"
+
+#define CHIP_IC_IDENTITY	0x2AU		/* ic_type 00101, ic_rev 010						*/
+#define CHIP_REGS			64U
+#define RESULT_MAX			64U
+#define LISTING_MAX			8192U
+
+// Inventory request and the answer of the tag the model plays
+static const uint8_t request[] = {0x26, 0x01, 0x00};
+static const uint8_t answer[] = {0x00, 0x00, 0x2B, 0x5C, 0x1F, 0x4E, 0x03, 0x00, 0x07, 0xE0, 0x4F, 0x8A};
+
+typedef struct {
+	uint8_t regA[CHIP_REGS];
+	uint8_t regB[CHIP_REGS];
+	uint8_t test[CHIP_REGS];
+	uint8_t fifo[ST25R3916_FIFO_DEPTH];
+	uint16_t fifoLen;
+	uint32_t transfers;			/* Transactions seen on the bus					*/
+	bool listing;				/* Print every transaction to listing			*/
+} chip_t;
+
+typedef struct {
+	uint8_t data[RESULT_MAX];
+	uint16_t len;
+} result_t;
+
+static chip_t chip;
+static char listing[LISTING_MAX];
+static uint16_t listingLen;
+static bool failed = false;
+
+static SPI_HandleTypeDef rfSpi = {.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8};
+static SPI_TypeDef spiRegs;
+
+// The reader table of rfid_controller.c, one reader
+platformReader_t platformReaders[ST25R391X_READER_COUNT] = {
+	{ RF_SPI_BSS_GPIO_Port, RF_SPI_BSS_Pin, RF_IRQ_GPIO_Port, RF_IRQ_Pin, RF_IRQ_EXTI_IRQn, 0, 0 },
+};
+
+uint8_t platformActiveReader = ST25R391X_PRIMARY_READER;
+
+static void check(bool ok, const char *what) {
+	if (!ok) {
+		printf("FAIL: %s\n", what);
+		failed = true;
+	}
+}
+
+/********************************************************************************
+ * ST25R3916 model: register spaces A, B and test, the FIFO, the IRQ line
+ *******************************************************************************/
+static void listBytes(char *line, size_t size, const uint8_t *data, uint16_t len) {
+	size_t pos = strlen(line);
+
+	for (uint16_t i = 0; (i < len) && (pos + 4 < size); i++) {
+		pos += snprintf(&line[pos], size - pos, " %02X", data[i]);
+	}
+}
+
+// The line is asserted while an unmasked interrupt is pending
+static void chipUpdateIrq(void) {
+	bool high = false;
+
+	for (uint8_t i = 0; i < 4; i++) {
+		high |= (chip.regA[ST25R3916_REG_IRQ_MAIN + i] & ~chip.regA[ST25R3916_REG_IRQ_MASK_MAIN + i]) != 0;
+	}
+	hostSetPin(RF_IRQ_GPIO_Port, RF_IRQ_Pin, high ? GPIO_PIN_SET : GPIO_PIN_RESET);
+	if (high) {
+		hostRaiseIrq(RF_IRQ_EXTI_IRQn);
+	}
+}
+
+static void chipReset(void) {
+	memset(chip.regA, 0, sizeof(chip.regA));
+	memset(chip.regB, 0, sizeof(chip.regB));
+	memset(chip.test, 0, sizeof(chip.test));
+	chip.regA[ST25R3916_REG_IC_IDENTITY] = CHIP_IC_IDENTITY;
+	memset(&chip.regA[ST25R3916_REG_IRQ_MASK_MAIN], 0xFF, 4);
+	chip.fifoLen = 0;
+}
+
+static void chipFifoStatus(void) {
+	chip.regA[ST25R3916_REG_FIFO_STATUS1] = chip.fifoLen & 0xFFU;
+	chip.regA[ST25R3916_REG_FIFO_STATUS2] = (chip.fifoLen >> 8) << 6;
+}
+
+// Transmit with CRC: the tag answers right away, end of transmit and end of receive
+static void chipCommand(uint8_t cmd) {
+	switch (cmd) {
+		case ST25R3916_CMD_SET_DEFAULT:
+			chipReset();
+			break;
+		case ST25R3916_CMD_CLEAR_FIFO:
+			chip.fifoLen = 0;
+			break;
+		case ST25R3916_CMD_TRANSMIT_WITH_CRC:
+			if ((chip.fifoLen == sizeof(request)) && (memcmp(chip.fifo, request, sizeof(request)) == 0)) {
+				memcpy(chip.fifo, answer, sizeof(answer));
+				chip.fifoLen = sizeof(answer);
+				chip.regA[ST25R3916_REG_IRQ_MAIN] |= ST25R3916_IRQ_MASK_TXE | ST25R3916_IRQ_MASK_RXS | ST25R3916_IRQ_MASK_RXE;
+			} else {
+				chip.fifoLen = 0;
+				chip.regA[ST25R3916_REG_IRQ_MAIN] |= ST25R3916_IRQ_MASK_TXE;
+			}
+			break;
+		default:
+			break;
+	}
+	chipFifoStatus();
+}
+
+static void chipRespond(SPI_HandleTypeDef *hspi, const uint8_t *tx, uint8_t *rx, uint16_t size) {
+	char line[160];
+	uint8_t *regs = chip.regA;
+	const char *space = "  ";
+	uint16_t pos = 0;
+	uint8_t op, addr;
+
+	(void) hspi;
+	chip.transfers++;
+	if ((size > 1) && (tx[0] == ST25R3916_CMD_SPACE_B_ACCESS)) {
+		regs = chip.regB;
+		space = "B ";
+		pos = 1;
+	} else if ((size > 1) && (tx[0] == ST25R3916_CMD_TEST_ACCESS)) {
+		regs = chip.test;
+		space = "T ";
+		pos = 1;
+	}
+	op = tx[pos++];
+	addr = op & 0x3FU;
+
+	if ((op & 0xC0U) == 0x00U) {
+		snprintf(line, sizeof(line), "write  %s%02X:", space, addr);
+		listBytes(line, sizeof(line), &tx[pos], size - pos);
+		for (uint16_t i = pos; i < size; i++) {
+			regs[(addr + i - pos) % CHIP_REGS] = tx[i];
+		}
+	} else if ((op & 0xC0U) == 0x40U) {
+		for (uint16_t i = pos; i < size; i++) {
+			uint8_t reg = (addr + i - pos) % CHIP_REGS;
+
+			rx[i] = regs[reg];
+			// The interrupt registers clear on read
+			if ((regs == chip.regA) && (reg >= ST25R3916_REG_IRQ_MAIN) && (reg <= ST25R3916_REG_IRQ_TARGET)) {
+				regs[reg] = 0;
+			}
+		}
+		snprintf(line, sizeof(line), "read   %s%02X:", space, addr);
+		listBytes(line, sizeof(line), &rx[pos], size - pos);
+	} else if (op == 0x80U) {
+		uint16_t n = size - pos;
+
+		n = (n > (ST25R3916_FIFO_DEPTH - chip.fifoLen)) ? (ST25R3916_FIFO_DEPTH - chip.fifoLen) : n;
+		memcpy(&chip.fifo[chip.fifoLen], &tx[pos], n);
+		chip.fifoLen += n;
+		chipFifoStatus();
+		snprintf(line, sizeof(line), "fifo <-    ");
+		listBytes(line, sizeof(line), &tx[pos], size - pos);
+	} else if (op == 0x9FU) {
+		uint16_t n = size - pos;
+
+		n = (n > chip.fifoLen) ? chip.fifoLen : n;
+		memcpy(&rx[pos], chip.fifo, n);
+		memmove(chip.fifo, &chip.fifo[n], chip.fifoLen - n);
+		chip.fifoLen -= n;
+		chipFifoStatus();
+		snprintf(line, sizeof(line), "fifo ->    ");
+		listBytes(line, sizeof(line), &rx[pos], size - pos);
+	} else if ((op & 0xC0U) == 0xC0U) {
+		snprintf(line, sizeof(line), "command %02X", op);
+		chipCommand(op);
+	} else {
+		snprintf(line, sizeof(line), "unknown   ");
+		listBytes(line, sizeof(line), tx, size);
+	}
+
+	if (chip.listing) {
+		listingLen += snprintf(&listing[listingLen], LISTING_MAX - listingLen, "%4u %s %s\n",
+				(unsigned) chip.transfers, (hostIpsr() != 0) ? "isr" : "   ", line);
+	}
+	chipUpdateIrq();
+}
+
+// EXTI4_IRQHandler, rfidReaderIrq of rfid_controller.c
+static void rfIrqHandler(void) {
+	if (spiTraceGetMode() == SPI_TRACE_REPLAY) {
+		return;
+	}
+	st25r3916Isr();
+}
+
+/********************************************************************************
+ * The script, every value the driver hands back goes to the result
+ *******************************************************************************/
+static void keep(result_t *r, const uint8_t *data, uint16_t len) {
+	for (uint16_t i = 0; (i < len) && (r->len < RESULT_MAX); i++) {
+		r->data[r->len++] = data[i];
+	}
+}
+
+static void runScript(result_t *r, uint8_t opControl, bool extraRead) {
+	uint8_t buf[sizeof(answer)], val;
+	uint32_t irqs;
+
+	memset(r, 0, sizeof(result_t));
+	st25r3916InitInterrupts();
+
+	st25r3916ExecuteCommand(ST25R3916_CMD_SET_DEFAULT);
+	st25r3916ReadRegister(ST25R3916_REG_IC_IDENTITY, &val);
+	keep(r, &val, 1);
+
+	// Read-modify-write, the last one finds nothing to change and doesn't write
+	st25r3916WriteRegister(ST25R3916_REG_OP_CONTROL, opControl);
+	st25r3916TxRxOn();
+	st25r3916ModifyRegister(ST25R3916_REG_MODE, ST25R3916_REG_MODE_om_mask, ST25R3916_REG_MODE_om_subcarrier_stream);
+	st25r3916ChangeRegisterBits(ST25R3916_REG_MODE, ST25R3916_REG_MODE_om_mask, ST25R3916_REG_MODE_om_subcarrier_stream);
+	val = st25r3916IsTxEnabled();
+	keep(r, &val, 1);
+
+	st25r3916WriteRegister(ST25R3916_REG_EMD_SUP_CONF, ST25R3916_REG_EMD_SUP_CONF_emd_emv_on | 0x0AU);
+	st25r3916ChangeRegisterBits(ST25R3916_REG_AUX_MOD, ST25R3916_REG_AUX_MOD_lm_dri, ST25R3916_REG_AUX_MOD_lm_dri);
+	st25r3916ReadRegister(ST25R3916_REG_EMD_SUP_CONF, &val);
+	keep(r, &val, 1);
+
+	st25r3916WriteTestRegister(0x01U, 0x0AU);
+	st25r3916ChangeTestRegisterBits(0x01U, 0x07U, 0x04U);
+	st25r3916ReadTestRegister(0x01U, &val);
+	keep(r, &val, 1);
+
+	// One inventory, the answer raises the IRQ
+	st25r3916DisableInterrupts(ST25R3916_IRQ_MASK_ALL);
+	st25r3916EnableInterrupts(ST25R3916_IRQ_MASK_TXE | ST25R3916_IRQ_MASK_RXE);
+	st25r3916ClearInterrupts();
+	st25r3916ExecuteCommand(ST25R3916_CMD_CLEAR_FIFO);
+	st25r3916WriteFifo(request, sizeof(request));
+	st25r3916ExecuteCommand(ST25R3916_CMD_TRANSMIT_WITH_CRC);
+
+	irqs = st25r3916WaitForInterruptsTimed(ST25R3916_IRQ_MASK_TXE | ST25R3916_IRQ_MASK_RXE, 5);
+	keep(r, (const uint8_t *) &irqs, sizeof(irqs));
+	st25r3916ReadMultipleRegisters(ST25R3916_REG_FIFO_STATUS1, buf, 2);
+	keep(r, buf, 2);
+	st25r3916ReadFifo(buf, buf[0]);
+	keep(r, buf, sizeof(answer));
+
+	st25r3916ClrRegisterBits(ST25R3916_REG_OP_CONTROL, ST25R3916_REG_OP_CONTROL_en | ST25R3916_REG_OP_CONTROL_rx_en | ST25R3916_REG_OP_CONTROL_tx_en);
+
+	if (extraRead) {
+		st25r3916ReadRegister(ST25R3916_REG_IC_IDENTITY, &val);
+		keep(r, &val, 1);
+	}
+}
+
+/********************************************************************************
+ * Record and replays
+ *******************************************************************************/
+// The trace goes through spiTraceLoad in the pieces the spiLoad CLI command hands over
+static void loadTrace(const uint8_t *trace, uint16_t len) {
+	for (uint16_t pos = 0; pos < len; pos += SPI_TRACE_LOAD_LEN) {
+		uint16_t n = len - pos;
+
+		n = (n < SPI_TRACE_LOAD_LEN) ? n : SPI_TRACE_LOAD_LEN;
+		check(spiTraceLoad(pos, &trace[pos], n), "a trace piece doesn't load");
+	}
+	check(!spiTraceLoad(len + 1, trace, 1), "a piece past the end of the trace loads");
+}
+
+static void printStats(const char *name, const spiTraceStats_t *s, uint32_t bus) {
+	printf("%-10s %3u transfers, %4u B, %6u cycles, %u on the bus, %u mismatches, %u exhausted\n", name,
+			(unsigned) s->transactions, (unsigned) s->bytes, (unsigned) s->cycles, (unsigned) bus,
+			(unsigned) s->mismatches, (unsigned) s->exhausted);
+}
+
+int main(void) {
+	static uint8_t trace[SPI_TRACE_BUF_LEN];
+	const uint8_t *data;
+	uint16_t traceLen, count;
+	result_t recorded, replayed;
+	spiTraceStats_t s;
+
+	hostSpiRespond(chipRespond);
+	hostIrqHandler(RF_IRQ_EXTI_IRQn, rfIrqHandler);
+	// spiInit sets SPE in the registers of the instance, a host copy takes that
+	rfSpi.Instance = &spiRegs;
+	spiInit(&rfSpi);
+	rfSpi.Instance = SPI1;
+	NVIC_EnableIRQ(RF_IRQ_EXTI_IRQn);
+
+	// Record against the model
+	chipReset();
+	chip.listing = true;
+	spiTraceRecord();
+	runScript(&recorded, ST25R3916_REG_OP_CONTROL_en, false);
+	spiTraceStop();
+	chip.listing = false;
+	s = *spiTraceGetStats();
+	data = spiTraceData(&traceLen);
+	memcpy(trace, data, traceLen);
+	count = spiTraceCount();
+
+	fputs(listing, stdout);
+	printStats("record", &s, chip.transfers);
+	check((s.transactions == chip.transfers) && (count == chip.transfers) && (s.dropped == 0), "the recording lost transfers");
+	check(memcmp(&recorded.data[recorded.len - sizeof(answer)], answer, sizeof(answer)) == 0, "the model's answer doesn't reach the script");
+
+	// Replay with the bus idle, a reset model answers something else if it is asked
+	chipReset();
+	chip.transfers = 0;
+	loadTrace(trace, traceLen);
+	spiTraceReplay();
+	check(spiTraceCount() == count, "the loaded trace holds a different number of transfers");
+	runScript(&replayed, ST25R3916_REG_OP_CONTROL_en, false);
+	s = *spiTraceGetStats();
+	printStats("replay", &s, chip.transfers);
+	check((s.mismatches == 0) && (s.exhausted == 0) && (chip.transfers == 0), "the replay differs from the recording");
+	check(spiTraceReplayed() == count, "the replay didn't use the whole trace");
+	check((replayed.len == recorded.len) && (memcmp(replayed.data, recorded.data, recorded.len) == 0),
+			"the replay hands the script other values than the recording");
+	spiTraceStop();
+
+	// A changed write is found, the rest of the script still sees the recorded values
+	spiTraceReplay();
+	runScript(&replayed, ST25R3916_REG_OP_CONTROL_en | ST25R3916_REG_OP_CONTROL_tx_en, false);
+	s = *spiTraceGetStats();
+	printStats("changed", &s, chip.transfers);
+	check((s.mismatches == 1) && (s.exhausted == 0), "the changed write isn't the one mismatch");
+	spiTraceStop();
+
+	// One transfer more than recorded goes out on the bus
+	spiTraceReplay();
+	runScript(&replayed, ST25R3916_REG_OP_CONTROL_en, true);
+	s = *spiTraceGetStats();
+	printStats("extra", &s, chip.transfers);
+	check((s.mismatches == 0) && (s.exhausted == 1) && (chip.transfers == 1), "the extra transfer isn't sent on the bus");
+	check(spiTraceGetMode() == SPI_TRACE_OFF, "the replay doesn't stop at the end of the trace");
+	check(replayed.data[replayed.len - 1] == CHIP_IC_IDENTITY, "the extra transfer isn't answered by the bus");
+
+	return failed ? 1 : 0;
+}
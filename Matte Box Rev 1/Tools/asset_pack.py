@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""Generate the display asset pack (Core/Light_Widow/EPD/src/assets_packed.c).
+
+Fonts: the glyphs of the ST fonts, rotated the same way as fonts_rotated.c
+(Tools/font_rotate.py), reduced to the characters of CHARSETS. Every glyph is
+cut down to the box around its set pixels and stored as
+    3 bytes, little endian: bits 0-4 first column, 5-9 columns,
+                            10-14 first column bit, 15-19 bits per column
+    the box, column by column, bits per column bits each, LSB first
+A glyph without pixels, or left out of the charset, takes no bytes. Index[c]
+to Index[c + 1] are the bytes of character ' ' + c.
+
+Images: the 1 bpp frame images of LW_Logo.h, PackBits compressed
+(n = 0..127: n + 1 literal bytes follow, n = -1..-127: the next byte 1 - n times).
+
+With FONT_ASSET_PACK (fonts.h) the firmware draws the text from the pack only and
+the linker drops the ST tables and fonts_rotated.c. The byte counts of both are
+printed, Tests/host "make sizes" measures them in a linked build. The output is
+unpacked and compared with the sources before it is written.
+
+    python3 Tools/asset_pack.py                        # ROTATE_90, check and write assets_packed.c
+    python3 Tools/asset_pack.py --rotate 270           # match CANVAS_FONT_ROTATE
+    python3 Tools/asset_pack.py --charset Font24 "0123456789 ."   # keep only these glyphs
+    python3 Tools/asset_pack.py -o /tmp/pack.c         # check and write somewhere else
+    python3 Tools/asset_pack.py --check                # check only, compare with the file on disk
+"""
+
+import argparse
+import os
+import re
+import sys
+
+import font_rotate
+from font_rotate import FONTS, SRC, FIRST_CHAR, CHAR_COUNT
+
+OUT = os.path.join(SRC, "assets_packed.c")
+LOGO = os.path.join(SRC, "..", "inc", "LW_Logo.h")
+
+# Characters kept per font. Filter names are free text on the tags and any font may
+# show them (canvas_ComputeLayout), so all of them keep the printable set
+PRINTABLE = "".join(chr(c) for c in range(FIRST_CHAR, FIRST_CHAR + CHAR_COUNT))
+CHARSETS = {name: PRINTABLE for name in FONTS}
+
+# LW_Logo.h array, packed name, width, height
+IMAGES = (
+    ("image_data_LightWidowLogo", "Image_LightWidowLogo", 200, 96),
+    ("image_data_SpiderLogo", "Image_SpiderLogo", 200, 96),
+    ("image_background", "Image_Background", 200, 96),
+)
+
+
+def column_bits(glyph):
+    return [sum(v << (8 * b) for b, v in enumerate(col)) for col in glyph]
+
+
+def pack_glyph(glyph):
+    cols = column_bits(glyph)
+    used = [i for i, v in enumerate(cols) if v]
+    if not used:
+        return []
+
+    x0, ncols = used[0], used[-1] - used[0] + 1
+    union = 0
+    for v in cols:
+        union |= v
+    k0 = (union & -union).bit_length() - 1
+    rows = union.bit_length() - k0
+
+    out = [x0 | (ncols << 5) | (k0 << 10) | (rows << 15)]
+    out = [out[0] & 0xff, (out[0] >> 8) & 0xff, out[0] >> 16]
+    acc, have = 0, 0
+    for v in cols[x0:x0 + ncols]:
+        acc |= ((v >> k0) & ((1 << rows) - 1)) << have
+        have += rows
+        while have >= 8:
+            out.append(acc & 0xff)
+            acc >>= 8
+            have -= 8
+    if have:
+        out.append(acc)
+    return out
+
+
+def unpack_glyph(data, width):
+    # Same steps as canvas_UnpackGlyph
+    cols = [0] * width
+    if not data:
+        return cols
+    box = data[0] | (data[1] << 8) | (data[2] << 16)
+    x0, ncols, k0, rows = box & 0x1f, (box >> 5) & 0x1f, (box >> 10) & 0x1f, (box >> 15) & 0x1f
+    acc, have, p = 0, 0, 3
+    for i in range(x0, x0 + ncols):
+        while have < rows:
+            acc |= data[p] << have
+            p += 1
+            have += 8
+        cols[i] = (acc & ((1 << rows) - 1)) << k0
+        acc >>= rows
+        have -= rows
+    if p != len(data):
+        sys.exit("glyph record of %d bytes, %d used" % (len(data), p))
+    return cols
+
+
+def pack_font(name, rot, charset):
+    font = font_rotate.load_font(name)
+    width, height, _ = font
+    if width > 31:
+        sys.exit("%s: the glyph box holds up to 31 columns" % name)
+
+    glyphs = font_rotate.rotate(font, rot)
+    font_rotate.check(font, glyphs, rot)
+
+    index, data, records = [], [], []
+    for c, glyph in enumerate(glyphs):
+        record = pack_glyph(glyph) if chr(c + FIRST_CHAR) in charset else []
+        index.append(len(data))
+        records.append(record)
+        data += record
+    index.append(len(data))
+    if len(data) > 0xffff:
+        sys.exit("%s: %d bytes don't fit the 16 bit index" % (name, len(data)))
+
+    for c, glyph in enumerate(glyphs):
+        expect = column_bits(glyph) if chr(c + FIRST_CHAR) in charset else [0] * width
+        if unpack_glyph(data[index[c]:index[c + 1]], width) != expect:
+            sys.exit("%s: char 0x%02x doesn't unpack" % (name, c + FIRST_CHAR))
+
+    rotated = CHAR_COUNT * width * ((height + 7) // 8)
+    return font, index, records, rotated
+
+
+def packbits(src):
+    out = []
+    i = 0
+    while i < len(src):
+        run = 1
+        while i + run < len(src) and run < 128 and src[i + run] == src[i]:
+            run += 1
+        if run > 1:
+            out += [(1 - run) & 0xff, src[i]]
+            i += run
+            continue
+        start = i
+        while i < len(src) and i - start < 128 and not (i + 1 < len(src) and src[i + 1] == src[i]):
+            i += 1
+        out += [i - start - 1] + src[start:i]
+    return out
+
+
+def unpackbits(src):
+    out = []
+    i = 0
+    while i < len(src):
+        n = src[i] - 256 if src[i] > 127 else src[i]
+        if n >= 0:
+            out += src[i + 1:i + 2 + n]
+            i += 2 + n
+        elif n != -128:
+            out += [src[i + 1]] * (1 - n)
+            i += 2
+        else:
+            i += 1
+    return out
+
+
+def load_images():
+    with open(LOGO) as f:
+        text = re.sub(r"/\*.*?\*/", "", f.read(), flags=re.S)
+
+    images = []
+    for source, name, width, height in IMAGES:
+        m = re.search(r"%s\s*\[\]\s*=\s*\{(.*?)\};" % source, text, re.S)
+        if m is None:
+            sys.exit("%s: %s not found" % (os.path.relpath(LOGO), source))
+        data = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", m.group(1))]
+        if width % 8 or len(data) != width * height // 8:
+            sys.exit("%s: %d bytes, expected a %d x %d frame" % (source, len(data), width, height))
+        packed = packbits(data)
+        if unpackbits(packed) != data:
+            sys.exit("%s doesn't unpack" % source)
+        images.append((name, width, height, data, packed))
+    return images
+
+
+def c_bytes(values, indent="\t"):
+    values = ["0x%02x," % v for v in values]
+    return [indent + " ".join(values[n:n + 24]) for n in range(0, len(values), 24)]
+
+
+def render(rot, fonts, images):
+    parts = [
+        "/*\n"
+        " * assets_packed.c\n"
+        " *\n"
+        " *  Subset and packed glyphs of the ST fonts, PackBits compressed frame images.\n"
+        " *  Generated by Tools/asset_pack.py, do not edit.\n"
+        " */\n",
+        "#include \"fonts.h\"\n#include \"epd_gfx.h\"\n",
+        "#if CANVAS_FONT_ROTATE != ROTATE_%d\n"
+        "#error \"assets_packed.c was generated for ROTATE_%d, run Tools/asset_pack.py --rotate\"\n"
+        "#endif\n" % (rot, rot),
+    ]
+    for name, font, index, records in fonts:
+        width, height, _ = font
+        lines = ["// %s, %d x %d, %d of %d glyphs" % (name, width, height,
+                                                     sum(1 for r in records if r), CHAR_COUNT),
+                 "static const uint16_t %s_Index[] =" % name, "{"]
+        values = ["%d," % v for v in index]
+        for n in range(0, len(values), 16):
+            lines.append("\t" + " ".join(values[n:n + 16]))
+        lines[-1] = lines[-1][:-1]
+        lines += ["};", "", "static const uint8_t %s_Data[] =" % name, "{"]
+        for c, record in enumerate(records):
+            if record:
+                lines.append("\t// '%s'" % chr(c + FIRST_CHAR))
+                lines += c_bytes(record)
+        lines[-1] = lines[-1][:-1]
+        lines += ["};", "",
+                  "const sPackedFont %s_Packed = { %s_Index, %s_Data };\n" % (name, name, name)]
+        parts.append("\n".join(lines))
+    for name, width, height, data, packed in images:
+        lines = ["// %s, %d x %d, %d bytes unpacked" % (name, width, height, len(data)),
+                 "static const uint8_t %s_Data[] =" % name, "{"]
+        lines += c_bytes(packed)
+        lines[-1] = lines[-1][:-1]
+        lines += ["};", "",
+                  "const Canvas_image %s = { %d, %d, sizeof(%s_Data), %s_Data };\n"
+                  % (name, width, height, name, name)]
+        parts.append("\n".join(lines))
+    return "\n".join(parts)
+
+
+def report(fonts, images):
+    print("%-8s %7s %8s %7s %7s" % ("font", "glyphs", "ST table", "rotated", "packed"))
+    total = [0, 0, 0]
+    for name, font, index, records, rotated in fonts:
+        table = len(font[2])
+        packed = 2 * len(index) + len(sum(records, []))
+        total = [total[0] + table, total[1] + rotated, total[2] + packed]
+        print("%-8s %7d %8d %7d %7d" % (name, sum(1 for r in records if r), table, rotated, packed))
+    print("%-8s %7s %8d %7d %7d" % ("total", "", total[0], total[1], total[2]))
+    # The sFONT structs point at the packed glyphs with either setting
+    print("FONT_ASSET_PACK 1 saves %d B of flash (%d B of glyphs instead of %d B)"
+          % (total[0] + total[1], total[2], total[0] + total[1] + total[2]))
+
+    for name, width, height, data, packed in images:
+        print("%-20s %5d B -> %5d B" % (name, len(data), len(packed)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Generate the display asset pack.")
+    ap.add_argument("--rotate", type=int, choices=(90, 270), default=90,
+                    help="glyph orientation, only these put glyph columns on display lines (default %(default)s)")
+    ap.add_argument("--charset", nargs=2, action="append", default=[], metavar=("FONT", "CHARS"),
+                    help="keep only CHARS of FONT, may be given once per font")
+    ap.add_argument("-o", "--output", default=OUT,
+                    help="file to write or, with --check, to compare with (default %s)" % os.path.relpath(OUT))
+    ap.add_argument("--check", action="store_true",
+                    help="only check the pack and compare it with --output, nothing is written")
+    args = ap.parse_args()
+    rot = args.rotate
+
+    charsets = dict(CHARSETS)
+    for name, chars in args.charset:
+        if name not in FONTS:
+            ap.error("unknown font %s, one of %s" % (name, ", ".join(FONTS)))
+        charsets[name] = chars
+
+    fonts = []
+    for name in FONTS:
+        font, index, records, rotated = pack_font(name, rot, charsets[name])
+        fonts.append((name, font, index, records, rotated))
+    images = load_images()
+    text = render(rot, [f[:4] for f in fonts], images)
+    report(fonts, images)
+
+    if args.check:
+        with open(args.output, newline="") as f:
+            if f.read().replace("\r\n", "\n") != text:
+                sys.exit("%s is out of date" % os.path.relpath(args.output))
+        print("assets match the sources and %s" % os.path.relpath(args.output))
+        return
+
+    with open(args.output, "w", newline="\r\n") as f:
+        f.write(text)
+    print("wrote %s" % os.path.relpath(args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""Turn an "epdFrame" CLI dump into an image, compare it with a reference and
+show the bytes the G2 driver sends for it.
+
+The dump holds the frame on the display as the canvas stores it: one row per
+display line, pixel x % 8 in bit x % 8, a cleared bit is black. Copy the CLI
+output into a file (anything around the FRAME ... END block is ignored).
+
+The images are written the way the box shows them (canvas ROTATE_90), --raw
+keeps the frame buffer orientation.
+
+    python3 Tools/epd_frame.py dump.txt --pbm slot.pbm --png slot.png
+    python3 Tools/epd_frame.py dump.txt --compare golden.pbm    # exit 1 when a pixel differs
+    python3 Tools/epd_frame.py dump.txt --stream image_0.txt    # one_line output of every stage
+    python3 Tools/epd_frame.py dump.txt --stream p.txt --old before.txt   # partial update instead
+
+The line encoder is the reference code of Tools/epd_lut_gen.py, so a stream
+taken from this script can be held against an SPI capture of the box.
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from epd_lut_gen import STAGES, ref_all, ref_even, ref_odd  # noqa: E402
+
+# Panel layout as set up by EPD_Init: bytes_per_scan, middle_scan, pre_border_byte, border byte
+PANELS = {
+    (128, 96): (96 // 4, True, False, "zero"),        # EPD_1_44
+    (144, 128): (128 // 4 // 2, False, False, "set"),  # EPD_1_9
+    (200, 96): (96 // 4, True, True, "none"),          # EPD_2_0
+    (232, 128): (128 // 4 // 2, False, False, "set"),  # EPD_2_6
+    (264, 176): (176 // 4, True, True, "none"),        # EPD_2_7
+}
+
+
+def load_dump(path):
+    with open(path) as f:
+        text = f.read()
+
+    m = re.search(r"FRAME (\d+)x(\d+)\s*(.*?)END", text, re.S)
+    if m is None:
+        sys.exit("%s: no FRAME ... END block" % path)
+    dots, lines = int(m.group(1)), int(m.group(2))
+    rows = re.findall(r"[0-9a-fA-F]+", m.group(3))
+    if len(rows) != lines or any(len(r) != dots // 4 for r in rows):
+        sys.exit("%s: expected %d rows of %d hex digits" % (path, lines, dots // 4))
+    return dots, lines, [bytes.fromhex(r) for r in rows]
+
+
+def black(rows, x, y):
+    return not (rows[y][x // 8] >> (x % 8)) & 1
+
+
+def pixels(dots, lines, rows, raw):
+    """Image as rows of booleans (True = black)."""
+    if raw:
+        return [[black(rows, x, y) for x in range(dots)] for y in range(lines)]
+    # ROTATE_90: the display lines are the columns, the first dot is at the bottom
+    return [[black(rows, dots - 1 - r, c) for c in range(lines)] for r in range(dots)]
+
+
+def load_pbm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    m = re.match(rb"P4\s+(?:#[^\n]*\n\s*)*(\d+)\s+(\d+)\s", data)
+    if m is None:
+        sys.exit("%s: not a binary PBM" % path)
+    width, height = int(m.group(1)), int(m.group(2))
+    stride = (width + 7) // 8
+    body = data[m.end():]
+    return [[bool((body[y * stride + x // 8] >> (7 - x % 8)) & 1) for x in range(width)]
+            for y in range(height)]
+
+
+def pack_rows(img, one_is_black):
+    out = []
+    for row in img:
+        line = bytearray((len(row) + 7) // 8)
+        for x, b in enumerate(row):
+            if b == one_is_black:
+                line[x // 8] |= 0x80 >> (x % 8)
+        out.append(bytes(line))
+    return out
+
+
+def write_pbm(path, img):
+    with open(path, "wb") as f:
+        f.write(b"P4\n%d %d\n" % (len(img[0]), len(img)))
+        f.write(b"".join(pack_rows(img, True)))
+
+
+def write_png(path, img):
+    def chunk(kind, data):
+        return (struct.pack(">I", len(data)) + kind + data
+                + struct.pack(">I", zlib.crc32(kind + data) & 0xffffffff))
+
+    # 1 bit grayscale, 1 = white
+    raw = b"".join(b"\x00" + row for row in pack_rows(img, False))
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", len(img[0]), len(img), 1, 0, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def compare(img, ref):
+    if len(img) != len(ref) or len(img[0]) != len(ref[0]):
+        print("size differs: %dx%d, reference %dx%d" % (len(img[0]), len(img), len(ref[0]), len(ref)))
+        return False
+    diff = [(x, y) for y, row in enumerate(img) for x, b in enumerate(row) if b != ref[y][x]]
+    if not diff:
+        print("pixel identical")
+        return True
+    xs = [d[0] for d in diff]
+    ys = [d[1] for d in diff]
+    print("%d pixels differ, x %d..%d, y %d..%d" % (len(diff), min(xs), max(xs), min(ys), max(ys)))
+    return False
+
+
+# Port of one_line in epd_g2.c. data None = fixed_value, mask = old line of a partial update
+def one_line(panel, dots, line, data, fixed_value, mask, stage):
+    bytes_per_scan, middle_scan, pre_border, border = panel
+    bytes_per_line = dots // 8
+    out = [0x72]
+    if pre_border:
+        out.append(0x00)
+
+    def data_bytes(encode, order, width):
+        if data is None:
+            return [fixed_value] * (width * bytes_per_line)
+        res = []
+        for b in order:
+            v = encode(data[b], None if mask is None else mask[b], stage)
+            res.extend([v >> 8, v & 0xff] if width == 2 else [v])
+        return res
+
+    if middle_scan:
+        out += data_bytes(ref_odd, range(bytes_per_line - 1, -1, -1), 1)
+        for b in range(bytes_per_scan, 0, -1):
+            out.append(0x03 << (2 * (line & 0x03)) if line // 4 == b - 1 else 0x00)
+        out += data_bytes(ref_even, range(bytes_per_line), 1)
+    else:
+        for b in range(bytes_per_scan):
+            out.append(0xc0 >> (line & 0x06) if (line & 0x01) and line // 8 == b else 0x00)
+        out += data_bytes(ref_all, range(bytes_per_line - 1, -1, -1), 2)
+        for b in range(bytes_per_scan, 0, -1):
+            out.append(0x03 << (line & 0x06) if not (line & 0x01) and line // 8 == b - 1 else 0x00)
+
+    if border == "zero":
+        out.append(0x00)
+    elif border == "set":
+        out.append(0xaa if stage == 3 else 0x00)
+    return bytes(out)
+
+
+def write_stream(path, dots, lines, rows, old_rows):
+    panel = PANELS.get((dots, lines))
+    if panel is None:
+        sys.exit("no panel with %d dots x %d lines" % (dots, lines))
+
+    with open(path, "w") as f:
+        if old_rows is None:
+            # EPD_image_0, see update_plans in epd_g2.c
+            plan = [(0, None, 0xaa), (1, None, 0xaa), (2, rows, 0), (3, rows, 0)]
+            f.write("# EPD_UPDATE_IMAGE_0, one frame per stage\n")
+        else:
+            plan = [(3, rows, 0)]
+            f.write("# EPD_UPDATE_PARTIAL, changed lines of one frame\n")
+
+        for stage, data, fixed in plan:
+            f.write("# %s\n" % STAGES[stage])
+            for line in range(lines):
+                mask = None
+                if old_rows is not None:
+                    if old_rows[line] == rows[line]:
+                        continue
+                    mask = old_rows[line]
+                d = None if data is None else data[line]
+                f.write("%3d %s\n" % (line, one_line(panel, dots, line, d, fixed, mask, stage).hex()))
+
+
+def option(name):
+    if name not in sys.argv[1:]:
+        return None
+    i = sys.argv.index(name)
+    if i + 1 >= len(sys.argv):
+        sys.exit("%s needs a file name" % name)
+    return sys.argv[i + 1]
+
+
+def main():
+    if len(sys.argv) < 2 or sys.argv[1].startswith("--"):
+        sys.exit(__doc__)
+
+    dots, lines, rows = load_dump(sys.argv[1])
+    img = pixels(dots, lines, rows, "--raw" in sys.argv[2:])
+    ok = True
+
+    if option("--pbm"):
+        write_pbm(option("--pbm"), img)
+        print("wrote %s" % option("--pbm"))
+    if option("--png"):
+        write_png(option("--png"), img)
+        print("wrote %s" % option("--png"))
+    if option("--stream"):
+        old_rows = None
+        if option("--old"):
+            old_dots, old_lines, old_rows = load_dump(option("--old"))
+            if (old_dots, old_lines) != (dots, lines):
+                sys.exit("%s is a different panel" % option("--old"))
+        write_stream(option("--stream"), dots, lines, rows, old_rows)
+        print("wrote %s" % option("--stream"))
+    if option("--compare"):
+        ok = compare(img, load_pbm(option("--compare")))
+
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""Generate the EPD G2 pixel transform tables (Core/Light_Widow/EPD/src/epd_g2_lut.c).
+
+Every (stage, data byte) pair of even_pixels, odd_pixels and all_pixels is run
+through a port of the reference code in epd_g2.c, plus one table per mode that
+turns (mask ^ data) into the "nothing" mask of a partial update.
+
+Before anything is written the tables are checked against the reference for
+every stage and every data/mask combination, the script fails on a mismatch.
+
+    python3 Tools/epd_lut_gen.py                  # check and write epd_g2_lut.c
+    python3 Tools/epd_lut_gen.py -o /tmp/lut.c    # check and write somewhere else
+    python3 Tools/epd_lut_gen.py --check          # check only, compare with the file on disk
+"""
+
+import argparse
+import os
+import sys
+
+STAGES = ("EPD_compensate", "EPD_white", "EPD_inverse", "EPD_normal")
+
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                   "Core", "Light_Widow", "EPD", "src", "epd_g2_lut.c")
+
+
+# Reference, same operations as epd_g2.c (shadowed pixel_mask in all_pixels fixed)
+def interleave_bits(value):
+    value = (value | (value << 4)) & 0x0f0f
+    value = (value | (value << 2)) & 0x3333
+    value = (value | (value << 1)) & 0x5555
+    return value
+
+
+def ref_even(data, mask, stage):
+    pixels = data & 0xaa
+    pixel_mask = 0xff
+    if mask is not None:
+        pixel_mask = (mask ^ pixels) & 0xaa
+        pixel_mask |= pixel_mask >> 1
+    if stage == 0:
+        pixels = 0xaa | ((pixels ^ 0xaa) >> 1)
+    elif stage == 1:
+        pixels = (0x55 + ((pixels ^ 0xaa) >> 1)) & 0xff
+    elif stage == 2:
+        pixels = 0x55 | (pixels ^ 0xaa)
+    else:
+        pixels = 0xaa | (pixels >> 1)
+    pixels = (pixels & pixel_mask) | (~pixel_mask & 0x55)
+    p1 = (pixels >> 6) & 0x03
+    p2 = (pixels >> 4) & 0x03
+    p3 = (pixels >> 2) & 0x03
+    p4 = (pixels >> 0) & 0x03
+    return ((p1 << 0) | (p2 << 2) | (p3 << 4) | (p4 << 6)) & 0xff
+
+
+def ref_odd(data, mask, stage):
+    pixels = data & 0x55
+    pixel_mask = 0xff
+    if mask is not None:
+        pixel_mask = (mask ^ pixels) & 0x55
+        pixel_mask |= pixel_mask << 1
+    if stage == 0:
+        pixels = 0xaa | (pixels ^ 0x55)
+    elif stage == 1:
+        pixels = (0x55 + (pixels ^ 0x55)) & 0xff
+    elif stage == 2:
+        pixels = 0x55 | ((pixels ^ 0x55) << 1)
+    else:
+        pixels = 0xaa | pixels
+    return ((pixels & pixel_mask) | (~pixel_mask & 0x55)) & 0xff
+
+
+def ref_all(data, mask, stage):
+    pixels = interleave_bits(data)
+    pixel_mask = 0xffff
+    if mask is not None:
+        pixel_mask = interleave_bits(mask)
+        pixel_mask = (pixel_mask ^ pixels) & 0x5555
+        pixel_mask |= pixel_mask << 1
+    if stage == 0:
+        pixels = 0xaaaa | (pixels ^ 0x5555)
+    elif stage == 1:
+        pixels = (0x5555 + (pixels ^ 0x5555)) & 0xffff
+    elif stage == 2:
+        pixels = 0x5555 | ((pixels ^ 0x5555) << 1)
+    else:
+        pixels = 0xaaaa | pixels
+    return ((pixels & pixel_mask) | (~pixel_mask & 0x5555)) & 0xffff
+
+
+# Tables
+def swap_pairs(pixels):
+    return (((pixels >> 6) & 3) | (((pixels >> 4) & 3) << 2)
+            | (((pixels >> 2) & 3) << 4) | ((pixels & 3) << 6))
+
+
+def build():
+    even = [[ref_even(d, None, s) for d in range(256)] for s in range(4)]
+    odd = [[ref_odd(d, None, s) for d in range(256)] for s in range(4)]
+    all_ = [[ref_all(d, None, s) for d in range(256)] for s in range(4)]
+
+    # pixel_mask only depends on mask ^ data, the even one is pair swapped like the pixels
+    even_mask = []
+    odd_mask = []
+    all_mask = []
+    for x in range(256):
+        m = x & 0xaa
+        even_mask.append(swap_pairs(m | (m >> 1)))
+        m = x & 0x55
+        odd_mask.append((m | (m << 1)) & 0xff)
+        m = interleave_bits(x)
+        all_mask.append((m | (m << 1)) & 0xffff)
+    return even, odd, all_, even_mask, odd_mask, all_mask
+
+
+def check(tables):
+    even, odd, all_, even_mask, odd_mask, all_mask = tables
+    for s in range(4):
+        for d in range(256):
+            if even[s][d] != ref_even(d, None, s) or odd[s][d] != ref_odd(d, None, s) \
+                    or all_[s][d] != ref_all(d, None, s):
+                sys.exit("mismatch %s data 0x%02x" % (STAGES[s], d))
+            for m in range(256):
+                pm = even_mask[m ^ d]
+                if (even[s][d] & pm) | (~pm & 0x55 & 0xff) != ref_even(d, m, s):
+                    sys.exit("even mismatch %s data 0x%02x mask 0x%02x" % (STAGES[s], d, m))
+                pm = odd_mask[m ^ d]
+                if (odd[s][d] & pm) | (~pm & 0x55 & 0xff) != ref_odd(d, m, s):
+                    sys.exit("odd mismatch %s data 0x%02x mask 0x%02x" % (STAGES[s], d, m))
+                pm = all_mask[m ^ d]
+                if (all_[s][d] & pm) | (~pm & 0x5555 & 0xffff) != ref_all(d, m, s):
+                    sys.exit("all mismatch %s data 0x%02x mask 0x%02x" % (STAGES[s], d, m))
+
+
+def c_rows(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("\t\t" + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    lines[-1] = lines[-1][:-1]
+    return "\n".join(lines)
+
+
+def c_table(ctype, name, rows, fmt, per_line):
+    out = ["const %s %s[4][256] = {" % (ctype, name)]
+    for s, row in enumerate(rows):
+        out.append("\t{\t// %s" % STAGES[s])
+        out.append(c_rows(row, fmt, per_line))
+        out.append("\t}," if s < 3 else "\t}")
+    out.append("};\n")
+    return "\n".join(out)
+
+
+def c_mask(ctype, name, values, fmt, per_line):
+    return "const %s %s[256] = {\n%s\n};\n" % (ctype, name, c_rows(values, fmt, per_line).replace("\t\t", "\t"))
+
+
+def render(tables):
+    even, odd, all_, even_mask, odd_mask, all_mask = tables
+    parts = [
+        "/*\n"
+        " * epd_g2_lut.c\n"
+        " *\n"
+        " *  Pixel transform tables of the G2 line encoder.\n"
+        " *  Generated by Tools/epd_lut_gen.py, do not edit.\n"
+        " */\n",
+        "#include \"epd_g2_lut.h\"\n",
+        "#if EPD_PIXEL_LUT\n",
+        "// even_pixels, pixel pairs already swapped",
+        c_table("uint8_t", "epd_lut_even", even, "0x%02x", 16),
+        "// odd_pixels",
+        c_table("uint8_t", "epd_lut_odd", odd, "0x%02x", 16),
+        "// all_pixels, interleaved to 16 bits",
+        c_table("uint16_t", "epd_lut_all", all_, "0x%04x", 8),
+        "// partial update masks, indexed by mask ^ data",
+        c_mask("uint8_t", "epd_lut_even_mask", even_mask, "0x%02x", 16),
+        c_mask("uint8_t", "epd_lut_odd_mask", odd_mask, "0x%02x", 16),
+        c_mask("uint16_t", "epd_lut_all_mask", all_mask, "0x%04x", 8),
+        "#endif // EPD_PIXEL_LUT\n",
+    ]
+    return "\n".join(parts)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Generate the EPD G2 pixel transform tables.")
+    ap.add_argument("-o", "--output", default=OUT,
+                    help="file to write or, with --check, to compare with (default %s)" % os.path.relpath(OUT))
+    ap.add_argument("--check", action="store_true",
+                    help="only check the tables and compare them with --output, nothing is written")
+    args = ap.parse_args()
+
+    tables = build()
+    check(tables)
+    text = render(tables)
+
+    if args.check:
+        with open(args.output, newline="") as f:
+            if f.read().replace("\r\n", "\n") != text:
+                sys.exit("%s is out of date" % os.path.relpath(args.output))
+        print("tables match the reference and %s" % os.path.relpath(args.output))
+        return
+
+    with open(args.output, "w", newline="\r\n") as f:
+        f.write(text)
+    print("wrote %s" % os.path.relpath(args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Generate the pre-rotated glyph tables (Core/Light_Widow/EPD/src/fonts_rotated.c).
+
+The ST font tables store every glyph row by row, MSB first. With the canvas
+rotated, a glyph column ends up on one display line, so canvas_BlitGlyph wants
+the glyphs column by column, in the bit order of the frame buffer (pixel x % 8
+in bit x % 8, increasing absolute x).
+
+Every glyph column is stored as (Height + 7) / 8 bytes, LSB first:
+    ROTATE_90:  bit k = glyph row Height - 1 - k (absolute x decreases with the row)
+    ROTATE_270: bit k = glyph row k
+
+The output is checked against the source tables before it is written.
+
+    python3 Tools/font_rotate.py                  # ROTATE_90, check and write fonts_rotated.c
+    python3 Tools/font_rotate.py --rotate 270     # other orientation, match CANVAS_FONT_ROTATE
+    python3 Tools/font_rotate.py -o /tmp/rot.c    # check and write somewhere else
+    python3 Tools/font_rotate.py --check          # check only, compare with the file on disk
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FONTS = ("Font8", "Font12", "Font16", "Font20", "Font24")
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SRC = os.path.join(ROOT, "Core", "Light_Widow", "EPD", "src")
+OUT = os.path.join(SRC, "fonts_rotated.c")
+
+FIRST_CHAR = 0x20
+CHAR_COUNT = 95
+
+
+def load_font(name):
+    path = os.path.join(SRC, name.lower() + ".c")
+    with open(path) as f:
+        text = f.read()
+
+    # Drop the glyph comments, they hold pixel art and offsets
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+
+    table = re.search(r"%s_Table\s*\[\]\s*=\s*\{(.*?)\};" % name, text, re.S)
+    init = re.search(r"sFONT\s+%s\s*=\s*\{\s*(?:FONT_TABLE\(\s*)?%s_Table\s*\)?\s*,\s*(\d+)\s*,\s*(\d+)" % (name, name), text, re.S)
+    if table is None or init is None:
+        sys.exit("%s: font table not found" % os.path.relpath(path))
+
+    data = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", table.group(1))]
+    width, height = int(init.group(1)), int(init.group(2))
+    if height > 24:
+        sys.exit("%s: canvas_BlitGlyph handles glyphs up to 24 rows" % name)
+    if len(data) != CHAR_COUNT * height * ((width + 7) // 8):
+        sys.exit("%s: unexpected table size %d" % (name, len(data)))
+    return width, height, data
+
+
+def source_pixel(font, c, i, j):
+    width, height, data = font
+    row_bytes = (width + 7) // 8
+    byte = data[(c * height + j) * row_bytes + i // 8]
+    return (byte >> (7 - i % 8)) & 1
+
+
+def rotate(font, rot):
+    width, height, _ = font
+    col_bytes = (height + 7) // 8
+    out = []
+    for c in range(CHAR_COUNT):
+        glyph = []
+        for i in range(width):
+            bits = 0
+            for j in range(height):
+                k = height - 1 - j if rot == 90 else j
+                bits |= source_pixel(font, c, i, j) << k
+            glyph.append([(bits >> (8 * b)) & 0xff for b in range(col_bytes)])
+        out.append(glyph)
+    return out
+
+
+def check(font, glyphs, rot):
+    width, height, _ = font
+    for c in range(CHAR_COUNT):
+        for i in range(width):
+            bits = 0
+            for b, v in enumerate(glyphs[c][i]):
+                bits |= v << (8 * b)
+            for j in range(height):
+                k = height - 1 - j if rot == 90 else j
+                if ((bits >> k) & 1) != source_pixel(font, c, i, j):
+                    sys.exit("mismatch char 0x%02x column %d row %d" % (c + FIRST_CHAR, i, j))
+            if bits >> height:
+                sys.exit("stray bits char 0x%02x column %d" % (c + FIRST_CHAR, i))
+
+
+def render(rot, tables):
+    parts = [
+        "/*\n"
+        " * fonts_rotated.c\n"
+        " *\n"
+        " *  Glyphs of the ST fonts, pre-rotated for canvas_BlitGlyph.\n"
+        " *  Generated by Tools/font_rotate.py, do not edit.\n"
+        " */\n",
+        "#include \"fonts.h\"\n#include \"epd_gfx.h\"\n",
+        "#if CANVAS_FONT_ROTATE != ROTATE_%d\n"
+        "#error \"fonts_rotated.c was generated for ROTATE_%d, run Tools/font_rotate.py --rotate\"\n"
+        "#endif\n" % (rot, rot),
+    ]
+    for name, font, glyphs in tables:
+        width, height, _ = font
+        lines = ["// %s, %d columns of %d rows per glyph" % (name, width, height),
+                 "const uint8_t %s_Rotated[] =" % name, "{"]
+        for c, glyph in enumerate(glyphs):
+            lines.append("\t// '%s'" % chr(c + FIRST_CHAR))
+            values = ["0x%02x," % v for col in glyph for v in col]
+            for n in range(0, len(values), 24):
+                lines.append("\t" + " ".join(values[n:n + 24]))
+        lines[-1] = lines[-1][:-1]
+        lines.append("};\n")
+        parts.append("\n".join(lines))
+    return "\n".join(parts)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Generate the pre-rotated glyph tables.")
+    ap.add_argument("--rotate", type=int, choices=(90, 270), default=90,
+                    help="glyph orientation, only these put glyph columns on display lines (default %(default)s)")
+    ap.add_argument("-o", "--output", default=OUT,
+                    help="file to write or, with --check, to compare with (default %s)" % os.path.relpath(OUT))
+    ap.add_argument("--check", action="store_true",
+                    help="only check the glyphs and compare them with --output, nothing is written")
+    args = ap.parse_args()
+    rot = args.rotate
+
+    tables = []
+    for name in FONTS:
+        font = load_font(name)
+        glyphs = rotate(font, rot)
+        check(font, glyphs, rot)
+        tables.append((name, font, glyphs))
+    text = render(rot, tables)
+
+    if args.check:
+        with open(args.output, newline="") as f:
+            if f.read().replace("\r\n", "\n") != text:
+                sys.exit("%s is out of date" % os.path.relpath(args.output))
+        print("glyphs match the fonts and %s" % os.path.relpath(args.output))
+        return
+
+    with open(args.output, "w", newline="\r\n") as f:
+        f.write(text)
+    print("wrote %s" % os.path.relpath(args.output))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Turn a binary filter log (LIGHT_WIDOW/FilterLog_<date>_<ID>.lwl) into the CSV
+layout the box used to write, and list the other events it holds.
+
+File, block and record layout as described in dataLogger.h:
+    header: "LWL", version, CRC seed of the blocks (2 bytes LE),
+            CRC-16 of the bytes before it (CCITT, LSB first, preset 0xFFFF)
+    block:  0xB5, payload length, base time (s since midnight, 3 bytes LE),
+            payload, CRC-16 of the bytes before it (preset with the seed)
+    record: event, seconds since the previous record of the block (7 bits per byte),
+            event data
+A version 1 file has no header, its blocks use the preset 0xFFFF. A block with
+a bad CRC is skipped, the reader picks up at the next sync byte that starts a
+good block. Blocks a deleted log left in the clusters of the file don't match
+its seed and are skipped the same way. A filter record naming an index of a lost block
+shows "?", as do the slots of records ahead of the first file record. The box reserves
+space ahead of the records and gives it back when the file is closed. A file taken
+from a card pulled while it was open still holds that space; whatever follows the
+last good block is reported as unused, not as damage.
+
+    python3 Tools/log_export.py FilterLog_01-01-2020_LBSA0100P.lwl           # CSV next to it
+    python3 Tools/log_export.py log.lwl --csv out.csv --events events.csv
+    python3 Tools/log_export.py log.lwl --dump                               # every record
+"""
+
+import os
+import sys
+
+MAGIC = b"LWL"
+FILE_HEADER = 8
+LEGACY_SEED = 0xFFFF
+SYNC = 0xB5
+HEADER = 5
+PAYLOAD = 240
+
+EVT_FILE, EVT_NAME, EVT_FILTERS, EVT_BATTERY, EVT_TEMPERATURE, EVT_ERROR = range(6)
+SOURCES = ("logger", "rfid", "epd", "gauge")
+FRESULT = ("FR_OK", "FR_DISK_ERR", "FR_INT_ERR", "FR_NOT_READY", "FR_NO_FILE", "FR_NO_PATH",
+           "FR_INVALID_NAME", "FR_DENIED", "FR_EXIST", "FR_INVALID_OBJECT", "FR_WRITE_PROTECTED",
+           "FR_INVALID_DRIVE", "FR_NOT_ENABLED", "FR_NO_FILESYSTEM", "FR_MKFS_ABORTED", "FR_TIMEOUT",
+           "FR_LOCKED", "FR_NOT_ENOUGH_CORE", "FR_TOO_MANY_OPEN_FILES", "FR_INVALID_PARAMETER")
+SLOTS = 3
+
+
+def crc16(data, crc=0xFFFF):
+    # rfalCrcCalculateCcitt
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8408 if crc & 1 else crc >> 1
+    return crc
+
+
+def file_seed(data):
+    # Block CRC preset and offset of the first block, as findLogEnd reads them
+    if len(data) >= FILE_HEADER and data[:3] == MAGIC and \
+            crc16(data[:FILE_HEADER - 2]) == data[6] | (data[7] << 8):
+        return data[4] | (data[5] << 8), FILE_HEADER
+    return LEGACY_SEED, 0
+
+
+def blocks(data, stats):
+    seed, i = file_seed(data)
+    good = i
+    while i + HEADER + 2 <= len(data):
+        n = data[i + 1]
+        end = i + HEADER + n
+        if data[i] == SYNC and n <= PAYLOAD and end + 2 <= len(data) and \
+                crc16(data[i:end], seed) == data[end] | (data[end + 1] << 8):
+            stats["blocks"] += 1
+            if i > good:
+                stats["skipped"] += i - good
+            yield int.from_bytes(data[i + 2:i + 5], "little"), data[i + HEADER:end]
+            i = good = end + 2
+            continue
+        # Not a block, or a damaged one: look for the next sync byte
+        i += 1
+        while i < len(data) and data[i] != SYNC:
+            i += 1
+    stats["unused"] += len(data) - good
+
+
+def records(data, stats):
+    for seconds, payload in blocks(data, stats):
+        p = 0
+        while p < len(payload):
+            event = payload[p]
+            p += 1
+            delta, shift = 0, 0
+            while True:
+                b = payload[p]
+                p += 1
+                delta |= (b & 0x7F) << shift
+                shift += 7
+                if not b & 0x80:
+                    break
+            seconds += delta
+
+            if event == EVT_FILE:
+                n = payload[p + 5]
+                fields = (payload[p], payload[p + 1] | (payload[p + 2] << 8), payload[p + 3],
+                          payload[p + 4], payload[p + 6:p + 6 + n].decode("latin-1"))
+                p += 6 + n
+            elif event == EVT_NAME:
+                n = payload[p + 1]
+                fields = (payload[p], payload[p + 2:p + 2 + n].decode("latin-1"))
+                p += 2 + n
+            elif event == EVT_FILTERS:
+                mask = payload[p]
+                n = bin(mask).count("1")
+                fields = (mask, list(payload[p + 1:p + 1 + n]))
+                p += 1 + n
+            elif event == EVT_BATTERY:
+                fields = (payload[p], payload[p + 1] | (payload[p + 2] << 8))
+                p += 3
+            elif event == EVT_TEMPERATURE:
+                fields = (int.from_bytes(payload[p:p + 2], "little", signed=True),)
+                p += 2
+            elif event == EVT_ERROR:
+                fields = (payload[p], payload[p + 1])
+                p += 2
+            else:
+                # A newer firmware, the rest of the block can't be parsed
+                stats["unknown"] += 1
+                break
+            stats["records"] += 1
+            yield seconds, event, fields
+
+
+def hms(seconds):
+    return "%02d:%02d:%02d" % (seconds // 3600, seconds // 60 % 60, seconds % 60)
+
+
+def export(data):
+    stats = {"blocks": 0, "skipped": 0, "unused": 0, "records": 0, "unknown": 0}
+    header, rows, events = None, [], []
+    # Records ahead of the first file record, taken to another card at a card change,
+    # don't know the names or the slots they left unchanged
+    names, slots = {}, ["?"] * SLOTS
+
+    for seconds, event, fields in records(data, stats):
+        if event == EVT_FILE:
+            version, year, month, day, box = fields
+            if header is None:
+                header = (box, "%02d-%02d-%d" % (month, day, year))
+            # A reset appends a new file record, names and slots start over
+            names, slots = {}, [""] * SLOTS
+        elif event == EVT_NAME:
+            names[fields[0]] = fields[1]
+        elif event == EVT_FILTERS:
+            mask, indexes = fields
+            for slot in range(SLOTS):
+                if mask & (1 << slot):
+                    index = indexes.pop(0)
+                    slots[slot] = "" if index == 0xFF else names.get(index, "?")
+            rows.append("%s,%s\n" % (hms(seconds), ",".join(slots)))
+        elif event == EVT_BATTERY:
+            events.append("%s,battery,%d %%,%d mV\n" % (hms(seconds), fields[0], fields[1]))
+        elif event == EVT_TEMPERATURE:
+            events.append("%s,temperature,%.3f C,\n" % (hms(seconds), fields[0] / 8))
+        elif event == EVT_ERROR:
+            source = SOURCES[fields[0]] if fields[0] < len(SOURCES) else str(fields[0])
+            code = FRESULT[fields[1]] if fields[0] == 0 and fields[1] < len(FRESULT) else str(fields[1])
+            events.append("%s,error,%s,%s\n" % (hms(seconds), source, code))
+
+    box, date = header if header else ("?", "?")
+    csv = ("Light Widow Matte Box\nMatte Box ID:,%s\nDate:,%s\nNotes:\n\n"
+           "Time,Filter Slot 1,Filter Slot 2,Filter Slot 3\n" % (box, date)) + "".join(rows)
+    return csv, "Time,Event,Value,Detail\n" + "".join(events), stats
+
+
+def option(name):
+    if name not in sys.argv[1:]:
+        return None
+    i = sys.argv.index(name)
+    if i + 1 >= len(sys.argv):
+        sys.exit("%s needs a file name" % name)
+    return sys.argv[i + 1]
+
+
+def main():
+    if len(sys.argv) < 2 or sys.argv[1].startswith("--"):
+        sys.exit(__doc__)
+
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+
+    if "--dump" in sys.argv[2:]:
+        stats = {"blocks": 0, "skipped": 0, "unused": 0, "records": 0, "unknown": 0}
+        for seconds, event, fields in records(data, stats):
+            print(hms(seconds), event, fields)
+        return
+
+    csv, events, stats = export(data)
+    out = option("--csv") or os.path.splitext(sys.argv[1])[0] + ".csv"
+    with open(out, "w", newline="") as f:
+        f.write(csv)
+    print("wrote %s, %d rows" % (out, csv.count("\n") - 6))
+    if option("--events"):
+        with open(option("--events"), "w", newline="") as f:
+            f.write(events)
+        print("wrote %s, %d events" % (option("--events"), events.count("\n") - 1))
+
+    print("%d B: %d blocks, %d records, %d B skipped, %d B unused, %d blocks with unknown events"
+          % (len(data), stats["blocks"], stats["records"], stats["skipped"], stats["unused"],
+             stats["unknown"]))
+    sys.exit(1 if stats["skipped"] or stats["unknown"] else 0)
+
+
+if __name__ == "__main__":
+    main()
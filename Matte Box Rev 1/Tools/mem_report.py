@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""RAM and flash budget of a build, read from the linker map file.
+
+The firmware allocates everything statically (see Core/Light_Widow/Core/mem_usage.c),
+so the map file shows the whole RAM plan: .data and .bss per module, the heap and
+stack reservations of the linker script and what is left. The "memStats" CLI
+command gives the matching run time numbers, heap use and stack high-water mark.
+
+    python3 Tools/mem_report.py "Debug/Matte Box Rev 1.map"
+    python3 Tools/mem_report.py app.map --top 30          # longer list of the largest objects
+    python3 Tools/mem_report.py app.map --max-static 65536  # exit 1 when .data + .bss is larger
+
+Section names come from -fdata-sections / -ffunction-sections (the STM32CubeIDE
+default), without them only the module totals are meaningful.
+"""
+
+import os
+import re
+import sys
+from collections import defaultdict
+
+# Output sections placed in RAM, the rest of RAM is the heap/stack reservation
+RAM_SECTIONS = (".data", ".bss")
+
+INPUT_RE = re.compile(r"^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+INPUT_NAME_RE = re.compile(r"^ (\S+)$")
+INPUT_CONT_RE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+OUTPUT_RE = re.compile(r"^(\.\S+|\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+))?")
+MEMORY_RE = re.compile(r"^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+SYMBOL_RE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+(\w+)\s*=")
+
+
+def module_name(path):
+    # libc_nano.a(lib_a-memcpy.o) -> libc_nano.a, ./Core/Src/main.o -> Core/Src/main.o
+    m = re.match(r"(.*?)\((.*)\)$", path)
+    if m:
+        return os.path.basename(m.group(1))
+    return re.sub(r"^\./", "", path)
+
+
+def parse_map(path):
+    with open(path) as f:
+        lines = f.read().splitlines()
+
+    memory = {}
+    symbols = {}
+    inputs = []             # (output section, input section, address, size, module)
+    outputs = {}            # output section -> (address, size)
+
+    i = 0
+    while i < len(lines) and not lines[i].startswith("Memory Configuration"):
+        i += 1
+    while i < len(lines) and not lines[i].startswith("Linker script and memory map"):
+        m = MEMORY_RE.match(lines[i])
+        if m and m.group(1) != "Name":
+            memory[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16))
+        i += 1
+
+    current = None
+    pending = None
+    for line in lines[i:]:
+        if line.startswith("OUTPUT(") or line.startswith("LOAD "):
+            continue
+        m = SYMBOL_RE.match(line)
+        if m:
+            symbols[m.group(2)] = int(m.group(1), 16)
+            continue
+        if pending is not None:
+            m = INPUT_CONT_RE.match(line)
+            if m:
+                inputs.append((current, pending, int(m.group(1), 16), int(m.group(2), 16), m.group(3)))
+            pending = None
+            continue
+        if line and not line[0].isspace():
+            m = OUTPUT_RE.match(line)
+            current = m.group(1)
+            if m.group(2) is not None:
+                outputs[current] = (int(m.group(2), 16), int(m.group(3), 16))
+            continue
+        m = INPUT_RE.match(line)
+        if m:
+            inputs.append((current, m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4)))
+            continue
+        m = INPUT_NAME_RE.match(line)
+        if m and not m.group(1).startswith("*"):
+            pending = m.group(1)
+
+    return memory, outputs, inputs, symbols
+
+
+def in_region(region, address):
+    return region is not None and region[0] <= address < region[0] + region[1]
+
+
+def main():
+    if len(sys.argv) < 2 or sys.argv[1].startswith("--"):
+        sys.exit(__doc__)
+
+    top = 15
+    max_static = None
+    args = sys.argv[2:]
+    if "--top" in args:
+        top = int(args[args.index("--top") + 1])
+    if "--max-static" in args:
+        max_static = int(args[args.index("--max-static") + 1], 0)
+
+    memory, outputs, inputs, symbols = parse_map(sys.argv[1])
+    ram = memory.get("RAM")
+    flash = memory.get("FLASH")
+    if ram is None or flash is None:
+        sys.exit("%s: no RAM and FLASH regions in the memory configuration" % sys.argv[1])
+
+    per_module = defaultdict(lambda: [0, 0])     # .data, .bss
+    objects = []
+    for out, name, address, size, obj in inputs:
+        if size == 0 or out not in RAM_SECTIONS or not in_region(ram, address):
+            continue
+        module = module_name(obj)
+        per_module[module][0 if out == ".data" else 1] += size
+        # .bss.frameBuffer -> frameBuffer
+        objects.append((size, name.split(".", 2)[-1] if name.count(".") > 1 else name, module))
+
+    data = sum(v[0] for v in per_module.values())
+    bss = sum(v[1] for v in per_module.values())
+    flash_used = sum(size for address, size in outputs.values() if in_region(flash, address))
+    flash_used += outputs.get(".data", (0, 0))[1]     # initial values of .data
+
+    heap = symbols.get("_Min_Heap_Size", 0)
+    stack = symbols.get("_Min_Stack_Size", 0)
+    # the section sizes include the alignment padding the per module sums miss
+    static = sum(outputs.get(s, (0, 0))[1] for s in RAM_SECTIONS) or data + bss
+    free = ram[1] - static - heap - stack
+
+    print("RAM   %7d B: static %d B (.data %d, .bss %d), heap %d B, stack %d B reserved, %d B free"
+          % (ram[1], static, data, bss, heap, stack, free))
+    print("FLASH %7d B: %d B used, %d B free" % (flash[1], flash_used, flash[1] - flash_used))
+
+    print("\nRAM by module (.data + .bss):")
+    rows = sorted(per_module.items(), key=lambda kv: -(kv[1][0] + kv[1][1]))
+    for module, (d, b) in rows:
+        if d + b == 0:
+            continue
+        print("  %7d  %-60s (.data %d, .bss %d)" % (d + b, module, d, b))
+
+    print("\nLargest RAM objects:")
+    for size, name, module in sorted(objects, reverse=True)[:top]:
+        print("  %7d  %-32s %s" % (size, name, os.path.basename(module)))
+
+    ok = free >= 0
+    if not ok:
+        print("\nRAM overcommitted by %d B" % -free)
+    if max_static is not None and static > max_static:
+        print("\nstatic RAM %d B is over the %d B budget" % (static, max_static))
+        ok = False
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Replay recorded wake-up traces through the stage classifier of slot_locator.c.
+
+The box prints two kinds of lines over the USB CDC port:
+    WAKEUP <ampDelta>,<phaseDelta>                  every wake-up with a valid baseline
+    SLOT <ampDelta>,<phaseDelta>,<calStage>,<est>   a wake-up applied to exactly one new tag
+<calStage> is the stage armed with "calStage N" (0 outside calibration) and <est>
+is the firmware estimate taken before the sample moved the centroid. Anything
+else in the capture (CLI replies, other prints) is ignored, so a raw terminal
+log can be used as is.
+
+Only SLOT lines with a calStage carry the true stage. They are scored twice:
+    replay      samples in capture order, each classified against the table
+                built from the ones before it, like the box does after
+                "calClear". The replayed estimate is checked against <est>.
+    holdout     leave-one-out: each sample classified against a table built
+                from all the other samples
+Both print a confusion matrix (rows: true stage, columns: estimate, 0 = no
+clear match), the accuracy of the accepted estimates and the reject rate.
+
+    python3 Tools/slot_eval.py capture.txt
+    python3 Tools/slot_eval.py capture.txt --max-dist 600 --margin 1.5
+"""
+
+import argparse
+import re
+import sys
+
+FILTER_SECTION_SIZE = 3
+SLOT_CAL_MAX_SAMPLES = 16
+SLOT_MATCH_MAX_DIST = 400
+SLOT_MATCH_MARGIN = 2
+
+SLOT_LINE = re.compile(r"SLOT (-?\d+),(-?\d+),(\d+),(\d+)")
+WAKEUP_LINE = re.compile(r"WAKEUP (-?\d+),(-?\d+)")
+
+
+def cdiv(a, b):
+    # C integer division, truncates toward zero
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+class Table:
+    """slotCalibration_t and the functions working on it."""
+
+    def __init__(self):
+        self.stage = [[0, 0, 0] for _ in range(FILTER_SECTION_SIZE)]   # ampDelta, phaseDelta, samples
+
+    def add(self, stage, amp, phase):
+        # addCalibrationSample
+        c = self.stage[stage - 1]
+        if c[2] < SLOT_CAL_MAX_SAMPLES:
+            c[2] += 1
+        c[0] += cdiv(amp - c[0], c[2])
+        c[1] += cdiv(phase - c[1], c[2])
+
+    def classify(self, amp, phase, max_dist, margin):
+        # slotLocatorClassify
+        best = nxt = None
+        best_stage = 0
+        for i, (ca, cp, n) in enumerate(self.stage):
+            if n == 0:
+                continue
+            dist = (amp - ca) ** 2 + (phase - cp) ** 2
+            if best is None or dist < best:
+                nxt, best, best_stage = best, dist, i + 1
+            elif nxt is None or dist < nxt:
+                nxt = dist
+        if best is None or best > max_dist or (nxt is not None and nxt < margin * best):
+            return 0
+        return best_stage
+
+
+def read_trace(path):
+    samples, wakeups, unlabeled = [], 0, 0
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = SLOT_LINE.search(line)
+            if m:
+                amp, phase, cal, est = (int(v) for v in m.groups())
+                if 1 <= cal <= FILTER_SECTION_SIZE:
+                    samples.append((amp, phase, cal, est))
+                else:
+                    unlabeled += 1
+                continue
+            if WAKEUP_LINE.search(line):
+                wakeups += 1
+    return samples, wakeups, unlabeled
+
+
+def report(title, pairs):
+    matrix = [[0] * (FILTER_SECTION_SIZE + 1) for _ in range(FILTER_SECTION_SIZE)]
+    for truth, est in pairs:
+        matrix[truth - 1][est] += 1
+    accepted = sum(1 for _, e in pairs if e)
+    correct = sum(1 for t, e in pairs if e == t)
+
+    print(title)
+    print("  true\\est  " + "".join("%6d" % e for e in range(FILTER_SECTION_SIZE + 1)))
+    for i, row in enumerate(matrix):
+        print("  %-9d " % (i + 1) + "".join("%6d" % v for v in row))
+    if pairs:
+        print("  accepted %d/%d (reject %.1f%%), correct %d/%d accepted (%.1f%%)" % (
+            accepted, len(pairs), 100.0 * (len(pairs) - accepted) / len(pairs),
+            correct, accepted, 100.0 * correct / accepted if accepted else 0.0))
+    print()
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Score the stage classifier on a captured CDC trace.")
+    ap.add_argument("trace", help="terminal capture holding SLOT/WAKEUP lines")
+    ap.add_argument("--max-dist", type=int, default=SLOT_MATCH_MAX_DIST,
+                    help="SLOT_MATCH_MAX_DIST to evaluate (default %(default)s)")
+    ap.add_argument("--margin", type=float, default=SLOT_MATCH_MARGIN,
+                    help="runner-up distance factor to evaluate (default %(default)s)")
+    args = ap.parse_args()
+
+    samples, wakeups, unlabeled = read_trace(args.trace)
+    print("%d wake-ups, %d labelled events, %d unlabelled events" % (wakeups, len(samples), unlabeled))
+    if not samples:
+        print("no SLOT lines with a calStage, record some with \"calStage N\"")
+        return 1
+    print()
+
+    table = Table()
+    replay, mismatch = [], 0
+    for amp, phase, cal, est in samples:
+        # The firmware estimate always uses the compiled-in constants
+        mismatch += est != table.classify(amp, phase, SLOT_MATCH_MAX_DIST, SLOT_MATCH_MARGIN)
+        replay.append((cal, table.classify(amp, phase, args.max_dist, args.margin)))
+        table.add(cal, amp, phase)
+    report("replay (capture order)", replay)
+    if mismatch:
+        print("  %d firmware estimates differ from the replay: the capture did not start after"
+              " \"calClear\" or the firmware constants changed\n" % mismatch)
+
+    holdout = []
+    for i, (amp, phase, cal, _) in enumerate(samples):
+        table = Table()
+        for j, (a, p, c, _) in enumerate(samples):
+            if j != i:
+                table.add(c, a, p)
+        holdout.append((cal, table.classify(amp, phase, args.max_dist, args.margin)))
+    report("holdout (leave one out)", holdout)
+
+    print("final centroids (amp, phase, samples):")
+    table = Table()
+    for amp, phase, cal, _ in samples:
+        table.add(cal, amp, phase)
+    for i, c in enumerate(table.stage):
+        print("  stage %d: %d, %d, %d" % (i + 1, c[0], c[1], c[2]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
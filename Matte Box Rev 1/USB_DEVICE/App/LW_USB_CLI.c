@@ -8,6 +8,28 @@
  *	setTime 12,00,00 (returns "OK")
  *	setDate 01,01,2020 (returns "OK")
  *	getDateTime (returns date and time -> "01/01/2020 12:00:00")
+ *	calStage 1 (returns "OK", the next filter inserted is recorded as a stage 1 sample)
+ *	calClear (returns "OK", erases the stage calibration)
+ *	spiRec (returns "OK", starts recording the RF SPI transactions, needs PLATFORM_SPI_TRACE)
+ *	spiDump (stops recording, returns the trace as "spiLoad" lines that load it back)
+ *	spiLoad 0:b5a1... (offset:hex, returns "OK". Offset 0 starts a new trace, lines must follow on)
+ *	spiReplay (runs one filter inventory against the trace instead of the bus, returns the tags found,
+ *			the transactions used and the MOSI mismatches)
+ *	invBench 20,0,5 (tags, UID distribution, RF error %. Returns inventory statistics for 1 and 16 slots,
+ *					needs ISO15693_SIM_TAGS)
+ *	gfxBench (returns the cycles to render 3 slots per text path, needs CANVAS_BENCHMARK)
+ *	gfxCache (returns the filter name cache hits and misses)
+ *	epdStats (returns the redraw counters, request to display latency and render time)
+ *	epdFrame (returns the frame on the display as hex rows, Tools/epd_frame.py turns it into an image)
+ *	memStats (returns the static RAM, heap use and the stack high-water mark)
+ *	epdSpi (returns the EPD SPI traffic of the last update of each kind, per stage and repeat frame,
+ *			with the cost model prediction)
+ *	epdCost 4,96,20 (update kind, lines, deg C. Returns the predicted refresh time, kinds as in EPD_update)
+ *	logStats (returns the SD logger counters: records, blocks, writes, syncs, space reservations,
+ *			card power-ups and powered time)
+ *	sdBench 16 (size in 64 KB. Writes and reads back a file on the card, returns the throughput
+ *			and the CPU time the SD driver didn't hand back to the main loop, or the step that failed
+ *			with its FRESULT)
  *
  *
  *
@@ -18,6 +40,7 @@
  *******************************************************************************/
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -25,10 +48,18 @@
 
 #include "usbd_cdc_if.h"
 #include "rtc.h"
+#include "slot_locator.h"
+#include "spi.h"
+#include "iso15693_sim.h"
+#include "epd_gfx.h"
+#include "mem_usage.h"
+#include "dataLogger.h"
 
 /******************************************************************************
  * DEFINES
  *******************************************************************************/
+#define CLI_TX_TIMEOUT		100			/* ms to wait for the CDC endpoint on multi line replies	*/
+#define CLI_SEND_TEXT(text)	CDC_Transmit_FS((uint8_t *) (text), sizeof(text) - 1)	/* String literals, without the NUL	*/
 
 
 /******************************************************************************
@@ -37,28 +68,53 @@
 static cliHandler_t usbCli;
 static bool cliInitialized = false;
 
+static char parseBuffer[CLI_BUFFER_LEN + 1];	/* strtok works on a terminated copy of cmd_buffer	*/
+
+extern EPD_HandleTypeDef epd1;
+extern Canvas canvas1;
+
 /******************************************************************************
  * PRIVATE PROTOTYPES
  *******************************************************************************/
 cli_error parseCommand(void);		/* Command Parser			*/
 cli_error parseArguments(void);		/* Command Parser			*/
 cli_error executeCommand(void);		/* Command Parser			*/
+static void cliSendBlocking(uint8_t *buf, uint16_t len);
+static void dumpEpdFrame(void);
+static void dumpEpdSpiStats(void);
+static uint16_t formatSpiCounters(uint8_t *buf, const char *name, const EPD_spi_counters *c);
+static void runEpdCost(void);
+static void runSdBenchmark(void);
+#if PLATFORM_SPI_TRACE
+static void dumpSpiTrace(void);
+static void loadSpiTrace(void);
+static void runSpiReplay(void);
+#endif
+#if ISO15693_SIM_TAGS
+static void runInventoryBenchmark(void);
+#endif
+#if CANVAS_BENCHMARK
+static void runGfxBenchmark(void);
+#endif
 
 /******************************************************************************
  * PRIVATE FUNCTIONS
  *******************************************************************************/
 cli_error parseCommand(void) {
-	// Allocate enough memory for the command
-	uint8_t *tempCommand = malloc(usbCli.cmd_len);
-	// Copy the Buffer into tempCommand
-	memcpy(tempCommand, usbCli.cmd_buffer, usbCli.cmd_len + 1);
+	// Copy the Buffer into the parse buffer
+	memcpy(parseBuffer, usbCli.cmd_buffer, usbCli.cmd_len);
+	parseBuffer[usbCli.cmd_len] = '\0';
 
 	// Split the string based on the space token
-	char *token = strtok((char*)tempCommand, " ");
+	char *token = strtok(parseBuffer, " ");
 
 	// Initialize command
 	usbCli.command = noCommand;
 
+	if (token == NULL) {
+		return CLI_ERR;
+	}
+
 	// Figure out which command was entered
 	if (strcmp(token, "setTime") == 0) {
 		usbCli.command = setTime;
@@ -69,8 +125,55 @@ cli_error parseCommand(void) {
 	if (strcmp(token, "getDateTime") == 0) {
 		usbCli.command = getDateTime;
 	}
+	if (strcmp(token, "calStage") == 0) {
+		usbCli.command = calStage;
+	}
+	if (strcmp(token, "calClear") == 0) {
+		usbCli.command = calClear;
+	}
+	if (strcmp(token, "spiRec") == 0) {
+		usbCli.command = spiRec;
+	}
+	if (strcmp(token, "spiDump") == 0) {
+		usbCli.command = spiDump;
+	}
+	if (strcmp(token, "spiLoad") == 0) {
+		usbCli.command = spiLoad;
+	}
+	if (strcmp(token, "spiReplay") == 0) {
+		usbCli.command = spiReplay;
+	}
+	if (strcmp(token, "invBench") == 0) {
+		usbCli.command = invBench;
+	}
+	if (strcmp(token, "gfxBench") == 0) {
+		usbCli.command = gfxBench;
+	}
+	if (strcmp(token, "gfxCache") == 0) {
+		usbCli.command = gfxCache;
+	}
+	if (strcmp(token, "epdStats") == 0) {
+		usbCli.command = epdStats;
+	}
+	if (strcmp(token, "epdFrame") == 0) {
+		usbCli.command = epdFrame;
+	}
+	if (strcmp(token, "memStats") == 0) {
+		usbCli.command = memStats;
+	}
+	if (strcmp(token, "epdSpi") == 0) {
+		usbCli.command = epdSpi;
+	}
+	if (strcmp(token, "epdCost") == 0) {
+		usbCli.command = epdCost;
+	}
+	if (strcmp(token, "logStats") == 0) {
+		usbCli.command = logStats;
+	}
+	if (strcmp(token, "sdBench") == 0) {
+		usbCli.command = sdBench;
+	}
 
-	free(tempCommand);
 	return CLI_OK;
 }
 
@@ -78,21 +181,24 @@ cli_error parseArguments(void) {
 	uint8_t i = 0;
 
 	// Check if arguments should be available
-	if ((usbCli.command == setTime) | (usbCli.command == setDate)) {
+	if ((usbCli.command == setTime) | (usbCli.command == setDate) | (usbCli.command == calStage) | (usbCli.command == invBench) | (usbCli.command == epdCost) | (usbCli.command == sdBench)) {
 
-		// Allocate enough memory for the argument string
-		uint8_t *tempCommand = malloc(usbCli.cmd_len);
-
-		// Copy the Buffer into tempCommand
-		memcpy(tempCommand, usbCli.cmd_buffer, usbCli.cmd_len);
+		// Copy the Buffer into the parse buffer
+		memcpy(parseBuffer, usbCli.cmd_buffer, usbCli.cmd_len);
+		parseBuffer[usbCli.cmd_len] = '\0';
 
 		// Split the string based on the space token
-		char *token = strtok((char*)tempCommand, " ");
+		char *token = strtok(parseBuffer, " ");
 		// Get the arguments after the command
 		token = strtok(NULL, " ");
 
-		char *tempArgs = malloc(strlen(token));
-		strcpy(tempArgs, token);
+		if (token == NULL) {
+			// Command without its arguments
+			usbCli.command = noCommand;
+			return CLI_ERR;
+		}
+
+		char *tempArgs;
 
 		switch (usbCli.command) {
 			case noCommand:
@@ -100,9 +206,10 @@ cli_error parseArguments(void) {
 
 			case setTime:
 				// Break up each argument based on ":" Delimiter
+				memset(usbCli.arguments, 0, sizeof(usbCli.arguments));
 				tempArgs = strtok(token, ":");
 				i = 0;
-				while (tempArgs != NULL) {
+				while ((tempArgs != NULL) && (i < MAX_ARGUMENTS)) {
 					usbCli.arguments[i] = atoi(tempArgs);
 					tempArgs = strtok(NULL, ":");
 					i++;
@@ -111,9 +218,10 @@ cli_error parseArguments(void) {
 
 			case setDate:
 				// Break up each argument based on "/" Delimiter
+				memset(usbCli.arguments, 0, sizeof(usbCli.arguments));
 				tempArgs = strtok(token, "/");
 				i = 0;
-				while (tempArgs != NULL) {
+				while ((tempArgs != NULL) && (i < MAX_ARGUMENTS)) {
 					usbCli.arguments[i] = atoi(tempArgs);
 					tempArgs = strtok(NULL, "/");
 					i++;
@@ -123,9 +231,47 @@ cli_error parseArguments(void) {
 			case getDateTime:
 				break;
 
+			case calStage:
+				// Single argument, the stage number
+				usbCli.arguments[0] = atoi(token);
+				break;
+
+			case sdBench:
+				// Single argument, the file size in 64 KB. 0 = not a number, rejected by the command
+				usbCli.value = strtoul(token, &tempArgs, 10);
+				if (*tempArgs != '\0') {
+					usbCli.value = 0;
+				}
+				break;
+
+			case invBench:
+			case epdCost:
+				// Break up each argument based on "," Delimiter
+				memset(usbCli.arguments, 0, sizeof(usbCli.arguments));
+				tempArgs = strtok(token, ",");
+				i = 0;
+				while ((tempArgs != NULL) && (i < MAX_ARGUMENTS)) {
+					usbCli.arguments[i] = atoi(tempArgs);
+					tempArgs = strtok(NULL, ",");
+					i++;
+				}
+				break;
+
+			case calClear:
+			case spiRec:
+			case spiDump:
+			case spiLoad:
+			case spiReplay:
+			case gfxBench:
+			case gfxCache:
+			case epdStats:
+			case epdFrame:
+			case memStats:
+			case epdSpi:
+			case logStats:
+				break;
+
 		}
-		free(tempCommand);
-		free(tempArgs);
 	}
 	return CLI_OK;
 }
@@ -134,22 +280,30 @@ cli_error executeCommand(void) {
 	static volatile RTC_DateTypeDef tmpDate;
 	static volatile RTC_TimeTypeDef tmpTime;
 	uint8_t dateTimeRet[25] = {0};
+	static uint8_t cacheRet[64];
+	static uint8_t refreshRet[176];
+	static uint8_t memRet[112];
+	static uint8_t logRet[288];
+	Canvas_cache_stats cacheStats;
+	Canvas_refresh_stats refreshStats;
+	memUsage_t memUsage;
+	DL_stats logCounters;
 
 	switch (usbCli.command) {
 		case noCommand:
 			// Command Not Valid, Do Nothing
-			CDC_Transmit_FS("Incorrect Command!\r\n", 22);
+			CLI_SEND_TEXT("Incorrect Command!\r\n");
 			break;
 
 		case setTime:
 			// Run the set time rtc function
 			rtcSetTime(usbCli.arguments[0], usbCli.arguments[1], usbCli.arguments[2]);
-			CDC_Transmit_FS("OK\r\n", 6);
+			CLI_SEND_TEXT("OK\r\n");
 			break;
 
 		case setDate:
 			rtcSetDate(usbCli.arguments[0], usbCli.arguments[1], usbCli.arguments[2], 0);
-			CDC_Transmit_FS("OK\r\n", 6);
+			CLI_SEND_TEXT("OK\r\n");
 			break;
 
 		case getDateTime:
@@ -168,6 +322,122 @@ cli_error executeCommand(void) {
 			CDC_Transmit_FS(dateTimeRet, strlen((char *)dateTimeRet));
 
 			break;
+
+		case calStage:
+			if ((usbCli.arguments[0] < 1) | (usbCli.arguments[0] > FILTER_SECTION_SIZE)) {
+				CLI_SEND_TEXT("Incorrect Stage!\r\n");
+				break;
+			}
+			slotLocatorCalibrate(usbCli.arguments[0]);
+			CLI_SEND_TEXT("OK\r\n");
+			break;
+
+		case calClear:
+			slotLocatorClearCalibration();
+			CLI_SEND_TEXT("OK\r\n");
+			break;
+
+		case spiRec:
+#if PLATFORM_SPI_TRACE
+			spiTraceRecord();
+			CLI_SEND_TEXT("OK\r\n");
+#else
+			CLI_SEND_TEXT("Trace Disabled!\r\n");
+#endif
+			break;
+
+		case spiDump:
+#if PLATFORM_SPI_TRACE
+			spiTraceStop();
+			dumpSpiTrace();
+#else
+			CLI_SEND_TEXT("Trace Disabled!\r\n");
+#endif
+			break;
+
+		case spiLoad:
+#if PLATFORM_SPI_TRACE
+			loadSpiTrace();
+#else
+			CLI_SEND_TEXT("Trace Disabled!\r\n");
+#endif
+			break;
+
+		case spiReplay:
+#if PLATFORM_SPI_TRACE
+			runSpiReplay();
+#else
+			CLI_SEND_TEXT("Trace Disabled!\r\n");
+#endif
+			break;
+
+		case invBench:
+#if ISO15693_SIM_TAGS
+			runInventoryBenchmark();
+#else
+			CLI_SEND_TEXT("Simulation Disabled!\r\n");
+#endif
+			break;
+
+		case gfxBench:
+#if CANVAS_BENCHMARK
+			runGfxBenchmark();
+#else
+			CLI_SEND_TEXT("Benchmark Disabled!\r\n");
+#endif
+			break;
+
+		case gfxCache:
+			canvas_GetNameCacheStats(&cacheStats);
+			sprintf((char *)cacheRet, "names: %lu hits, %lu misses, %lu evictions\r\n",
+					cacheStats.hits, cacheStats.misses, cacheStats.evictions);
+			CDC_Transmit_FS(cacheRet, strlen((char *)cacheRet));
+			break;
+
+		case epdStats:
+			canvas_GetRefreshStats(&refreshStats);
+			sprintf((char *)refreshRet, "redraws: %lu req, %lu coalesced, %lu updates, latency %lu ms (max %lu ms), render %lu cyc (max %lu cyc)\r\n",
+					refreshStats.requests, refreshStats.coalesced, refreshStats.refreshes,
+					refreshStats.lastLatency, refreshStats.maxLatency,
+					refreshStats.renderCycles, refreshStats.maxRenderCycles);
+			CDC_Transmit_FS(refreshRet, strlen((char *)refreshRet));
+			break;
+
+		case epdFrame:
+			// The canvas is only read, an update in flight keeps sending the back buffer
+			dumpEpdFrame();
+			break;
+
+		case memStats:
+			memUsageGet(&memUsage);
+			sprintf((char *)memRet, "ram: %lu B, static %lu B, heap %lu/%lu B, stack peak %lu/%lu B%s\r\n",
+					memUsage.ramSize, memUsage.staticSize,
+					memUsage.heapUsed, memUsage.heapReserved,
+					memUsage.stackPeak, memUsage.stackReserved,
+					memUsage.stackOverflow ? " OVERFLOW" : "");
+			CDC_Transmit_FS(memRet, strlen((char *)memRet));
+			break;
+
+		case epdSpi:
+			dumpEpdSpiStats();
+			break;
+
+		case epdCost:
+			runEpdCost();
+			break;
+
+		case logStats:
+			dataLoggerGetStats(&logCounters);
+			sprintf((char *)logRet, "records %lu in %lu blocks, dropped %lu, lost %lu B, buffered %u B, writes %lu, %lu B, syncs %lu, "
+					"opens %lu, reserves %lu, power ups %lu, powered %lu ms, errors %lu\r\n",
+					logCounters.records, logCounters.blocks, logCounters.dropped, logCounters.lost, logCounters.buffered, logCounters.flushes, logCounters.bytes,
+					logCounters.syncs, logCounters.opens, logCounters.reserves, logCounters.powerUps, logCounters.poweredMs, logCounters.errors);
+			CDC_Transmit_FS(logRet, strlen((char *)logRet));
+			break;
+
+		case sdBench:
+			runSdBenchmark();
+			break;
 	}
 
 	// Reset Command Status
@@ -177,6 +447,310 @@ cli_error executeCommand(void) {
 	return CLI_OK;
 }
 
+// The CDC endpoint only holds one transfer, wait for the previous one to drain
+static void cliSendBlocking(uint8_t *buf, uint16_t len) {
+	uint32_t start = HAL_GetTick();
+
+	while (CDC_Transmit_FS(buf, len) == USBD_BUSY) {
+		if (HAL_GetTick() - start > CLI_TX_TIMEOUT) return;
+	}
+}
+
+// The front buffer row by row, the way the canvas stores it (pixel x % 8 in bit x % 8, 0 = black).
+// Lines alternate between two buffers, one is formatted while the other is in flight.
+static void dumpEpdFrame(void) {
+	static uint8_t lineBuf[2][CANVAS_MAX_WIDTH / 4 + 3];
+	uint16_t bytesPerRow = canvas1.width / 8;
+	uint8_t *line;
+	uint16_t len, y;
+
+	len = sprintf((char *)lineBuf[0], "FRAME %ux%u\r\n", canvas1.width, canvas1.height);
+	cliSendBlocking(lineBuf[0], len);
+
+	for (y = 0; y < canvas1.height; y++) {
+		const uint8_t *row = &canvas1.front[y * bytesPerRow];
+
+		line = lineBuf[(y + 1) & 1];
+		len = 0;
+		for (uint16_t b = 0; b < bytesPerRow; b++) {
+			len += sprintf((char *)&line[len], "%02x", row[b]);
+		}
+		len += sprintf((char *)&line[len], "\r\n");
+		cliSendBlocking(line, len);
+	}
+
+	line = lineBuf[(y + 1) & 1];
+	len = sprintf((char *)line, "END\r\n");
+	cliSendBlocking(line, len);
+}
+
+// Where the time of an EPD update goes: SPI traffic per stage, the time of every repeat frame
+// and the cost model prediction for the same lines and temperature. Counters are DWT cycles,
+// shown in us. Lines alternate between two buffers, one is formatted while the other is in flight.
+static void dumpEpdSpiStats(void) {
+	static const char *kinds[] = {"power", "clear", "image_0", "image", "partial"};
+	static uint8_t lineBuf[2][160];
+	uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+	EPD_spi_stats stats;
+	EPD_cost cost;
+	uint8_t *line;
+	uint8_t n = 0;
+	uint16_t len;
+
+	for (EPD_update update = EPD_UPDATE_NONE; update <= EPD_UPDATE_PARTIAL; update++) {
+		EPD_get_spi_stats(update, &stats);
+		if (stats.power.transactions == 0 && stats.update_ms == 0) {
+			continue;		// Nothing of this kind since the reset
+		}
+
+		line = lineBuf[n++ & 1];
+		if (update == EPD_UPDATE_NONE) {
+			len = sprintf((char *)line, "%s:\r\n", kinds[update]);
+		} else {
+			EPD_estimate(&epd1, update, stats.lines_changed, stats.temperature, &cost);
+			len = sprintf((char *)line, "%s%s: %u lines, %d C, stage %u ms, frames %lu ms (model %lu ms, %u x %u frames)\r\n",
+					kinds[update], (update == EPD_last_update()) ? " (last)" : "",
+					stats.lines_changed, stats.temperature / 8, stats.stage_time,
+					stats.update_ms, cost.total_ms - cost.power_up_ms, cost.stages, cost.frames);
+		}
+		cliSendBlocking(line, len);
+
+		line = lineBuf[n++ & 1];
+		len = formatSpiCounters(line, "power", &stats.power);
+		cliSendBlocking(line, len);
+
+		for (uint8_t stage = 0; stage < 4; stage++) {
+			if (stats.frames[stage] == 0) {
+				continue;
+			}
+			line = lineBuf[n++ & 1];
+			len = sprintf((char *)line, "  stage %u: %u frames,", stage, stats.frames[stage]);
+			len += formatSpiCounters(&line[len], "", &stats.stage[stage]);
+			cliSendBlocking(line, len);
+
+			// The last column adds up the frames past EPD_STATS_FRAMES
+			line = lineBuf[n++ & 1];
+			len = sprintf((char *)line, "    frame us:");
+			for (uint8_t f = 0; f < EPD_STATS_FRAMES && f < stats.frames[stage]; f++) {
+				len += sprintf((char *)&line[len], " %lu", stats.frame_cycles[stage][f] / cyclesPerUs);
+			}
+			len += sprintf((char *)&line[len], "\r\n");
+			cliSendBlocking(line, len);
+		}
+	}
+
+	line = lineBuf[n & 1];
+	len = sprintf((char *)line, "END\r\n");
+	cliSendBlocking(line, len);
+}
+
+static uint16_t formatSpiCounters(uint8_t *buf, const char *name, const EPD_spi_counters *c) {
+	uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+
+	return sprintf((char *)buf, "  %s %lu B, %lu transfers, %lu CS edges, %lu guards %lu us, SPI wait %lu us\r\n",
+			name, c->bytes, c->transactions, c->cs_toggles,
+			c->guards, c->guard_cycles / cyclesPerUs, c->wait_cycles / cyclesPerUs);
+}
+
+// Refresh time the cost model predicts, the arguments are bytes so the temperature comes in as int8
+static void runEpdCost(void) {
+	static uint8_t costRet[160];
+	EPD_cost cost;
+	uint16_t len;
+
+	if (usbCli.arguments[0] > EPD_UPDATE_PARTIAL) {
+		CLI_SEND_TEXT("Incorrect Update!\r\n");
+		return;
+	}
+
+	EPD_estimate(&epd1, usbCli.arguments[0], usbCli.arguments[1], (int8_t) usbCli.arguments[2] * 8, &cost);
+	len = sprintf((char *)costRet, "%lu ms: power up %u ms, %u stages x %u frames of %lu us, stage %u ms, %lu B, guards %lu us\r\n",
+			cost.total_ms, cost.power_up_ms, cost.stages, cost.frames, cost.frame_us,
+			cost.stage_ms, cost.bytes, cost.guard_us);
+	CDC_Transmit_FS(costRet, len);
+}
+
+// CPU share of a pass: everything but the cycles the SD driver spent waiting
+static uint32_t busyPercent(uint32_t cycles, uint32_t waitCycles) {
+	return (cycles == 0) ? 0 : (uint32_t) (((uint64_t) (cycles - waitCycles) * 100U) / cycles);
+}
+
+// Sequential write and read throughput of the card, in the logger's flush size
+static void runSdBenchmark(void) {
+	// Indexed by DL_bench_step
+	static const char* const stepNames[] = {"done", "logger not ready", "no SD card", "log flush", "mount", "open",
+			"write", "read"};
+	static uint8_t lineBuf[2][144];
+	DL_bench bench;
+	DL_error err;
+	uint16_t len;
+
+	if ((usbCli.value == 0) | (usbCli.value > DL_BENCH_MAX_KB / 64U)) {
+		len = sprintf((char *)lineBuf[0], "Usage: sdBench 1..%u (size in 64 KB)\r\n", DL_BENCH_MAX_KB / 64U);
+		CDC_Transmit_FS(lineBuf[0], len);
+		return;
+	}
+
+	err = dataLoggerBenchmark(usbCli.value * 64U, &bench);
+	if (bench.bytes == 0) {
+		len = sprintf((char *)lineBuf[0], "sdBench failed: %s, FRESULT %u\r\n", stepNames[bench.step], bench.fr);
+		CDC_Transmit_FS(lineBuf[0], len);
+		return;
+	}
+
+	len = sprintf((char *)lineBuf[0], "write: %lu KB/s, %lu ms, CPU %lu%% busy (%lu/%lu cyc)\r\n",
+			(bench.writeMs == 0) ? 0 : (bench.bytes / 1024U) * 1000U / bench.writeMs, bench.writeMs,
+			busyPercent(bench.writeCycles, bench.writeWaitCycles), bench.writeCycles - bench.writeWaitCycles, bench.writeCycles);
+	cliSendBlocking(lineBuf[0], len);
+
+	len = sprintf((char *)lineBuf[1], "read: %lu KB/s, %lu ms, CPU %lu%% busy (%lu/%lu cyc), %lu unaligned, ",
+			(bench.readMs == 0) ? 0 : (bench.bytes / 1024U) * 1000U / bench.readMs, bench.readMs,
+			busyPercent(bench.readCycles, bench.readWaitCycles), bench.readCycles - bench.readWaitCycles, bench.readCycles,
+			bench.scratch);
+	if (err == DATALOG_OK) {
+		len += sprintf((char *)&lineBuf[1][len], "OK\r\n");
+	} else {
+		len += sprintf((char *)&lineBuf[1][len], "FAILED: %s, FRESULT %u, %lu mismatches\r\n", stepNames[bench.step],
+				bench.fr, bench.mismatches);
+	}
+	cliSendBlocking(lineBuf[1], len);
+}
+
+#if PLATFORM_SPI_TRACE
+
+// The trace as "spiLoad offset:hex" lines. Sent back one at a time, they load the trace into the same
+// or another box. Lines alternate between two buffers, one is formatted while the other is in flight.
+static void dumpSpiTrace(void) {
+	static uint8_t lineBuf[2][24 + 2 * SPI_TRACE_LOAD_LEN];
+	const spiTraceStats_t *stats = spiTraceGetStats();
+	const uint8_t *data;
+	uint8_t *line;
+	uint16_t len, size, off, n = 0;
+
+	data = spiTraceData(&size);
+
+	line = lineBuf[n++ & 1];
+	len = sprintf((char *)line, "// %u of %lu transactions, %u B\r\n", spiTraceCount(), stats->transactions, size);
+	cliSendBlocking(line, len);
+
+	for (off = 0; off < size; off += SPI_TRACE_LOAD_LEN) {
+		line = lineBuf[n++ & 1];
+		len = sprintf((char *)line, "spiLoad %u:", off);
+		for (uint16_t j = off; (j < size) && (j < off + SPI_TRACE_LOAD_LEN); j++) {
+			len += sprintf((char *)&line[len], "%02x", data[j]);
+		}
+		len += sprintf((char *)&line[len], "\r\n");
+		cliSendBlocking(line, len);
+	}
+
+	line = lineBuf[n & 1];
+	len = sprintf((char *)line, "// %lu bytes, %lu cycles, %lu dropped\r\n", stats->bytes, stats->cycles, stats->dropped);
+	cliSendBlocking(line, len);
+}
+
+// One "spiLoad offset:hex" line of a dump
+static void loadSpiTrace(void) {
+	uint8_t data[SPI_TRACE_LOAD_LEN];
+	char *token, *hex;
+	uint16_t n = 0;
+	uint32_t offset;
+
+	memcpy(parseBuffer, usbCli.cmd_buffer, usbCli.cmd_len);
+	parseBuffer[usbCli.cmd_len] = '\0';
+	strtok(parseBuffer, " ");
+	token = strtok(NULL, " \r\n");
+
+	hex = (token != NULL) ? strchr(token, ':') : NULL;
+	if (hex == NULL) {
+		CLI_SEND_TEXT("Incorrect Arguments!\r\n");
+		return;
+	}
+	offset = strtoul(token, NULL, 10);
+	hex++;
+
+	while ((hex[0] != '\0') && (hex[1] != '\0') && (n < SPI_TRACE_LOAD_LEN)) {
+		char byteStr[3] = {hex[0], hex[1], '\0'};
+		data[n++] = (uint8_t) strtoul(byteStr, NULL, 16);
+		hex += 2;
+	}
+
+	if ((offset > UINT16_MAX) || !spiTraceLoad((uint16_t) offset, data, n)) {
+		CLI_SEND_TEXT("Incorrect Offset!\r\n");
+		return;
+	}
+	CLI_SEND_TEXT("OK\r\n");
+}
+
+// One checkFilterTags() pass fed from the trace. A trace recorded with spiRec starts right before
+// the inventory of the same main loop pass, so the two line up from the first transfer.
+static void runSpiReplay(void) {
+	static uint8_t lineBuf[128];
+	static detectedTags_t replayTags;
+	const spiTraceStats_t *stats;
+	ReturnCode err;
+	uint16_t len;
+
+	if (spiTraceCount() == 0) {
+		CLI_SEND_TEXT("No Trace!\r\n");
+		return;
+	}
+
+	spiTraceReplay();
+	err = checkFilterTags(&replayTags);
+	spiTraceStop();
+
+	stats = spiTraceGetStats();
+	len = sprintf((char *)lineBuf, "replay: %u tags, err %d, %u/%u transactions, %lu mismatches%s\r\n",
+			replayTags.tagCount, err, spiTraceReplayed(), spiTraceCount(), stats->mismatches,
+			(stats->exhausted != 0) ? ", trace exhausted" : "");
+	CDC_Transmit_FS(lineBuf, len);
+}
+#endif
+
+#if ISO15693_SIM_TAGS
+// Same population, same seed, one inventory with 1 slot and one with 16 slots
+static void runInventoryBenchmark(void) {
+	static uint8_t lineBuf[2][128];
+	simInventoryStats_t stats;
+	iso15693NumSlots_t slots[2] = {ISO15693_NUM_SLOTS_1, ISO15693_NUM_SLOTS_16};
+	uint32_t seed = HAL_GetTick();
+	uint16_t len;
+
+	if ((usbCli.arguments[0] == 0) | (usbCli.arguments[0] > ISO15693_SIM_MAX_TAGS) | (usbCli.arguments[1] > SIM_UID_CLUSTERED)) {
+		CLI_SEND_TEXT("Incorrect Arguments!\r\n");
+		return;
+	}
+
+	for (uint8_t i = 0; i < 2; i++) {
+		iso15693SimLoad(usbCli.arguments[0], usbCli.arguments[1], usbCli.arguments[2], seed);
+		iso15693SimBenchmark(slots[i], &stats);
+
+		len = sprintf((char *)lineBuf[i], "%2u slots: %u/%u tags, %lu req, %lu eof, %lu col, %lu err, %lu us air, %lu us delay, %lu cyc\r\n",
+				(i == 0) ? 1 : 16, stats.tagsFound, usbCli.arguments[0], stats.requests, stats.eofs, stats.collisions,
+				stats.errors, stats.airTimeUs, stats.guardTimeUs, stats.cpuCycles);
+		cliSendBlocking(lineBuf[i], len);
+	}
+}
+#endif
+
+#if CANVAS_BENCHMARK
+// Cycles to render a 3 slot screen for each way of drawing the text
+static void runGfxBenchmark(void) {
+	static uint8_t lineBuf[112];
+	Canvas_bench bench;
+	uint16_t len;
+
+	if (canvas_Benchmark(&canvas1, &epd1, &bench) != CANVAS_OK) {
+		CLI_SEND_TEXT("Wrong Rotation!\r\n");
+		return;
+	}
+
+	len = sprintf((char *)lineBuf, "pixel: %lu cyc, blit: %lu cyc, packed: %lu cyc, cached: %lu cyc, frames %s\r\n",
+			bench.pixelCycles, bench.blitCycles, bench.packedCycles, bench.cachedCycles, bench.match ? "match" : "DIFFER");
+	CDC_Transmit_FS(lineBuf, len);
+}
+#endif
+
 /******************************************************************************
  * PUBLIC FUNCTIONS
  *******************************************************************************/
@@ -190,6 +764,9 @@ void rxCliInput(uint8_t* Buf, uint32_t *Len) {
 	if (Buf[0] != 13){					// Ignore Return Character
 		usbCli.rxFlag = true;			/* Set the flag for the parser				*/
 		usbCli.cmd_len = Len[0];		/* Store the command length for the parser	*/
+		if (usbCli.cmd_len > CLI_BUFFER_LEN) {
+			usbCli.cmd_len = CLI_BUFFER_LEN;
+		}
 
 		// Copy the Received String to the Buffer in the structure
 		memcpy(usbCli.cmd_buffer, Buf, usbCli.cmd_len);
@@ -30,12 +30,29 @@ typedef enum {
 	noCommand,
 	setTime,
 	setDate,
-	getDateTime
+	getDateTime,
+	calStage,
+	calClear,
+	spiRec,
+	spiDump,
+	spiLoad,
+	spiReplay,
+	invBench,
+	gfxBench,
+	gfxCache,
+	epdStats,
+	epdFrame,
+	memStats,
+	epdSpi,
+	epdCost,
+	logStats,
+	sdBench
 } command_t;
 
 typedef struct {
 	command_t command;
 	uint8_t arguments[MAX_ARGUMENTS];
+	uint32_t value;							/* Single argument too wide for [arguments]	*/
 
 	bool rxFlag;							/* Receive Flag							*/
 	uint32_t cmd_len;						/* Length of the Returned CLI Command 	*/